@@ -16,6 +16,91 @@ void test_ltisys( void );
 void test_ffmath( void );
 void test_mat( void );
 void test_interp1( void );
+void test_interpN( void );
+void test_smoother( void );
+
+namespace takajiSpec {
+    enum : fis::tag { input1, input2 };
+    enum : fis::tag { output1, output2 };
+    enum : fis::tag { input1_Neg, input1_Pos, input2_Small, input2_Big };
+    enum : fis::tag { output1_mf1, output2_mf1, output2_mf2, output2_mf3, output2_mf4 };
+
+    constexpr fis::rules rules[] = {
+        FIS_RULES_BEGIN
+            IF input1 IS input1_Neg AND input2 IS input2_Small THEN output1 IS output1_mf1 AND output2 IS output2_mf4 END
+            IF input1 IS input1_Neg AND input2 IS input2_Big THEN output1 IS output1_mf1 AND output2 IS output2_mf3 END
+            IF input1 IS input1_Pos AND input2 IS input2_Small THEN output1 IS output1_mf1 AND output2 IS output2_mf2 END
+            IF input1 IS input1_Pos AND input2 IS input2_Big THEN output1 IS output1_mf1 AND output2 IS output2_mf1 END
+        FIS_RULES_END
+    };
+
+    template <typename fisSystem>
+    real_t fitError( fisSystem &s,
+                     const real_t (&in)[ 64 ][ 2 ],
+                     const real_t (&out)[ 64 ][ 2 ] )
+    {
+        real_t y[ 64 ][ 2 ];
+        real_t e = 0.0f;
+
+        (void)s.evaluateBatch( &in[ 0 ][ 0 ], &y[ 0 ][ 0 ], 64U );
+        for ( int i = 0; i < 64; ++i ) {
+            e += ( y[ i ][ 0 ] - out[ i ][ 0 ] )*( y[ i ][ 0 ] - out[ i ][ 0 ] );
+            e += ( y[ i ][ 1 ] - out[ i ][ 1 ] )*( y[ i ][ 1 ] - out[ i ][ 1 ] );
+        }
+
+        return e/128.0f;
+    }
+}
+
+namespace tsukamotoSpec {
+    enum : fis::tag { level };
+    enum : fis::tag { valve };
+    enum : fis::tag { level_Low, level_High };
+    enum : fis::tag { valve_Open, valve_Close };
+
+    constexpr fis::rules rules[] = {
+        FIS_RULES_BEGIN
+            IF level IS level_Low THEN valve IS valve_Open END
+            IF level IS level_High THEN valve IS valve_Close END
+        FIS_RULES_END
+    };
+}
+
+namespace gradSpec {
+    enum : fis::tag { x1, x2 };
+    enum : fis::tag { y };
+    enum : fis::tag { x1_gauss, x1_gbell, x1_sig, x1_trap, x1_tri, x1_spike, x1_cos, x1_concave,
+                      x2_s, x2_z, x2_pi, x2_gauss2, x2_dsig, x2_psig, x2_lins, x2_linz };
+    enum : fis::tag { y_c0, y_c1, y_c2, y_c3, y_c4, y_c5, y_c6, y_c7 };
+
+    constexpr fis::rules rules[] = {
+        FIS_RULES_BEGIN
+            IF x1 IS x1_gauss AND x2 IS x2_s THEN y IS y_c0 END
+            IF x1 IS x1_gbell AND x2 IS x2_z THEN y IS y_c1 END
+            IF x1 IS x1_sig AND x2 IS x2_pi THEN y IS y_c2 END
+            IF x1 IS x1_trap AND x2 IS x2_gauss2 THEN y IS y_c3 END
+            IF x1 IS x1_tri AND x2 IS x2_dsig THEN y IS y_c4 END
+            IF x1 IS x1_spike AND x2 IS x2_psig THEN y IS y_c5 END
+            IF x1 IS x1_cos AND x2 IS x2_lins THEN y IS y_c6 END
+            IF x1 IS x1_concave AND x2 IS x2_linz THEN y IS y_c7 END
+        FIS_RULES_END
+    };
+
+    inline real_t loss( fis::instance &s,
+                        const real_t (&in)[ 13 ][ 2 ],
+                        const real_t (&out)[ 13 ] )
+    {
+        real_t v[ 13 ];
+        real_t e = 0.0f;
+
+        (void)s.evaluateBatch( &in[ 0 ][ 0 ], v, 13U );
+        for ( int i = 0; i < 13; ++i ) {
+            e += ( v[ i ] - out[ i ] )*( v[ i ] - out[ i ] );
+        }
+
+        return e/13.0f;
+    }
+}
 
 void test_fis3( void )
 {
@@ -62,6 +147,242 @@ void test_fis3( void )
         takaji.deFuzzify();
     }
     cout << "output1 = " << takaji[ output1 ] << " output2 = " << takaji[ output2 ] << endl;
+
+    fis::ruleTerm program[ 16 ];
+    fis::context ctx;
+    fis::input ctxIn[ 2 ];
+    fis::output ctxOut[ 2 ];
+    real_t ctxFx[ 4 ], ctxW[ 4 ];
+    const real_t x[ 2 ] = { 2.0f, 0.5f };
+    real_t y[ 2 ] = { 0.0f, 0.0f };
+    size_t mismatches = ( takaji.compileRules( program ) && ctx.setup( ctxIn, ctxOut, ctxFx, ctxW ) ) ? 0U : 1U;
+    mismatches += takaji.evaluate( ctx, x, y ) ? 0U : 1U;
+    takaji.setInput( input1, x[ 0 ] );
+    takaji.setInput( input2, x[ 1 ] );
+    takaji.fuzzify();
+    if ( takaji.inference() ) {
+        takaji.deFuzzify();
+    }
+    if ( ( y[ 0 ] < takaji[ output1 ] ) || ( y[ 0 ] > takaji[ output1 ] ) ||
+         ( y[ 1 ] < takaji[ output2 ] ) || ( y[ 1 ] > takaji[ output2 ] ) ) {
+        ++mismatches;
+    }
+    cout << "sugeno context mismatches: " << mismatches << endl;
+
+    fis::fixedSystem<fis::Sugeno, 2, 2, takajiSpec::rules,
+                     fis::sets<fis::trimf, fis::trimf, fis::trimf, fis::trimf>,
+                     fis::sets<fis::linearmf, fis::linearmf, fis::linearmf, fis::linearmf, fis::linearmf>> fixedTakaji;
+    const real_t inPoints[ 4 ][ 3 ] = { { 0.5f, 0.5f, 3.5f }, { 0.5f, 3.5f, 3.5f }, { -1.0f, -1.0f, 4.0f }, { -1.0f, 4.0f, 4.0f } };
+    const real_t outPoints[ 5 ][ 3 ] = { { 0.0f, 1.0f, 0.0f }, { 3.5f, 4.0f, 0.0f }, { 3.5f, -1.0f, 0.0f }, { 0.5f, 4.0f, 0.0f }, { 0.5f, -1.0f, 0.0f } };
+    real_t z[ 2 ] = { 0.0f, 0.0f };
+    mismatches = 0U;
+    fixedTakaji.setupInput( takajiSpec::input1, 0.5f, 3.5f );
+    fixedTakaji.setupInput( takajiSpec::input2, -1.0f, 4.0f );
+    fixedTakaji.setupOutput( takajiSpec::output1, 0.0f, 1.0f );
+    fixedTakaji.setupOutput( takajiSpec::output2, 0.0f, 1.0f );
+    for ( fis::tag m = 0; m < 4; ++m ) {
+        mismatches += fixedTakaji.setupInputMF( static_cast<fis::tag>( m/2 ), m, inPoints[ m ] ) ? 0U : 1U;
+    }
+    for ( fis::tag m = 0; m < 5; ++m ) {
+        mismatches += fixedTakaji.setupOutputMF( m, outPoints[ m ] ) ? 0U : 1U;
+    }
+    mismatches += fixedTakaji.evaluate( x, z ) ? 0U : 1U;
+    if ( ( y[ 0 ] < z[ 0 ] ) || ( y[ 0 ] > z[ 0 ] ) || ( y[ 1 ] < z[ 1 ] ) || ( y[ 1 ] > z[ 1 ] ) ) {
+        ++mismatches;
+    }
+    cout << "sugeno fixed system mismatches: " << mismatches << endl;
+
+    /*the Tsukamoto sets read the range of the first input*/
+    fis::instance tsuka;
+    fis::input tsukaIn[ 1 ];
+    fis::output tsukaOut[ 1 ];
+    fis::mf tsukaInMF[ 2 ], tsukaOutMF[ 2 ];
+    real_t tsukaW[ 2 ];
+    fis::fixedSystem<fis::Tsukamoto, 1, 1, tsukamotoSpec::rules,
+                     fis::sets<fis::trimf, fis::trimf>,
+                     fis::sets<fis::tsigmf, fis::tsigmf>> fixedTsuka;
+    const real_t levelPoints[ 2 ][ 3 ] = { { -2.0f, 0.0f, 2.0f }, { 0.0f, 2.0f, 4.0f } };
+    const real_t valvePoints[ 2 ][ 2 ] = { { 1.0f, 5.0f }, { 2.0f, 5.0f } };
+    mismatches = tsuka.setup( fis::Tsukamoto, tsukaIn, tsukaOut, tsukaInMF, tsukaOutMF, tsukamotoSpec::rules, tsukaW ) ? 0U : 1U;
+    tsuka.setupInput( tsukamotoSpec::level, 0.0f, 2.0f );
+    tsuka.setupOutput( tsukamotoSpec::valve, 0.0f, 10.0f );
+    fixedTsuka.setupInput( tsukamotoSpec::level, 0.0f, 2.0f );
+    fixedTsuka.setupOutput( tsukamotoSpec::valve, 0.0f, 10.0f );
+    for ( fis::tag m = 0; m < 2; ++m ) {
+        tsuka.setupInputMF( tsukamotoSpec::level, m, fis::trimf, levelPoints[ m ] );
+        tsuka.setupOutputMF( tsukamotoSpec::valve, m, fis::tsigmf, valvePoints[ m ] );
+        mismatches += fixedTsuka.setupInputMF( tsukamotoSpec::level, m, levelPoints[ m ] ) ? 0U : 1U;
+        mismatches += fixedTsuka.setupOutputMF( m, valvePoints[ m ] ) ? 0U : 1U;
+    }
+    for ( int i = 0; i < 3; ++i ) {
+        const real_t level = 0.5f*static_cast<real_t>( i );
+        real_t valve = 0.0f;
+        mismatches += fixedTsuka.evaluate( &level, &valve ) ? 0U : 1U;
+        tsuka.setInput( tsukamotoSpec::level, level );
+        tsuka.fuzzify();
+        if ( tsuka.inference() ) {
+            tsuka.deFuzzify();
+        }
+        if ( ( valve < tsuka[ tsukamotoSpec::valve ] ) || ( valve > tsuka[ tsukamotoSpec::valve ] ) ) {
+            ++mismatches;
+        }
+    }
+    cout << "tsukamoto fixed system mismatches: " << mismatches << endl;
+
+    real_t trainIn[ 64 ][ 2 ], trainOut[ 64 ][ 2 ];
+    for ( int i = 0; i < 64; ++i ) {
+        const real_t x1 = 0.5f + 3.0f*( static_cast<real_t>( i % 8 ) + 0.5f )/8.0f;
+        const real_t x2 = -1.0f + 5.0f*( static_cast<real_t>( i / 8 ) + 0.5f )/8.0f;
+        trainIn[ i ][ 0 ] = x1;
+        trainIn[ i ][ 1 ] = x2;
+        trainOut[ i ][ 0 ] = 0.3f + 0.03f*x1*x2 + 0.05f*x1;
+        trainOut[ i ][ 1 ] = 0.5f + 0.2f*sin( x1 )*cos( 0.5f*x2 );
+    }
+    real_t trainArea[ 256 ], accArea[ 256 ], ref[ 64 ][ 2 ], now[ 64 ][ 2 ];
+    fis::trainer t;
+    const real_t before = takajiSpec::fitError( takaji, trainIn, trainOut );
+    mismatches = ( ( takaji.getTrainingSize() <= 256U ) && ( takaji.getAccumulatorSize() <= 256U ) ) ? 0U : 1U;
+    mismatches += ( t.setup( trainArea, 0.05f ) && ctx.setupTraining( accArea ) ) ? 0U : 1U;
+    mismatches += takaji.evaluateBatch( ctx, &trainIn[ 0 ][ 0 ], &ref[ 0 ][ 0 ], 64U ) ? 0U : 1U;
+    for ( int epoch = 0; epoch < 30; ++epoch ) {
+        for ( int b = 0; b < 64; b += 16 ) {
+            mismatches += takaji.train( t, ctx, trainIn[ b ], trainOut[ b ], 16U ) ? 0U : 1U;
+        }
+    }
+    /*the instance keeps its own parameters until they are applied*/
+    mismatches += takaji.evaluateBatch( ctx, &trainIn[ 0 ][ 0 ], &now[ 0 ][ 0 ], 64U ) ? 0U : 1U;
+    for ( int i = 0; i < 64; ++i ) {
+        mismatches += ( ( ref[ i ][ 0 ] < now[ i ][ 0 ] ) || ( ref[ i ][ 0 ] > now[ i ][ 0 ] ) ||
+                        ( ref[ i ][ 1 ] < now[ i ][ 1 ] ) || ( ref[ i ][ 1 ] > now[ i ][ 1 ] ) ) ? 1U : 0U;
+    }
+
+    /*two contexts reduced together take the same step of one context*/
+    fis::trainer single, split;
+    fis::context half[ 2 ];
+    fis::input halfIn[ 2 ][ 2 ];
+    fis::output halfOut[ 2 ][ 2 ];
+    real_t halfFx[ 2 ][ 4 ], halfW[ 2 ][ 4 ], halfAcc[ 2 ][ 256 ], singleArea[ 256 ], splitArea[ 256 ];
+    mismatches += ( single.setup( singleArea, 0.05f ) && split.setup( splitArea, 0.05f ) ) ? 0U : 1U;
+    for ( int i = 0; i < 2; ++i ) {
+        mismatches += ( half[ i ].setup( halfIn[ i ], halfOut[ i ], halfFx[ i ], halfW[ i ] ) && half[ i ].setupTraining( halfAcc[ i ] ) ) ? 0U : 1U;
+    }
+    for ( int b = 0; b < 64; b += 16 ) {
+        mismatches += takaji.train( single, ctx, trainIn[ b ], trainOut[ b ], 16U ) ? 0U : 1U;
+        mismatches += takaji.trainAccumulate( split, half[ 0 ], trainIn[ b ], trainOut[ b ], 8U ) ? 0U : 1U;
+        mismatches += takaji.trainAccumulate( split, half[ 1 ], trainIn[ b + 8 ], trainOut[ b + 8 ], 8U ) ? 0U : 1U;
+        mismatches += takaji.trainReduce( split, half, 2U ) ? 0U : 1U;
+    }
+    for ( size_t i = 0U ; i < 12U ; ++i ) {
+        mismatches += ( fabs( single.getParameters()[ i ] - split.getParameters()[ i ] ) > 1.0e-5f ) ? 1U : 0U;
+    }
+    mismatches += ( fabs( single.getError() - split.getError() ) > 1.0e-6f ) ? 1U : 0U;
+    /*the coefficients only differ by the rounding of the solver*/
+    mismatches += ( takaji.applyTraining( single ) && takaji.evaluateBatch( ctx, &trainIn[ 0 ][ 0 ], &ref[ 0 ][ 0 ], 64U ) ) ? 0U : 1U;
+    mismatches += ( takaji.applyTraining( split ) && takaji.evaluateBatch( ctx, &trainIn[ 0 ][ 0 ], &now[ 0 ][ 0 ], 64U ) ) ? 0U : 1U;
+    for ( int i = 0; i < 64; ++i ) {
+        mismatches += ( ( fabs( ref[ i ][ 0 ] - now[ i ][ 0 ] ) > 1.0e-3f ) || ( fabs( ref[ i ][ 1 ] - now[ i ][ 1 ] ) > 1.0e-3f ) ) ? 1U : 0U;
+    }
+
+    mismatches += takaji.applyTraining( t ) ? 0U : 1U;
+    /*the fit should be at least ten times better than the initial one*/
+    if ( takajiSpec::fitError( takaji, trainIn, trainOut ) > 0.1f*before ) {
+        ++mismatches;
+    }
+    cout << "training mismatches: " << mismatches << endl;
+
+    /*the analytic gradient follows the central differences of the error*/
+    fis::instance grad;
+    fis::input gradIn[ 2 ];
+    fis::output gradOut[ 1 ];
+    fis::mf gradInMF[ 16 ], gradOutMF[ 8 ];
+    fis::ruleTerm gradProgram[ 24 ];
+    fis::context gradCtx;
+    fis::input gradCtxIn[ 2 ];
+    fis::output gradCtxOut[ 1 ];
+    fis::trainer gradTrainer;
+    real_t gradW[ 8 ], gradFx[ 16 ], gradCtxW[ 8 ], gradAcc[ 256 ], gradArea[ 256 ];
+    real_t gradPoints[ 16 ][ 4 ] = {
+        { 2.0f, 5.0f }, { 2.0f, 2.5f, 4.0f }, { 1.5f, 5.0f }, { 1.0f, 3.0f, 6.0f, 9.0f },
+        { 0.5f, 5.0f, 9.5f }, { 8.0f, 5.2f }, { 5.0f, 9.0f }, { 1.0f, 8.0f },
+        { 1.0f, 9.0f }, { 2.0f, 8.5f }, { 0.5f, 4.0f, 6.0f, 9.5f }, { 1.5f, 4.0f, 2.0f, 6.0f },
+        { 2.0f, 3.0f, 1.0f, 7.0f }, { 1.5f, 2.0f, -1.0f, 8.0f }, { 1.0f, 9.0f }, { 1.0f, 9.0f }
+    };
+    const fis::shapeMF gradShapes[ 16 ] = {
+        fis::gaussmf, fis::gbellmf, fis::sigmf, fis::trapmf, fis::trimf, fis::spikemf, fis::cosmf, fis::concavemf,
+        fis::smf, fis::zmf, fis::pimf, fis::gauss2mf, fis::dsigmf, fis::psigmf, fis::linsmf, fis::linzmf
+    };
+    const size_t gradCount[ 16 ] = { 2U, 3U, 2U, 4U, 3U, 2U, 2U, 2U, 2U, 2U, 4U, 4U, 4U, 4U, 2U, 2U };
+    real_t gradConst[ 8 ][ 1 ], gradSamples[ 13 ][ 2 ], gradTargets[ 13 ];
+    mismatches = grad.setup( fis::Sugeno, gradIn, gradOut, gradInMF, gradOutMF, gradSpec::rules, gradW ) ? 0U : 1U;
+    mismatches += grad.setParameter( fis::FIS_AND, fis::FIS_PROD ) ? 0U : 1U;
+    mismatches += ( grad.setupInput( gradSpec::x1, 0.0f, 10.0f ) && grad.setupInput( gradSpec::x2, 0.0f, 10.0f ) ) ? 0U : 1U;
+    mismatches += grad.setupOutput( gradSpec::y, 0.0f, 1.0f ) ? 0U : 1U;
+    for ( fis::tag m = 0; m < 16; ++m ) {
+        mismatches += grad.setupInputMF( ( m < 8 ) ? gradSpec::x1 : gradSpec::x2, m, gradShapes[ m ], gradPoints[ m ] ) ? 0U : 1U;
+    }
+    for ( fis::tag m = 0; m < 8; ++m ) {
+        gradConst[ m ][ 0 ] = 0.1f + 0.1f*static_cast<real_t>( m );
+        mismatches += grad.setupOutputMF( gradSpec::y, m, fis::constantmf, gradConst[ m ] ) ? 0U : 1U;
+    }
+    for ( int i = 0; i < 13; ++i ) {
+        gradSamples[ i ][ 0 ] = 0.35f + 0.77f*static_cast<real_t>( i );
+        gradSamples[ i ][ 1 ] = 0.2f + 0.73f*static_cast<real_t>( ( i*5 ) % 13 );
+        gradTargets[ i ] = 0.2f + 0.05f*gradSamples[ i ][ 0 ] + 0.02f*gradSamples[ i ][ 1 ];
+    }
+    mismatches += ( grad.compileRules( gradProgram ) && gradCtx.setup( gradCtxIn, gradCtxOut, gradFx, gradCtxW ) ) ? 0U : 1U;
+    mismatches += ( ( grad.getAccumulatorSize() <= 256U ) && gradCtx.setupTraining( gradAcc ) ) ? 0U : 1U;
+    mismatches += ( ( grad.getTrainingSize() <= 256U ) && gradTrainer.setup( gradArea, 1.0e-6f ) ) ? 0U : 1U;
+    mismatches += grad.train( gradTrainer, gradCtx, gradSamples[ 0 ], gradTargets, 13U ) ? 0U : 1U;
+    for ( size_t m = 0U, k = 0U ; ( m < 16U ) && ( nullptr != gradTrainer.getGradient() ) ; ++m ) {
+        for ( size_t j = 0U ; j < gradCount[ m ] ; ++j, ++k ) {
+            const real_t v = gradPoints[ m ][ j ];
+            const real_t h = 1.0e-3f;
+            real_t fd;
+
+            gradPoints[ m ][ j ] = v + h;
+            fd = gradSpec::loss( grad, gradSamples, gradTargets );
+            gradPoints[ m ][ j ] = v - h;
+            fd -= gradSpec::loss( grad, gradSamples, gradTargets );
+            gradPoints[ m ][ j ] = v;
+            fd /= 2.0f*h;
+            mismatches += ( fabs( fd - gradTrainer.getGradient()[ k ] ) > ( 1.0e-5f + ( 0.05f*fabs( fd ) ) ) ) ? 1U : 0U;
+        }
+    }
+    mismatches += ( nullptr != gradTrainer.getGradient() ) ? 0U : 1U;
+    cout << "training gradient mismatches: " << mismatches << endl;
+
+    /*a large step keeps the points of the sets in order and the outputs defined*/
+    real_t largeArea[ 256 ];
+    real_t largeOut[ 64 ][ 2 ];
+    fis::trainer large;
+    mismatches = large.setup( largeArea, 5000.0f ) ? 0U : 1U;
+    for ( int epoch = 0; epoch < 10; ++epoch ) {
+        for ( int b = 0; b < 64; b += 16 ) {
+            mismatches += takaji.train( large, ctx, trainIn[ b ], trainOut[ b ], 16U ) ? 0U : 1U;
+        }
+    }
+    for ( size_t i = 0U ; i < 12U ; i += 3U ) {
+        const real_t * const p = &large.getParameters()[ i ];
+        mismatches += ( ( p[ 0 ] > p[ 1 ] ) || ( p[ 1 ] > p[ 2 ] ) ) ? 1U : 0U;
+    }
+    mismatches += takaji.applyTraining( large ) ? 0U : 1U;
+    mismatches += takaji.evaluateBatch( &trainIn[ 0 ][ 0 ], &largeOut[ 0 ][ 0 ], 64U ) ? 0U : 1U;
+    for ( int i = 0; i < 64; ++i ) {
+        mismatches += ( ffmath::isNan( largeOut[ i ][ 0 ] ) || ffmath::isNan( largeOut[ i ][ 1 ] ) ) ? 1U : 0U;
+    }
+    /*a trainer tied to an instance can not take the sets of another one*/
+    fis::ruleTerm tsukaProgram[ 4 ];
+    fis::context tsukaCtx;
+    fis::input tsukaCtxIn[ 1 ];
+    fis::output tsukaCtxOut[ 1 ];
+    real_t tsukaArea[ 32 ], tsukaAcc[ 32 ], tsukaFx[ 2 ], tsukaCtxW[ 2 ];
+    fis::trainer tsukaTrainer;
+    const real_t tsukaSample[ 2 ] = { 0.5f, 5.0f };
+    mismatches += ( tsuka.compileRules( tsukaProgram ) && tsukaTrainer.setup( tsukaArea ) ) ? 0U : 1U;
+    mismatches += ( tsukaCtx.setup( tsukaCtxIn, tsukaCtxOut, tsukaFx, tsukaCtxW ) && tsukaCtx.setupTraining( tsukaAcc ) ) ? 0U : 1U;
+    mismatches += tsuka.train( large, tsukaCtx, &tsukaSample[ 0 ], &tsukaSample[ 1 ], 1U ) ? 1U : 0U;
+    mismatches += tsuka.train( tsukaTrainer, tsukaCtx, &tsukaSample[ 0 ], &tsukaSample[ 1 ], 1U ) ? 0U : 1U;
+    cout << "large step training mismatches: " << mismatches << endl;
 }
 
 void test_tdl( void )
@@ -90,6 +411,84 @@ void test_tdl( void )
     cout << delayLine[ 100 ] << endl;
 }
 
+namespace flexnavSpec {
+    enum : fis::tag { wt, dax, day, ae };
+    enum : fis::tag { phit, thetat };
+    enum : fis::tag { wtSLOW, wtMED, wtFAST, daxLOW, daxMED, daxHIGH, dayLOW, dayMED, dayHIGH, aeLOW, aeMED, aeHIGH };
+    enum : fis::tag { phitGYRO, phitBOTH, phitACCEL, thetatGYRO, thetatBOTH, thetatACCEL };
+
+    constexpr fis::rules rules[] = {
+        FIS_RULES_BEGIN
+            IF wt IS_NOT wtSLOW THEN phit IS phitGYRO AND thetat IS thetatGYRO END
+            IF dax IS daxHIGH THEN thetat IS thetatGYRO END
+            IF day IS dayHIGH THEN thetat IS thetatGYRO END
+            IF ae IS aeHIGH THEN phit IS phitGYRO AND thetat IS thetatGYRO END
+            IF wt IS wtSLOW AND dax IS daxLOW AND ae IS aeLOW THEN phit IS phitACCEL END
+            IF wt IS wtSLOW AND day IS dayLOW AND ae IS aeLOW THEN thetat IS thetatACCEL END
+            IF wt IS wtSLOW AND dax IS daxLOW AND ae IS aeMED THEN phit IS phitBOTH END
+            IF wt IS wtSLOW AND day IS dayLOW AND ae IS aeMED THEN thetat IS thetatBOTH END
+            IF wt IS wtSLOW AND dax IS daxMED AND ae IS aeLOW THEN phit IS phitBOTH END
+            IF wt IS wtSLOW AND day IS dayMED AND ae IS aeLOW THEN thetat IS thetatBOTH END
+            IF wt IS wtMED AND dax IS daxLOW AND ae IS aeLOW THEN phit IS phitBOTH END
+            IF wt IS wtMED AND day IS dayLOW AND ae IS aeLOW THEN thetat IS thetatBOTH END
+            IF wt IS wtMED AND dax IS_NOT daxLOW THEN phit IS phitGYRO END
+            IF wt IS wtMED AND day IS_NOT dayLOW THEN thetat IS thetatGYRO END
+            IF wt IS wtMED AND ae IS_NOT aeLOW THEN phit IS phitGYRO AND thetat IS thetatGYRO END
+        FIS_RULES_END
+    };
+    /*three sets for each input and output, in the order of their tags*/
+    const real_t inPoints[ 12 ][ 3 ] = {
+        { -0.2f, 0.0f, 0.2f }, { 0.1f, 0.25f, 0.4f }, { 0.3f, 0.5f, 0.7f },
+        { -1.0f, 0.0f, 2.0f }, { 1.0f, 2.5f, 4.0f }, { 3.0f, 5.0f, 7.0f },
+        { -2.0f, 0.0f, 2.0f }, { 1.0f, 2.5f, 4.0f }, { 3.0f, 5.0f, 7.0f },
+        { -8.0f, 0.0f, 8.0f }, { 5.0f, 10.0f, 15.0f }, { 12.0f, 20.0f, 28.0f }
+    };
+    const real_t outPoints[ 6 ][ 3 ] = {
+        { -0.4f, 0.0f, 0.4f }, { 0.2f, 0.5f, 0.8f }, { 0.6f, 1.0f, 1.4f },
+        { -0.4f, 0.0f, 0.4f }, { 0.2f, 0.5f, 0.8f }, { 0.6f, 1.0f, 1.4f }
+    };
+
+    template <fis::paramValue implication, fis::paramValue aggregation, fis::deFuzzMethod method = fis::centroid>
+    size_t fixedMismatches( const real_t (&ref)[ 2 ][ 16 ],
+                            const real_t (&in)[ 16 ][ 4 ],
+                            const real_t *weights = nullptr )
+    {
+        fis::fixedSystem<fis::Mamdani, 4, 2, rules,
+                         fis::sets<fis::trimf, fis::trimf, fis::trimf, fis::trimf, fis::trimf, fis::trimf,
+                                   fis::trimf, fis::trimf, fis::trimf, fis::trimf, fis::trimf, fis::trimf>,
+                         fis::sets<fis::trimf, fis::trimf, fis::trimf, fis::trimf, fis::trimf, fis::trimf>,
+                         fis::operators<fis::FIS_MIN, fis::FIS_MAX, implication, aggregation>, method> fixedFlexnav;
+        size_t mismatches = 0U;
+
+        if ( nullptr != weights ) {
+            mismatches += fixedFlexnav.setRuleWeights( weights ) ? 0U : 1U;
+        }
+
+        fixedFlexnav.setupInput( wt, 0.0f, 0.5f );
+        fixedFlexnav.setupInput( dax, 0.0f, 5.0f );
+        fixedFlexnav.setupInput( day, 0.0f, 5.0f );
+        fixedFlexnav.setupInput( ae, 0.0f, 20.0f );
+        fixedFlexnav.setupOutput( phit, 0.0f, 1.0f );
+        fixedFlexnav.setupOutput( thetat, 0.0f, 1.0f );
+        for ( fis::tag m = 0; m < 12; ++m ) {
+            mismatches += fixedFlexnav.setupInputMF( static_cast<fis::tag>( m/3 ), m, inPoints[ m ] ) ? 0U : 1U;
+        }
+        for ( fis::tag m = 0; m < 6; ++m ) {
+            mismatches += fixedFlexnav.setupOutputMF( m, outPoints[ m ] ) ? 0U : 1U;
+        }
+        for ( int i = 0; i < 16; ++i ) {
+            real_t y[ 2 ];
+            mismatches += fixedFlexnav.evaluate( in[ i ], y ) ? 0U : 1U;
+            if ( ( ref[ 0 ][ i ] < y[ phit ] ) || ( ref[ 0 ][ i ] > y[ phit ] ) ||
+                 ( ref[ 1 ][ i ] < y[ thetat ] ) || ( ref[ 1 ][ i ] > y[ thetat ] ) ) {
+                ++mismatches;
+            }
+        }
+
+        return mismatches;
+    }
+}
+
 void test_fis2( void )
 {
     cout << "FIS2 TEST"<< endl;
@@ -154,6 +553,201 @@ void test_fis2( void )
     }
     cout << "phit = " << flexnav[ phit ] << " thetat = " << flexnav[ thetat ] << endl;
 
+    fis::ruleTerm program[ 52 ];
+    const fis::paramValue ops[ 3 ][ 2 ] = { { fis::FIS_MIN, fis::FIS_MAX }, { fis::FIS_PROD, fis::FIS_SUM }, { fis::FIS_PROD, fis::FIS_PROBOR } };
+    real_t ref[ 3 ][ 2 ][ 16 ];
+    size_t mismatches = 0U;
+    for ( int pass = 0; pass < 2; ++pass ) {
+        if ( 1 == pass ) {
+            mismatches += flexnav.compileRules( program ) ? 0U : 1U;
+        }
+        for ( int c = 0; c < 3; ++c ) {
+            flexnav.setParameter( fis::FIS_Implication, ops[ c ][ 0 ] );
+            flexnav.setParameter( fis::FIS_Aggregation, ops[ c ][ 1 ] );
+            for ( int i = 0; i < 16; ++i ) {
+                flexnav.setInput( wt, 0.03f*static_cast<real_t>( i ) );
+                flexnav.setInput( dax, 0.3f*static_cast<real_t>( i ) );
+                flexnav.setInput( day, 5.0f - 0.3f*static_cast<real_t>( i ) );
+                flexnav.setInput( ae, 1.2f*static_cast<real_t>( i ) );
+                flexnav.fuzzify();
+                if ( flexnav.inference() ) {
+                    flexnav.deFuzzify();
+                }
+                if ( 0 == pass ) {
+                    ref[ c ][ 0 ][ i ] = flexnav[ phit ];
+                    ref[ c ][ 1 ][ i ] = flexnav[ thetat ];
+                }
+                else if ( ( ref[ c ][ 0 ][ i ] < flexnav[ phit ] ) || ( ref[ c ][ 0 ][ i ] > flexnav[ phit ] ) ||
+                          ( ref[ c ][ 1 ][ i ] < flexnav[ thetat ] ) || ( ref[ c ][ 1 ][ i ] > flexnav[ thetat ] ) ) {
+                    ++mismatches;
+                }
+            }
+        }
+    }
+    flexnav.setParameter( fis::FIS_Implication, fis::FIS_MIN );
+    flexnav.setParameter( fis::FIS_Aggregation, fis::FIS_MAX );
+    cout << "rules mismatches: " << mismatches << endl;
+
+    real_t batchIn[ 16 ][ 4 ], batchOut[ 16 ][ 2 ];
+    for ( int i = 0; i < 16; ++i ) {
+        batchIn[ i ][ wt ] = 0.03f*static_cast<real_t>( i );
+        batchIn[ i ][ dax ] = 0.3f*static_cast<real_t>( i );
+        batchIn[ i ][ day ] = 5.0f - 0.3f*static_cast<real_t>( i );
+        batchIn[ i ][ ae ] = 1.2f*static_cast<real_t>( i );
+    }
+    mismatches = flexnav.evaluateBatch( &batchIn[ 0 ][ 0 ], &batchOut[ 0 ][ 0 ], 16U ) ? 0U : 1U;
+    for ( int i = 0; i < 16; ++i ) {
+        if ( ( ref[ 0 ][ 0 ][ i ] < batchOut[ i ][ phit ] ) || ( ref[ 0 ][ 0 ][ i ] > batchOut[ i ][ phit ] ) ||
+             ( ref[ 0 ][ 1 ][ i ] < batchOut[ i ][ thetat ] ) || ( ref[ 0 ][ 1 ][ i ] > batchOut[ i ][ thetat ] ) ) {
+            ++mismatches;
+        }
+    }
+    cout << "fis batch mismatches: " << mismatches << endl;
+
+    size_t activeSet[ 3*15 + 12 + 34 + 2 ];
+    mismatches = flexnav.setActiveSet( activeSet ) ? 0U : 1U;
+    for ( int c = 0; c < 3; ++c ) {
+        flexnav.setParameter( fis::FIS_Implication, ops[ c ][ 0 ] );
+        flexnav.setParameter( fis::FIS_Aggregation, ops[ c ][ 1 ] );
+        (void)flexnav.evaluateBatch( &batchIn[ 0 ][ 0 ], &batchOut[ 0 ][ 0 ], 16U );
+        for ( int i = 0; i < 16; ++i ) {
+            if ( ( ref[ c ][ 0 ][ i ] < batchOut[ i ][ phit ] ) || ( ref[ c ][ 0 ][ i ] > batchOut[ i ][ phit ] ) ||
+                 ( ref[ c ][ 1 ][ i ] < batchOut[ i ][ thetat ] ) || ( ref[ c ][ 1 ][ i ] > batchOut[ i ][ thetat ] ) ) {
+                ++mismatches;
+            }
+        }
+    }
+    flexnav.setParameter( fis::FIS_Implication, fis::FIS_MIN );
+    flexnav.setParameter( fis::FIS_Aggregation, fis::FIS_MAX );
+    cout << "active set mismatches: " << mismatches << endl;
+
+    fis::context ctx;
+    fis::input ctxIn[ 4 ];
+    fis::output ctxOut[ 2 ];
+    real_t ctxFx[ 12 ], ctxW[ 15 ];
+    mismatches = ctx.setup( ctxIn, ctxOut, ctxFx, ctxW ) ? 0U : 1U;
+    for ( int c = 0; c < 3; ++c ) {
+        flexnav.setParameter( fis::FIS_Implication, ops[ c ][ 0 ] );
+        flexnav.setParameter( fis::FIS_Aggregation, ops[ c ][ 1 ] );
+        mismatches += flexnav.evaluateBatch( ctx, &batchIn[ 0 ][ 0 ], &batchOut[ 0 ][ 0 ], 16U ) ? 0U : 1U;
+        for ( int i = 0; i < 16; ++i ) {
+            if ( ( ref[ c ][ 0 ][ i ] < batchOut[ i ][ phit ] ) || ( ref[ c ][ 0 ][ i ] > batchOut[ i ][ phit ] ) ||
+                 ( ref[ c ][ 1 ][ i ] < batchOut[ i ][ thetat ] ) || ( ref[ c ][ 1 ][ i ] > batchOut[ i ][ thetat ] ) ) {
+                ++mismatches;
+            }
+        }
+    }
+    flexnav.setParameter( fis::FIS_Implication, fis::FIS_MIN );
+    flexnav.setParameter( fis::FIS_Aggregation, fis::FIS_MAX );
+    flexnav.setDeFuzzMethod( fis::bisector );
+    for ( int i = 0; i < 16; ++i ) {
+        real_t y[ 2 ];
+        (void)flexnav.evaluate( ctx, batchIn[ i ], y );
+        flexnav.setInput( wt, batchIn[ i ][ wt ] );
+        flexnav.setInput( dax, batchIn[ i ][ dax ] );
+        flexnav.setInput( day, batchIn[ i ][ day ] );
+        flexnav.setInput( ae, batchIn[ i ][ ae ] );
+        flexnav.fuzzify();
+        if ( flexnav.inference() ) {
+            flexnav.deFuzzify();
+        }
+        if ( ( y[ 0 ] < flexnav[ phit ] ) || ( y[ 0 ] > flexnav[ phit ] ) ||
+             ( y[ 1 ] < flexnav[ thetat ] ) || ( y[ 1 ] > flexnav[ thetat ] ) ) {
+            ++mismatches;
+        }
+    }
+    flexnav.setDeFuzzMethod( fis::centroid );
+    cout << "context mismatches: " << mismatches << endl;
+
+    fis::context wide, part[ 3 ];
+    fis::input partIn[ 3 ][ 4 ];
+    fis::output wideOut[ 2 ], partOut[ 3 ][ 2 ];
+    real_t wideFx[ 12*5 ], wideW[ 15*5 ], partFx[ 3 ][ 12*2 ], partW[ 3 ][ 15*2 ];
+    mismatches = wide.setup( ctxIn, wideOut, wideFx, wideW ) ? 0U : 1U;
+    for ( int p = 0; p < 3; ++p ) {
+        mismatches += part[ p ].setup( partIn[ p ], partOut[ p ], partFx[ p ], partW[ p ] ) ? 0U : 1U;
+    }
+    for ( int c = 0; c < 3; ++c ) {
+        real_t partY[ 16 ][ 2 ];
+        flexnav.setParameter( fis::FIS_Implication, ops[ c ][ 0 ] );
+        flexnav.setParameter( fis::FIS_Aggregation, ops[ c ][ 1 ] );
+        mismatches += flexnav.evaluateBatch( wide, &batchIn[ 0 ][ 0 ], &batchOut[ 0 ][ 0 ], 16U ) ? 0U : 1U;
+        for ( size_t p = 0U; p < 3U; ++p ) {
+            mismatches += flexnav.evaluateBatch( part[ p ], &batchIn[ 0 ][ 0 ], &partY[ 0 ][ 0 ], 16U, p, 3U ) ? 0U : 1U;
+        }
+        for ( int i = 0; i < 16; ++i ) {
+            for ( int j = 0; j < 2; ++j ) {
+                if ( ( ref[ c ][ j ][ i ] < batchOut[ i ][ j ] ) || ( ref[ c ][ j ][ i ] > batchOut[ i ][ j ] ) ||
+                     ( ref[ c ][ j ][ i ] < partY[ i ][ j ] ) || ( ref[ c ][ j ][ i ] > partY[ i ][ j ] ) ) {
+                    ++mismatches;
+                }
+            }
+        }
+    }
+    mismatches += flexnav.evaluateBatch( wide, &batchIn[ 0 ][ 0 ], &batchOut[ 0 ][ 0 ], 16U, 3U, 3U ) ? 1U : 0U;
+    flexnav.setParameter( fis::FIS_Implication, fis::FIS_MIN );
+    flexnav.setParameter( fis::FIS_Aggregation, fis::FIS_MAX );
+    cout << "batch block mismatches: " << mismatches << endl;
+
+    mismatches = 0U;
+    for ( int m = fis::centroid; m <= fis::som; ++m ) {
+        flexnav.setDeFuzzMethod( static_cast<fis::deFuzzMethod>( m ) );
+        for ( int i = 0; i < 16; ++i ) {
+            flexnav.setInput( wt, 0.03f*static_cast<real_t>( i ) );
+            flexnav.setInput( dax, 0.3f*static_cast<real_t>( i ) );
+            flexnav.setInput( day, 5.0f - 0.3f*static_cast<real_t>( i ) );
+            flexnav.setInput( ae, 1.2f*static_cast<real_t>( i ) );
+            flexnav.fuzzify();
+            flexnav.inference();
+            flexnav.setAnalyticDeFuzz( false );
+            flexnav.deFuzzify();
+            const real_t sampled[ 2 ] = { flexnav[ phit ], flexnav[ thetat ] };
+            flexnav.setAnalyticDeFuzz( true );
+            flexnav.deFuzzify();
+            /*the sampled result is within one point of the exact one*/
+            if ( ( fabs( sampled[ 0 ] - flexnav[ phit ] ) > 0.01f ) || ( fabs( sampled[ 1 ] - flexnav[ thetat ] ) > 0.01f ) ) {
+                ++mismatches;
+            }
+        }
+    }
+    flexnav.setAnalyticDeFuzz( false );
+    flexnav.setDeFuzzMethod( fis::centroid );
+    cout << "analytic mismatches: " << mismatches << endl;
+
+    mismatches = flexnavSpec::fixedMismatches<fis::FIS_MIN, fis::FIS_MAX>( ref[ 0 ], batchIn );
+    mismatches += flexnavSpec::fixedMismatches<fis::FIS_PROD, fis::FIS_SUM>( ref[ 1 ], batchIn );
+    mismatches += flexnavSpec::fixedMismatches<fis::FIS_PROD, fis::FIS_PROBOR>( ref[ 2 ], batchIn );
+
+    /*the other methods and the rule weights give the same of the instance*/
+    real_t methodRef[ 5 ][ 2 ][ 16 ];
+    real_t weights[ 15 ];
+    for ( int r = 0; r < 15; ++r ) {
+        weights[ r ] = 1.0f - 0.06f*static_cast<real_t>( r );
+    }
+    for ( int m = fis::centroid; m <= fis::som; ++m ) {
+        flexnav.setDeFuzzMethod( static_cast<fis::deFuzzMethod>( m ) );
+        if ( fis::centroid == m ) {
+            flexnav.setRuleWeights( weights );
+        }
+        (void)flexnav.evaluateBatch( &batchIn[ 0 ][ 0 ], &batchOut[ 0 ][ 0 ], 16U );
+        for ( int i = 0; i < 16; ++i ) {
+            methodRef[ m ][ 0 ][ i ] = batchOut[ i ][ phit ];
+            methodRef[ m ][ 1 ][ i ] = batchOut[ i ][ thetat ];
+        }
+        for ( int r = 0; ( fis::centroid == m ) && ( r < 15 ); ++r ) {
+            weights[ r ] = 1.0f;
+        }
+    }
+    flexnav.setDeFuzzMethod( fis::centroid );
+    for ( int r = 0; r < 15; ++r ) {
+        weights[ r ] = 1.0f - 0.06f*static_cast<real_t>( r );
+    }
+    mismatches += flexnavSpec::fixedMismatches<fis::FIS_MIN, fis::FIS_MAX>( methodRef[ fis::centroid ], batchIn, weights );
+    mismatches += flexnavSpec::fixedMismatches<fis::FIS_MIN, fis::FIS_MAX, fis::bisector>( methodRef[ fis::bisector ], batchIn );
+    mismatches += flexnavSpec::fixedMismatches<fis::FIS_MIN, fis::FIS_MAX, fis::mom>( methodRef[ fis::mom ], batchIn );
+    mismatches += flexnavSpec::fixedMismatches<fis::FIS_MIN, fis::FIS_MAX, fis::lom>( methodRef[ fis::lom ], batchIn );
+    mismatches += flexnavSpec::fixedMismatches<fis::FIS_MIN, fis::FIS_MAX, fis::som>( methodRef[ fis::som ], batchIn );
+    cout << "fixed system mismatches: " << mismatches << endl;
 }
 
 void test_fis( void )
@@ -206,6 +800,51 @@ void test_fis( void )
         tipper.deFuzzify();
     }
     cout << "tip_out = " << tipper[ tip ] << endl;
+
+    real_t exact[ 11 ], tabulated[ 11 ];
+    real_t mfTable[ 3 ][ 64 ];
+    size_t mismatches = 0U;
+    for ( int pass = 0; pass < 2; ++pass ) {
+        if ( 1 == pass ) {
+            for ( fis::tag k = poor; k <= excellent; ++k ) {
+                mismatches += tipper.tabulateInputMF( k, mfTable[ k ], 1.0e-4f ) ? 0U : 1U;
+            }
+        }
+        for ( int i = 0; i < 11; ++i ) {
+            tipper << service << 0.1f*static_cast<real_t>( i ) << food << 9;
+            tipper.fuzzify();
+            if ( tipper.inference() ) {
+                tipper.deFuzzify();
+            }
+            if ( 0 == pass ) {
+                exact[ i ] = tipper[ tip ];
+            }
+            else if ( fabs( exact[ i ] - tipper[ tip ] ) > 0.01f ) {
+                ++mismatches;
+            }
+            tabulated[ i ] = tipper[ tip ];
+        }
+    }
+    /*the compiled batch reads the tables over the whole block*/
+    fis::ruleTerm tipperProgram[ 8 ];
+    real_t tipIn[ 11 ][ 2 ], tipOut[ 11 ][ 1 ];
+    for ( int i = 0; i < 11; ++i ) {
+        tipIn[ i ][ service ] = 0.1f*static_cast<real_t>( i );
+        tipIn[ i ][ food ] = 9.0f;
+    }
+    mismatches += tipper.compileRules( tipperProgram ) ? 0U : 1U;
+    mismatches += tipper.evaluateBatch( &tipIn[ 0 ][ 0 ], &tipOut[ 0 ][ 0 ], 11U ) ? 0U : 1U;
+    for ( int i = 0; i < 11; ++i ) {
+        if ( ( tabulated[ i ] < tipOut[ i ][ tip ] ) || ( tabulated[ i ] > tipOut[ i ][ tip ] ) ) {
+            ++mismatches;
+        }
+    }
+    /*a set narrower than the step would vanish between the samples*/
+    static const real_t narrowPoints[ 3 ] = { 2.1f, 2.2f, 2.3f };
+    real_t narrowTable[ 11 ];
+    tipper.setupInputMF( food, rancid, fis::trimf, narrowPoints );
+    mismatches += tipper.tabulateInputMF( rancid, narrowTable, 1.0e-4f ) ? 1U : 0U;
+    cout << "mf table mismatches: " << mismatches << endl;
 }
 
 void test_fp16( void )
@@ -257,6 +896,20 @@ void test_crc( void )
     cout << "CRC TEST"<< endl;
     auto res = crc::crc16_A( "hello world", 11 );
     cout << sizeof(crc) << " res = "<< res << endl;
+    auto res2 = crc::generic( CRC32, "123456789", 9, 0x04C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU );
+    auto res3 = crc::fast<CRC32, 0x04C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>( "123456789", 9 );
+    cout << hex << res2 << " " << res3 << dec << endl;
+    uint8_t block[ 1000 ];
+    for ( size_t i = 0U ; i < sizeof(block) ; ++i ) {
+        block[ i ] = static_cast<uint8_t>( i*37U + 11U );
+    }
+    cout << hex << crc::generic( CRC32, block, sizeof(block), 0x1EDC6F41U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU ) << " " << crc::crc32_C( block, sizeof(block) ) << endl;
+    cout << crc::generic( CRC16, block, sizeof(block), 0x1021U, 0xFFFFU ) << " " << crc::crc16_CCITT_FALSE( block, sizeof(block) ) << dec << endl;
+    crc32Context ctx;
+    ctx.update( block, 300U ).update( &block[ 300 ], 700U );
+    auto crcA = crc::crc32( block, 300U );
+    auto crcB = crc::crc32( &block[ 300 ], 700U );
+    cout << hex << crc::crc32( block, sizeof(block) ) << " " << ctx.finalize() << " " << crc32Context::combine( crcA, crcB, 700U ) << dec << endl;
 }
 
 void test_ltisys( void )
@@ -298,6 +951,23 @@ void test_ltisys( void )
 
     }
 
+    real_t numr[ 2 ][ 3 ] = { { 0.1f, 0.2f, 0.3f }, { 0.1f, 0.2f, 0.3f } };
+    real_t denr[ 2 ][ 3 ] = { { 1.0f, -0.85f, 0.02f }, { 1.0f, -0.85f, 0.02f } };
+    discreteStates<3> xs, xrs;
+    real_t ring[ 6 ];
+    discreteSystem gs( numr[ 0 ], denr[ 0 ], xs );
+    discreteSystem gr( numr[ 1 ], denr[ 1 ], xrs );
+    size_t mismatches = 0U;
+
+    for ( int i = 0; i < 20; i++ ) {
+        const real_t u = static_cast<real_t>( i % 3 );
+        if ( 5 == i ) {
+            (void)gr.setRingBuffer( ring );
+        }
+        const real_t r[ 2 ] = { gs.excite( u ), gr.excite( u ) };
+        mismatches += ( 0 != memcmp( &r[ 0 ], &r[ 1 ], sizeof(real_t) ) ) ? 1U : 0U;
+    }
+    cout << "ring mismatches: " << mismatches << endl;
 }
 
 void test_ffmath(void)
@@ -416,6 +1086,236 @@ void test_ffmath(void)
     std::cout << ffmath::copysign( 1.0f, -2.0f ) << std::endl;
     std::cout << ffmath::copysign( ffmath::getNan(), -2.0f ) << std::endl;
     std::cout << ffmath::copysign( ffmath::getInf(), -2.0f ) << std::endl;
+
+    #if defined( QLIBS_FFMATH_CONSTEXPR_BITCAST )
+        constexpr float sqrt5 = ffmath::sqrt( 5.0f );
+        static_assert( ffmath::isNan( ffmath::getNan() ), "constexpr classification" );
+        std::cout << "constexpr sqrt(5) = " << sqrt5 << std::endl;
+    #endif
+
+    std::cout << "batch" << std::endl;
+    float bx[ 19 ], by[ 19 ];
+    for ( size_t i = 0U ; i < 19U ; ++i ) {
+        bx[ i ] = -4.5f + 0.5f*static_cast<float>( i );
+    }
+    ffmath::exp( bx, by, 19U );
+    for ( size_t i = 0U ; i < 19U ; ++i ) {
+        std::cout << by[ i ] << " " << ffmath::exp( bx[ i ] ) << std::endl;
+    }
+
+    std::cout << "tiers" << std::endl;
+    std::cout << ffmath::fast::exp( 1.0f ) << " " << ffmath::exp( 1.0f ) << " " << ffmath::precise::exp( 1.0f ) << std::endl;
+    std::cout << ffmath::fast::sin( 1.0f ) << " " << ffmath::sin( 1.0f ) << " " << ffmath::precise::sin( 1.0f ) << std::endl;
+    std::cout << ffmath::fast::erf( 0.5f ) << " " << ffmath::precise::erf( 0.5f ) << std::endl;
+    std::cout << ffmath::precise::pow( -2.0f, 3.0f ) << " " << ffmath::precise::atan2( 1.0f, -1.0f ) << std::endl;
+
+    /*the fast tier should stay within the bounds listed in the documentation*/
+    struct fastBound {
+        float (*f)( float );
+        double (*ref)( double );
+        double a, b, bound;
+    };
+    static const fastBound fastBounds[] = {
+        { ffmath::fast::sin, []( double x ) { return std::sin( x ); }, -ffmath::FFP_PI, ffmath::FFP_PI, 5.8e-5 },
+        { ffmath::fast::cos, []( double x ) { return std::cos( x ); }, -ffmath::FFP_PI, ffmath::FFP_PI, 5.8e-5 },
+        { ffmath::fast::tan, []( double x ) { return std::tan( x ); }, -1.5, 1.5, 1.1e-5 },
+        { ffmath::fast::atan, []( double x ) { return std::atan( x ); }, -100.0, 100.0, 3.1e-5 },
+        { ffmath::fast::exp, []( double x ) { return std::exp( x ); }, -87.0, 88.0, 7.9e-5 },
+        { ffmath::fast::exp2, []( double x ) { return std::exp2( x ); }, -126.0, 127.0, 7.5e-5 },
+        { ffmath::fast::exp10, []( double x ) { return std::pow( 10.0, x ); }, -37.0, 38.0, 8.0e-5 },
+        { ffmath::fast::log, []( double x ) { return std::log( x ); }, 0.5, 2.0, 7.0e-5 },
+        { ffmath::fast::log2, []( double x ) { return std::log2( x ); }, 0.5, 2.0, 7.0e-5 },
+        { ffmath::fast::log10, []( double x ) { return std::log10( x ); }, 0.5, 2.0, 7.0e-5 },
+        { ffmath::fast::tanh, []( double x ) { return std::tanh( x ); }, -10.0, 10.0, 8.0e-5 },
+        { ffmath::fast::erf, []( double x ) { return std::erf( x ); }, -6.0, 6.0, 5.0e-5 },
+    };
+    size_t mismatches = 0U;
+    const size_t nSteps = 200000U;
+    for ( const fastBound& fb : fastBounds ) {
+        double maxErr = 0.0;
+        for ( size_t i = 0U ; i <= nSteps ; ++i ) {
+            const float x = static_cast<float>( fb.a + ( fb.b - fb.a )*static_cast<double>( i )/static_cast<double>( nSteps ) );
+            const double r = fb.ref( static_cast<double>( x ) );
+            if ( std::fabs( r ) > 0.0 ) {
+                maxErr = std::fmax( maxErr, std::fabs( static_cast<double>( fb.f( x ) ) - r )/std::fabs( r ) );
+            }
+        }
+        mismatches += ( maxErr <= fb.bound ) ? 0U : 1U;
+    }
+    const size_t nGrid = 500U;
+    double maxPow = 0.0, maxAtan2 = 0.0;
+    for ( size_t i = 0U ; i <= nGrid ; ++i ) {
+        for ( size_t j = 0U ; j <= nGrid ; ++j ) {
+            const double u = static_cast<double>( i )/static_cast<double>( nGrid );
+            const double v = static_cast<double>( j )/static_cast<double>( nGrid );
+            const float b = static_cast<float>( 0.01 + 99.99*u ), e = static_cast<float>( -15.0 + 30.0*v );
+            const float py = static_cast<float>( -50.0 + 100.0*u ), px = static_cast<float>( -50.0 + 100.0*v );
+            const double rp = std::pow( static_cast<double>( b ), static_cast<double>( e ) );
+            const double ra = std::atan2( static_cast<double>( py ), static_cast<double>( px ) );
+            maxPow = std::fmax( maxPow, std::fabs( static_cast<double>( ffmath::fast::pow( b, e ) ) - rp )/rp );
+            if ( std::fabs( ra ) > 0.0 ) {
+                maxAtan2 = std::fmax( maxAtan2, std::fabs( static_cast<double>( ffmath::fast::atan2( py, px ) ) - ra )/std::fabs( ra ) );
+            }
+        }
+    }
+    mismatches += ( maxPow <= 8.6e-5 ) ? 0U : 1U;
+    mismatches += ( maxAtan2 <= 3.1e-5 ) ? 0U : 1U;
+    std::cout << "fast tier bounds mismatches: " << mismatches << std::endl;
+
+#if defined( FFMATH_DOUBLE_SUPPORT )
+    std::cout << "double" << std::endl;
+    std::cout.precision( 17 );
+    std::cout << ffmath::sin( 1.0 ) << " " << ffmath::cos( 1.0 ) << " " << ffmath::exp( 1.0 ) << " " << ffmath::log( 2.0 ) << std::endl;
+    std::cout << ffmath::pow( 2.0, 0.5 ) << " " << ffmath::atan2( 1.0, -1.0 ) << " " << ffmath::erf( 0.5 ) << std::endl;
+    std::cout.precision( 6 );
+#endif
+}
+void test_smoother( void )
+{
+    cout << "smoother" << endl;
+    constexpr size_t N = 19U;
+    smootherLPF1 lpf1[ N ];
+    smootherLPF2 lpf2[ N ];
+    smootherEXPW expw[ N ];
+    smootherDESF desf[ N ];
+    smootherLPF1Bank lpf1Bank;
+    smootherLPF2Bank lpf2Bank;
+    smootherEXPWBank expwBank;
+    smootherDESFBank desfBank;
+    smootherBankArea<smootherLPF1Bank, N> lpf1Area;
+    smootherBankArea<smootherLPF2Bank, N> lpf2Area;
+    smootherBankArea<smootherEXPWBank, N> expwArea;
+    smootherBankArea<smootherDESFBank, N> desfArea;
+    real_t x[ N ], y[ 4 ][ N ];
+    size_t mismatches = 0U;
+
+    (void)lpf1Bank.setup( lpf1Area, 0.9_re );
+    (void)lpf2Bank.setup( lpf2Area, 0.9_re );
+    (void)expwBank.setup( expwArea, 0.8_re );
+    (void)desfBank.setup( desfArea, 0.3_re, 0.1_re, 2U );
+    for ( size_t i = 0U ; i < N ; ++i ) {
+        const real_t a = 0.5_re + ( 0.02_re*static_cast<real_t>( i ) );
+        (void)lpf1[ i ].setup( a );
+        (void)lpf1Bank.setChannel( i, a );
+        (void)lpf2[ i ].setup( a );
+        (void)lpf2Bank.setChannel( i, a );
+        (void)expw[ i ].setup( a );
+        (void)expwBank.setChannel( i, a );
+        (void)desf[ i ].setup( 0.3_re, 0.1_re, 2U );
+    }
+    for ( int t = 0 ; t < 50 ; ++t ) {
+        for ( size_t i = 0U ; i < N ; ++i ) {
+            x[ i ] = static_cast<real_t>( ( ( t*7 ) + static_cast<int>( i*13U ) ) % 17 );
+        }
+        lpf1Bank.smooth( x, y[ 0 ] );
+        lpf2Bank.smooth( x, y[ 1 ] );
+        expwBank.smooth( x, y[ 2 ] );
+        desfBank.smooth( x, y[ 3 ] );
+        for ( size_t i = 0U ; i < N ; ++i ) {
+            const real_t r[ 4 ] = { lpf1[ i ].smooth( x[ i ] ), lpf2[ i ].smooth( x[ i ] ), expw[ i ].smooth( x[ i ] ), desf[ i ].smooth( x[ i ] ) };
+            for ( size_t j = 0U ; j < 4U ; ++j ) {
+                mismatches += ( 0 != memcmp( &r[ j ], &y[ j ][ i ], sizeof(real_t) ) ) ? 1U : 0U;
+            }
+        }
+    }
+    cout << y[ 0 ][ 3 ] << " " << y[ 1 ][ 3 ] << " " << y[ 2 ][ 3 ] << " " << y[ 3 ][ 3 ] << endl;
+    cout << "bank mismatches: " << mismatches << endl;
+
+    /*block API against the sample by sample one, out of place and in place*/
+    smootherLPF1 bl1[ 3 ];
+    smootherLPF2 bl2[ 3 ];
+    smootherMWM1 bm1[ 3 ];
+    smootherMWM2 bm2[ 3 ];
+    smootherMOR1 bo1[ 3 ];
+    smootherMOR2 bo2[ 3 ];
+    smootherGMWF bg[ 3 ];
+    smootherEXPW be[ 3 ];
+    smootherKLMN bk[ 3 ];
+    smootherDESF bd[ 3 ];
+    real_t win[ 3 ][ 5 ][ 10 ], kern[ 3 ][ 10 ];
+    real_t in[ 64 ], out[ 64 ], io[ 64 ];
+
+    for ( size_t i = 0U ; i < 3U ; ++i ) {
+        (void)bl1[ i ].setup( 0.7_re );
+        (void)bl2[ i ].setup( 0.7_re );
+        (void)bm1[ i ].setup( win[ i ][ 0 ] );
+        (void)bm2[ i ].setup( win[ i ][ 1 ] );
+        (void)bo1[ i ].setup( win[ i ][ 2 ], 0.5_re );
+        (void)bo2[ i ].setup( win[ i ][ 3 ], 0.5_re );
+        (void)bg[ i ].setup( 0.8_re, 3.0_re, win[ i ][ 4 ], kern[ i ] );
+        (void)be[ i ].setup( 0.8_re );
+        (void)bk[ i ].setup( 100.0_re, 0.9_re, 100.0_re );
+        (void)bd[ i ].setup( 0.3_re, 0.1_re, 2U );
+    }
+    smoother * const sf[ 3 ][ 10 ] = {
+        { &bl1[ 0 ], &bl2[ 0 ], &bm1[ 0 ], &bm2[ 0 ], &bo1[ 0 ], &bo2[ 0 ], &bg[ 0 ], &be[ 0 ], &bk[ 0 ], &bd[ 0 ] },
+        { &bl1[ 1 ], &bl2[ 1 ], &bm1[ 1 ], &bm2[ 1 ], &bo1[ 1 ], &bo2[ 1 ], &bg[ 1 ], &be[ 1 ], &bk[ 1 ], &bd[ 1 ] },
+        { &bl1[ 2 ], &bl2[ 2 ], &bm1[ 2 ], &bm2[ 2 ], &bo1[ 2 ], &bo2[ 2 ], &bg[ 2 ], &be[ 2 ], &bk[ 2 ], &bd[ 2 ] },
+    };
+    for ( size_t t = 0U ; t < 64U ; ++t ) {
+        in[ t ] = static_cast<real_t>( ( t*7U ) % 17U ) + ( ( 0U == ( t % 9U ) ) ? 40.0_re : 0.0_re );
+    }
+    mismatches = 0U;
+    for ( size_t f = 0U ; f < 10U ; ++f ) {
+        size_t t = 0U, len = 1U;
+
+        (void)memcpy( io, in, sizeof(in) );
+        while ( t < 64U ) {
+            const size_t m = ( ( t + len ) < 64U ) ? len : ( 64U - t );
+            sf[ 1 ][ f ]->smooth( &in[ t ], &out[ t ], m );
+            sf[ 2 ][ f ]->smooth( &io[ t ], &io[ t ], m );
+            t += m;
+            len += 4U;
+        }
+        for ( t = 0U ; t < 64U ; ++t ) {
+            const real_t r = sf[ 0 ][ f ]->smooth( in[ t ] );
+            mismatches += ( 0 != memcmp( &r, &out[ t ], sizeof(real_t) ) ) ? 1U : 0U;
+            mismatches += ( 0 != memcmp( &r, &io[ t ], sizeof(real_t) ) ) ? 1U : 0U;
+        }
+    }
+    cout << out[ 63 ] << " " << io[ 63 ] << endl;
+    cout << "block mismatches: " << mismatches << endl;
+
+    /*ring buffer against the shifting window, switched in the middle*/
+    smootherMWM1 rm1[ 2 ];
+    smootherMOR1 ro1[ 2 ];
+    smootherGMWF rg[ 2 ];
+    smootherALNF ra[ 2 ];
+    real_t rwin[ 2 ][ 4 ][ 20 ] = {}, rk[ 2 ][ 10 ] = {}, rwt[ 2 ][ 20 ] = {}, rw1[ 2 ][ 10 ] = {};
+
+    for ( size_t i = 0U ; i < 2U ; ++i ) {
+        (void)rm1[ i ].setup( rwin[ i ][ 0 ], 10U );
+        (void)ro1[ i ].setup( rwin[ i ][ 1 ], 10U, 0.5_re );
+        (void)rg[ i ].setup( 0.8_re, 3.0_re, rwin[ i ][ 2 ], rk[ i ], 10U );
+        (void)ra[ i ].setup( 0.01_re, 0.05_re, 10U, rwin[ i ][ 3 ], rwt[ i ], rw1[ i ] );
+    }
+    (void)rg[ 1 ].setRingBuffer( rwin[ 1 ][ 2 ] );
+    smoother * const rf[ 2 ][ 4 ] = {
+        { &rm1[ 0 ], &ro1[ 0 ], &rg[ 0 ], &ra[ 0 ] },
+        { &rm1[ 1 ], &ro1[ 1 ], &rg[ 1 ], &ra[ 1 ] },
+    };
+    mismatches = 0U;
+    for ( size_t f = 0U ; f < 4U ; ++f ) {
+        size_t t, len = 1U;
+
+        for ( t = 0U ; t < 20U ; ++t ) {
+            out[ t ] = rf[ 1 ][ f ]->smooth( in[ t ] );
+        }
+        (void)rm1[ 1 ].setRingBuffer( rwin[ 1 ][ 0 ] );
+        (void)ro1[ 1 ].setRingBuffer( rwin[ 1 ][ 1 ] );
+        (void)ra[ 1 ].setRingBuffer( rwin[ 1 ][ 3 ] );
+        while ( t < 64U ) {
+            const size_t m = ( ( t + len ) < 64U ) ? len : ( 64U - t );
+            rf[ 1 ][ f ]->smooth( &in[ t ], &out[ t ], m );
+            t += m;
+            len += 6U;
+        }
+        for ( t = 0U ; t < 64U ; ++t ) {
+            const real_t r = rf[ 0 ][ f ]->smooth( in[ t ] );
+            mismatches += ( 0 != memcmp( &r, &out[ t ], sizeof(real_t) ) ) ? 1U : 0U;
+        }
+    }
+    cout << "ring mismatches: " << mismatches << endl;
 }
 /*
 void test_mat( void )
@@ -450,6 +1350,31 @@ void test_mat( void )
 
 }
 */
+/*the breakpoints, the points between them and the ones beyond the endpoints*/
+template <interp1Method M>
+size_t tableMismatches( const real_t (&tx)[ 8 ], const real_t (&ty)[ 8 ] )
+{
+    interp1Table<8, M> t;
+    interp1 ref( tx, ty, 8U );
+    size_t mismatches = 0U;
+
+    for ( size_t i = 0U ; i < 8U ; ++i ) {
+        t.x[ i ] = tx[ i ];
+        t.y[ i ] = ty[ i ];
+    }
+    (void)ref.setMethod( M );
+    for ( int k = -20 ; k < 320 ; ++k ) {
+        const real_t x = 0.125f*static_cast<real_t>( k );
+        const real_t r[ 2 ] = { t.get( x ), ref.get( x ) };
+        mismatches += ( 0 != memcmp( &r[ 0 ], &r[ 1 ], sizeof(real_t) ) ) ? 1U : 0U;
+    }
+    for ( size_t i = 0U ; i < 8U ; ++i ) {
+        const real_t r[ 2 ] = { t.get( t.x[ i ] ), ref.get( t.x[ i ] ) };
+        mismatches += ( 0 != memcmp( &r[ 0 ], &r[ 1 ], sizeof(real_t) ) ) ? 1U : 0U;
+    }
+    return mismatches;
+}
+
 void test_interp1( void )
 {
     real_t tx[] = { 1.0f, 2.0f, 3.0f, 4.0f };
@@ -529,6 +1454,169 @@ void test_interp1( void )
 
         cout << i << "  " <<  interpolation2.get( i ) << endl;
     }
+
+    /*the search method must not change the result*/
+    real_t ux[ 64 ], nx[ 64 ], uy[ 64 ];
+    for ( size_t i = 0U ; i < 64U ; ++i ) {
+        ux[ i ] = 0.5f*static_cast<real_t>( i );
+        nx[ i ] = static_cast<real_t>( i ) + 0.3f*static_cast<real_t>( i % 3U );
+        uy[ i ] = static_cast<real_t>( ( i*7U ) % 11U );
+    }
+    interp1 iu( ux, uy ), in( nx, uy );
+    size_t mismatches = 0U;
+    cout << "uniform: " << iu.isUniform() << " " << in.isUniform() << endl;
+    for ( int m = 0 ; m < static_cast<int>( INTERP1_MAX ) ; ++m ) {
+        (void)iu.setMethod( static_cast<interp1Method>( m ) );
+        (void)in.setMethod( static_cast<interp1Method>( m ) );
+        for ( int k = -20 ; k < 300 ; ++k ) {
+            /*slowly changing and jumping inputs*/
+            const real_t x = 0.25f*static_cast<real_t>( ( 0 == ( k % 2 ) ) ? k : ( ( ( k*37 ) % 320 ) - 20 ) );
+            real_t r[ 2 ][ INTERP1_SEARCH_MAX ];
+            for ( int s = 0 ; s < static_cast<int>( INTERP1_SEARCH_MAX ) ; ++s ) {
+                (void)iu.setSearch( static_cast<interp1Search>( s ) );
+                (void)in.setSearch( static_cast<interp1Search>( s ) );
+                r[ 0 ][ s ] = iu.get( x );
+                r[ 1 ][ s ] = in.get( x );
+            }
+            for ( int s = 1 ; s < static_cast<int>( INTERP1_SEARCH_MAX ) ; ++s ) {
+                mismatches += ( 0 != memcmp( &r[ 0 ][ 0 ], &r[ 0 ][ s ], sizeof(real_t) ) ) ? 1U : 0U;
+                mismatches += ( 0 != memcmp( &r[ 1 ][ 0 ], &r[ 1 ][ s ], sizeof(real_t) ) ) ? 1U : 0U;
+            }
+        }
+    }
+    cout << "search mismatches: " << mismatches << endl;
+
+    /*the prepared coefficients must give the same result, up to the rounding*/
+    interp1Coefficients<64> cu;
+    interp1Coefficients<8> c8;
+    mismatches = 0U;
+    for ( int m = INTERP1_HERMITE ; m <= INTERP1_CONSTRAINED_SPLINE ; ++m ) {
+        /*the global polynomial of the hermite method needs a short table*/
+        interp1 &ip = ( INTERP1_HERMITE == m ) ? interpolation2 : iu;
+        real_t r[ 320 ];
+        (void)ip.setMethod( static_cast<interp1Method>( m ) );
+        for ( int k = 0 ; k < 320 ; ++k ) {
+            r[ k ] = ip.get( 0.125f*static_cast<real_t>( k - 20 ) );
+        }
+        (void)( ( INTERP1_HERMITE == m ) ? ip.prepare( c8 ) : ip.prepare( cu ) );
+        for ( int k = 0 ; k < 320 ; ++k ) {
+            const real_t y = ip.get( 0.125f*static_cast<real_t>( k - 20 ) );
+            mismatches += ( fabs( y - r[ k ] ) > 1.0e-3f*( 1.0f + fabs( r[ k ] ) ) ) ? 1U : 0U;
+        }
+    }
+    cout << "prepared mismatches: " << mismatches << endl;
+
+    /*the batch must give the same result for sorted and unsorted inputs*/
+    real_t xq[ 2 ][ 320 ], yq[ 2 ][ 320 ];
+    for ( int k = 0 ; k < 320 ; ++k ) {
+        xq[ 0 ][ k ] = 0.25f*static_cast<real_t>( k - 20 );
+        xq[ 1 ][ k ] = 0.25f*static_cast<real_t>( ( ( k*37 ) % 320 ) - 20 );
+    }
+    mismatches = 0U;
+    for ( int m = 0 ; m < static_cast<int>( INTERP1_MAX ) ; ++m ) {
+        (void)in.setMethod( static_cast<interp1Method>( m ) );
+        in.get( xq[ 0 ], yq[ 0 ] );
+        in.get( xq[ 1 ], yq[ 1 ], 320U );
+        for ( int k = 0 ; k < 320 ; ++k ) {
+            const real_t r[ 2 ] = { in.get( xq[ 0 ][ k ] ), in.get( xq[ 1 ][ k ] ) };
+            mismatches += ( 0 != memcmp( &r[ 0 ], &yq[ 0 ][ k ], sizeof(real_t) ) ) ? 1U : 0U;
+            mismatches += ( 0 != memcmp( &r[ 1 ], &yq[ 1 ][ k ], sizeof(real_t) ) ) ? 1U : 0U;
+        }
+    }
+    cout << "batch mismatches: " << mismatches << endl;
+
+    /*the gather path of unsorted inputs, with repeated points, ties and knots*/
+    real_t rx[ 13 ] = { 0.0f, 1.0f, 1.0f, 2.0f, 3.0f, 3.0f, 3.0f, 4.5f, 5.0f, 6.0f, 6.0f, 7.5f, 9.0f };
+    real_t ry[ 13 ] = { 2.0f, -1.0f, 3.0f, 0.5f, 4.0f, -2.0f, 1.0f, 0.0f, 6.0f, 2.5f, -3.0f, 1.5f, 0.25f };
+    interp1 ir( rx, ry );
+    real_t gq[ 101 ], gy[ 101 ];
+    for ( int k = 0 ; k < 101 ; ++k ) {
+        gq[ k ] = 0.25f*static_cast<real_t>( ( ( k*29 ) % 101 ) - 30 );
+    }
+    mismatches = 0U;
+    for ( const interp1Method m : { INTERP1_LINEAR, INTERP1_PREVIOUS, INTERP1_NEXT, INTERP1_NEAREST } ) {
+        (void)ir.setMethod( m );
+        ir.get( gq, gy );
+        for ( int k = 0 ; k < 101 ; ++k ) {
+            const real_t r = ir.get( gq[ k ] );
+            mismatches += ( 0 != memcmp( &r, &gy[ k ], sizeof(real_t) ) ) ? 1U : 0U;
+        }
+    }
+    cout << "gather mismatches: " << mismatches << endl;
+
+    /*the compile-time tables must give the same result as interp1*/
+    constexpr interp1Table<8, INTERP1_CONSTRAINED_SPLINE> ct = {
+        { 1.0f, 6.0f, 11.0f, 16.0f, 21.0f, 26.0f, 31.0f, 36.0f },
+        { 59.6870f,  44.5622f, -0.8642f , 0.8725f, -2.3016f, -50.3095f, -54.5966f, 37.9036f }
+    };
+    constexpr real_t cv = ct.get( 16.0f );
+    static_assert( ( cv > 0.87f ) && ( cv < 0.88f ), "constexpr interpolation" );
+    mismatches = tableMismatches<INTERP1_NEXT>( ct.x, ct.y );
+    mismatches += tableMismatches<INTERP1_PREVIOUS>( ct.x, ct.y );
+    mismatches += tableMismatches<INTERP1_NEAREST>( ct.x, ct.y );
+    mismatches += tableMismatches<INTERP1_LINEAR>( ct.x, ct.y );
+    mismatches += tableMismatches<INTERP1_SINE>( ct.x, ct.y );
+    mismatches += tableMismatches<INTERP1_CUBIC>( ct.x, ct.y );
+    mismatches += tableMismatches<INTERP1_HERMITE>( ct.x, ct.y );
+    mismatches += tableMismatches<INTERP1_SPLINE>( ct.x, ct.y );
+    mismatches += tableMismatches<INTERP1_CONSTRAINED_SPLINE>( ct.x, ct.y );
+    cout << "table mismatches: " << mismatches << endl;
+}
+
+void test_interpN( void )
+{
+    cout << "interpN test" << endl;
+    real_t x[ 7 ] = { 0.0f, 1.0f, 2.5f, 3.0f, 4.5f, 6.0f, 7.0f };
+    real_t y[ 5 ] = { -1.0f, 0.0f, 2.0f, 3.0f, 5.0f };
+    real_t z[ 5 ][ 7 ];
+    for ( size_t j = 0U ; j < 5U ; ++j ) {
+        for ( size_t i = 0U ; i < 7U ; ++i ) {
+            z[ j ][ i ] = ffmath::sin( 0.7f*x[ i ] )*y[ j ] + 0.3f*y[ j ]*y[ j ] + x[ i ];
+        }
+    }
+    interp2 ip( x, y, z );
+    size_t mismatches = 0U;
+    /*the same result as the interpolation of the rows along x, then along y*/
+    for ( int m = 0 ; m < static_cast<int>( INTERP1_MAX ) ; ++m ) {
+        if ( !ip.setMethod( static_cast<interp1Method>( m ) ) ) {
+            continue;
+        }
+        for ( int a = -10 ; a < 90 ; a += 3 ) {
+            for ( int b = -10 ; b < 70 ; b += 3 ) {
+                const real_t qx = 0.0913f*static_cast<real_t>( a );
+                const real_t qy = 0.0977f*static_cast<real_t>( b );
+                real_t col[ 5 ];
+                for ( size_t j = 0U ; j < 5U ; ++j ) {
+                    interp1 row( x, z[ j ] );
+                    (void)row.setMethod( static_cast<interp1Method>( m ) );
+                    col[ j ] = row.get( qx );
+                }
+                interp1 c( y, col );
+                (void)c.setMethod( static_cast<interp1Method>( m ) );
+                const real_t r = c.get( qy );
+                mismatches += ( fabs( ip.get( qx, qy ) - r ) > 1.0e-4f*( 1.0f + fabs( r ) ) ) ? 1U : 0U;
+            }
+        }
+    }
+    /*the batch with one axis fixed, like a row of the table*/
+    real_t xq[ 16 ], yq[ 16 ], zq[ 16 ];
+    (void)ip.setMethod( INTERP1_LINEAR );
+    for ( size_t i = 0U ; i < 16U ; ++i ) {
+        xq[ i ] = 0.5f*static_cast<real_t>( i );
+        yq[ i ] = 2.0f;
+    }
+    ip.get( xq, yq, zq, 16U );
+    for ( size_t i = 0U ; i < 16U ; ++i ) {
+        interp1 row( x, z[ 2 ] );
+        mismatches += ( fabs( zq[ i ] - row.get( xq[ i ] ) ) > 1.0e-4f*( 1.0f + fabs( zq[ i ] ) ) ) ? 1U : 0U;
+    }
+    /*a NaN coordinate is never taken from the cache of the previous input*/
+    const real_t r0 = ip.get( 2.0f, 1.0f );
+    mismatches += ffmath::isNan( ip.get( 2.0f, ffmath::getNan() ) ) ? 0U : 1U;
+    mismatches += ffmath::isNan( ip.get( ffmath::getNan(), 1.0f ) ) ? 0U : 1U;
+    const real_t r1 = ip.get( 2.0f, 1.0f );
+    mismatches += ( 0 != memcmp( &r0, &r1, sizeof(real_t) ) ) ? 1U : 0U;
+    cout << "interpN mismatches: " << mismatches << endl;
 }
 
 struct thing{
@@ -596,10 +1684,12 @@ int main()
 
     //test_mat();
     test_interp1();
+    test_interpN();
     test_fis();
     test_fis2();
     test_fis3();
     test_ffmath();
+    test_smoother();
 
 test_ltisys();
 
@@ -1,7 +1,137 @@
 #include <include/crc.hpp>
 
+#if !defined( QLIBS_CRC_NO_HW ) && defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+    #define QLIBS_CRC_X86_HW
+    #include <immintrin.h>
+#endif
+
 using namespace qlibs;
 
+#if defined( QLIBS_CRC_X86_HW )
+
+/*! @cond */
+#define QLIBS_CRC_TARGET    __attribute__( ( target( "sse4.2,ssse3,pclmul" ) ) )
+
+static bool crc_hwAvailable( void ) noexcept;
+static uint32_t crc_hwCastagnoli( uint32_t val,
+                                  uint8_t const *msg,
+                                  size_t n ) noexcept;
+static void crc_hwFold( const uint64_t * const keys,
+                        uint8_t * const rem,
+                        uint8_t const *msg,
+                        size_t n,
+                        const bool reflected ) noexcept;
+static __m128i crc_hwLoad( uint8_t const * const p,
+                           const bool reflected ) noexcept;
+static __m128i crc_hwFold16( const __m128i x,
+                             const __m128i k ) noexcept;
+
+/*============================================================================*/
+static bool crc_hwAvailable( void ) noexcept
+{
+    static const bool available = ( __builtin_cpu_init(), ( 0 != __builtin_cpu_supports( "sse4.2" ) ) &&
+                                                          ( 0 != __builtin_cpu_supports( "ssse3" ) ) &&
+                                                          ( 0 != __builtin_cpu_supports( "pclmul" ) ) );
+    return available;
+}
+/*============================================================================*/
+QLIBS_CRC_TARGET
+static uint32_t crc_hwCastagnoli( uint32_t val,
+                                  uint8_t const *msg,
+                                  size_t n ) noexcept
+{
+    uint64_t c = val;
+
+    while ( n >= 8U ) {
+        uint64_t v;
+        (void)memcpy( &v, msg, sizeof(v) );
+        c = _mm_crc32_u64( c, v );
+        msg += 8;
+        n -= 8U;
+    }
+    val = static_cast<uint32_t>( c );
+    while ( n > 0U ) {
+        val = _mm_crc32_u8( val, *msg );
+        ++msg;
+        --n;
+    }
+
+    return val;
+}
+/*============================================================================*/
+QLIBS_CRC_TARGET
+static __m128i crc_hwLoad( uint8_t const * const p,
+                           const bool reflected ) noexcept
+{
+    /*cstat -CERT-EXP36-C_b*/
+    const __m128i v = _mm_loadu_si128( reinterpret_cast<const __m128i*>( p ) );
+    /*cstat +CERT-EXP36-C_b*/
+    /*non-reflected data is handled as a big-endian polynomial*/
+    return ( reflected ) ? v : _mm_shuffle_epi8( v, _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ) );
+}
+/*============================================================================*/
+QLIBS_CRC_TARGET
+static __m128i crc_hwFold16( const __m128i x,
+                             const __m128i k ) noexcept
+{
+    return _mm_xor_si128( _mm_clmulepi64_si128( x, k, 0x00 ),
+                          _mm_clmulepi64_si128( x, k, 0x11 ) );
+}
+/*============================================================================*/
+QLIBS_CRC_TARGET
+static void crc_hwFold( const uint64_t * const keys,
+                        uint8_t * const rem,
+                        uint8_t const *msg,
+                        size_t n,
+                        const bool reflected ) noexcept
+{
+    /*cstat -MISRAC++2008-5-0-8 -CERT-INT31-C_c*/
+    const __m128i k128 = _mm_set_epi64x( static_cast<long long>( keys[ 1 ] ), static_cast<long long>( keys[ 0 ] ) );
+    const __m128i k512 = _mm_set_epi64x( static_cast<long long>( keys[ 3 ] ), static_cast<long long>( keys[ 2 ] ) );
+    /*cstat +MISRAC++2008-5-0-8 +CERT-INT31-C_c*/
+    /*the first block comes from the remainder buffer, the initial value is already there*/
+    __m128i x0 = crc_hwLoad( rem, reflected );
+
+    if ( n >= 48U ) {
+        __m128i x1 = crc_hwLoad( msg, reflected );
+        __m128i x2 = crc_hwLoad( msg + 16, reflected );
+        __m128i x3 = crc_hwLoad( msg + 32, reflected );
+
+        msg += 48;
+        n -= 48U;
+        while ( n >= 64U ) {
+            x0 = _mm_xor_si128( crc_hwFold16( x0, k512 ), crc_hwLoad( msg, reflected ) );
+            x1 = _mm_xor_si128( crc_hwFold16( x1, k512 ), crc_hwLoad( msg + 16, reflected ) );
+            x2 = _mm_xor_si128( crc_hwFold16( x2, k512 ), crc_hwLoad( msg + 32, reflected ) );
+            x3 = _mm_xor_si128( crc_hwFold16( x3, k512 ), crc_hwLoad( msg + 48, reflected ) );
+            msg += 64;
+            n -= 64U;
+        }
+        x0 = _mm_xor_si128( crc_hwFold16( x0, k128 ), x1 );
+        x0 = _mm_xor_si128( crc_hwFold16( x0, k128 ), x2 );
+        x0 = _mm_xor_si128( crc_hwFold16( x0, k128 ), x3 );
+    }
+    while ( n >= 16U ) {
+        x0 = _mm_xor_si128( crc_hwFold16( x0, k128 ), crc_hwLoad( msg, reflected ) );
+        msg += 16;
+        n -= 16U;
+    }
+    /*the remainder is congruent to the processed data, store it back as a
+    message prefix followed by the trailing bytes*/
+    if ( !reflected ) {
+        x0 = _mm_shuffle_epi8( x0, _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ) );
+    }
+    /*cstat -CERT-EXP36-C_b*/
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( rem ), x0 );
+    /*cstat +CERT-EXP36-C_b*/
+    (void)memcpy( &rem[ 16 ], msg, n );
+}
+/*============================================================================*/
+#undef QLIBS_CRC_TARGET
+/*! @endcond */
+
+#endif /*QLIBS_CRC_X86_HW*/
+
 /*============================================================================*/
 uint32_t crc::reflect( uint32_t xData,
                        const uint8_t nBits ) noexcept
@@ -62,4 +192,231 @@ uint32_t crc::generic( crcMode mode,
 
     return val;
 }
-/*============================================================================*/
\ No newline at end of file
+/*============================================================================*/
+uint32_t crc::sliceBy8( const uint32_t * const lut,
+                        const uint32_t width,
+                        const void * const pData,
+                        const size_t length,
+                        const uint32_t init,
+                        const bool refIn,
+                        const bool refOut,
+                        const uint32_t xorOut ) noexcept
+{
+    uint32_t val = 0U;
+
+    if ( ( nullptr != pData ) && ( length > 0U ) ) {
+        /*cstat -CERT-EXP36-C_b*/
+        uint8_t const *msg = static_cast<uint8_t const *>( pData );
+        /*cstat +CERT-EXP36-C_b*/
+        const uint32_t *t0 = &lut[ 0U ];
+        const uint32_t *t1 = &lut[ 256U ];
+        const uint32_t *t2 = &lut[ 512U ];
+        const uint32_t *t3 = &lut[ 768U ];
+        const uint32_t *t4 = &lut[ 1024U ];
+        const uint32_t *t5 = &lut[ 1280U ];
+        const uint32_t *t6 = &lut[ 1536U ];
+        const uint32_t *t7 = &lut[ 1792U ];
+        const uint32_t shift = 32U - width;
+        const uint32_t bitMask = ( 0xFFFFFFFFU >> shift );
+        size_t n = length;
+
+        /*cstat -MISRAC++2008-5-0-8 -MISRAC++2008-5-0-10 -MISRAC++2008-5-0-21*/
+        if ( refIn ) {
+            /*the register is kept reflected and right-aligned*/
+            val = reflect( init & bitMask, static_cast<uint8_t>( width ) );
+            while ( n >= 8U ) {
+                val ^= static_cast<uint32_t>( msg[ 0 ] ) |
+                       ( static_cast<uint32_t>( msg[ 1 ] ) << 8U ) |
+                       ( static_cast<uint32_t>( msg[ 2 ] ) << 16U ) |
+                       ( static_cast<uint32_t>( msg[ 3 ] ) << 24U );
+                val = t7[ val & 0xFFU ] ^ t6[ ( val >> 8U ) & 0xFFU ] ^
+                      t5[ ( val >> 16U ) & 0xFFU ] ^ t4[ val >> 24U ] ^
+                      t3[ msg[ 4 ] ] ^ t2[ msg[ 5 ] ] ^ t1[ msg[ 6 ] ] ^ t0[ msg[ 7 ] ];
+                msg += 8;
+                n -= 8U;
+            }
+            while ( n > 0U ) {
+                val = ( val >> 8U ) ^ t0[ ( val ^ static_cast<uint32_t>( *msg ) ) & 0xFFU ];
+                ++msg;
+                --n;
+            }
+            if ( !refOut ) {
+                val = reflect( val, static_cast<uint8_t>( width ) );
+            }
+        }
+        else {
+            /*the register is kept left-aligned so all widths share the same path*/
+            val = ( init & bitMask ) << shift;
+            while ( n >= 8U ) {
+                val ^= ( static_cast<uint32_t>( msg[ 0 ] ) << 24U ) |
+                       ( static_cast<uint32_t>( msg[ 1 ] ) << 16U ) |
+                       ( static_cast<uint32_t>( msg[ 2 ] ) << 8U ) |
+                       static_cast<uint32_t>( msg[ 3 ] );
+                val = t7[ val >> 24U ] ^ t6[ ( val >> 16U ) & 0xFFU ] ^
+                      t5[ ( val >> 8U ) & 0xFFU ] ^ t4[ val & 0xFFU ] ^
+                      t3[ msg[ 4 ] ] ^ t2[ msg[ 5 ] ] ^ t1[ msg[ 6 ] ] ^ t0[ msg[ 7 ] ];
+                msg += 8;
+                n -= 8U;
+            }
+            while ( n > 0U ) {
+                val = ( val << 8U ) ^ t0[ ( val >> 24U ) ^ static_cast<uint32_t>( *msg ) ];
+                ++msg;
+                --n;
+            }
+            val >>= shift;
+            if ( refOut ) {
+                val = reflect( val, static_cast<uint8_t>( width ) );
+            }
+        }
+        /*cstat +MISRAC++2008-5-0-8 +MISRAC++2008-5-0-10 +MISRAC++2008-5-0-21*/
+        val = ( val ^ xorOut ) & bitMask;
+    }
+
+    return val;
+}
+/*============================================================================*/
+uint32_t crc::engine( const uint32_t * const lut,
+                      const uint64_t * const keys,
+                      const uint32_t poly,
+                      const uint32_t width,
+                      const void * const pData,
+                      const size_t length,
+                      const uint32_t init,
+                      const bool refIn,
+                      const bool refOut,
+                      const uint32_t xorOut ) noexcept
+{
+    uint32_t val;
+
+    #if defined( QLIBS_CRC_X86_HW )
+        if ( ( nullptr != pData ) && ( length >= 64U ) && crc_hwAvailable() ) {
+            /*cstat -CERT-EXP36-C_b*/
+            uint8_t const * const msg = static_cast<uint8_t const *>( pData );
+            /*cstat +CERT-EXP36-C_b*/
+            const uint32_t shift = 32U - width;
+            const uint32_t bitMask = ( 0xFFFFFFFFU >> shift );
+
+            if ( ( 32U == width ) && refIn && ( 0x1EDC6F41U == poly ) ) {
+                val = crc_hwCastagnoli( reflect( init, 32U ), msg, length );
+                val = ( refOut ) ? val : reflect( val, 32U );
+                val ^= xorOut;
+            }
+            else {
+                /*the data is folded down to 16 bytes congruent modulo the
+                polynomial, the trailing bytes are handled by the tables*/
+                uint8_t rem[ 32 ];
+                uint32_t r;
+                /*cstat -MISRAC++2008-5-0-8 -MISRAC++2008-5-0-21*/
+                if ( refIn ) {
+                    r = reflect( init & bitMask, static_cast<uint8_t>( width ) );
+                    (void)memcpy( rem, msg, 16U );
+                    rem[ 0 ] ^= static_cast<uint8_t>( r );
+                    rem[ 1 ] ^= static_cast<uint8_t>( r >> 8U );
+                    rem[ 2 ] ^= static_cast<uint8_t>( r >> 16U );
+                    rem[ 3 ] ^= static_cast<uint8_t>( r >> 24U );
+                }
+                else {
+                    r = ( init & bitMask ) << shift;
+                    (void)memcpy( rem, msg, 16U );
+                    rem[ 0 ] ^= static_cast<uint8_t>( r >> 24U );
+                    rem[ 1 ] ^= static_cast<uint8_t>( r >> 16U );
+                    rem[ 2 ] ^= static_cast<uint8_t>( r >> 8U );
+                    rem[ 3 ] ^= static_cast<uint8_t>( r );
+                }
+                /*cstat +MISRAC++2008-5-0-8 +MISRAC++2008-5-0-21*/
+                crc_hwFold( keys, rem, msg + 16, length - 16U, refIn );
+                val = sliceBy8( lut, width, rem, 16U + ( ( length - 16U ) % 16U ), 0U, refIn, refOut, xorOut );
+            }
+            val &= bitMask;
+        }
+        else {
+            val = sliceBy8( lut, width, pData, length, init, refIn, refOut, xorOut );
+        }
+    #else
+        Q_UNUSED( keys );
+        Q_UNUSED( poly );
+        val = sliceBy8( lut, width, pData, length, init, refIn, refOut, xorOut );
+    #endif
+
+    return val;
+}
+/*============================================================================*/
+uint32_t crc::mulxn( uint32_t value,
+                     const uint32_t poly,
+                     const uint32_t width,
+                     size_t nBytes ) noexcept
+{
+    /*the operands are left-aligned, so all widths are reduced modulo the
+    32-bit polynomial G = x^32 + poly*x^(32 - width)*/
+    const uint32_t shift = 32U - width;
+    const uint32_t g = poly << shift;
+    uint32_t p = 0x100U; /*x^8*/
+    uint32_t a = value << shift;
+
+    /*square-and-multiply : a*x^(8n) mod G*/
+    while ( nBytes > 0U ) {
+        if ( 0U != ( nBytes & 1U ) ) {
+            uint32_t r = 0U;
+            for ( uint32_t i = 0U ; i < 32U ; ++i ) {
+                /*cstat -MISRAC++2008-5-0-8 -MISRAC++2008-5-0-10*/
+                r = ( 0U != ( r & 0x80000000U ) ) ? ( ( r << 1U ) ^ g ) : ( r << 1U );
+                if ( 0U != ( p & ( 0x80000000U >> i ) ) ) {
+                    r ^= a;
+                }
+                /*cstat +MISRAC++2008-5-0-8 +MISRAC++2008-5-0-10*/
+            }
+            a = r;
+        }
+        nBytes >>= 1U;
+        if ( nBytes > 0U ) {
+            uint32_t r = 0U;
+            for ( uint32_t i = 0U ; i < 32U ; ++i ) {
+                /*cstat -MISRAC++2008-5-0-8 -MISRAC++2008-5-0-10*/
+                r = ( 0U != ( r & 0x80000000U ) ) ? ( ( r << 1U ) ^ g ) : ( r << 1U );
+                if ( 0U != ( p & ( 0x80000000U >> i ) ) ) {
+                    r ^= p;
+                }
+                /*cstat +MISRAC++2008-5-0-8 +MISRAC++2008-5-0-10*/
+            }
+            p = r;
+        }
+    }
+
+    return a >> shift;
+}
+/*============================================================================*/
+uint32_t crc::combine( crcMode mode,
+                       const uint32_t crcA,
+                       const uint32_t crcB,
+                       const size_t lengthB,
+                       uint32_t poly,
+                       const uint32_t init,
+                       bool refOut,
+                       uint32_t xorOut ) noexcept
+{
+    uint32_t val = 0U;
+
+    if ( ( mode == crcMode::CRC8 ) || ( mode == crcMode::CRC16 ) || ( mode == crcMode::CRC32 ) ) {
+        const uint32_t widthValues[ 3 ] = { 8UL, 16UL, 32UL };
+        const uint32_t width = widthValues[ mode ];
+        const uint32_t bitMask = ( 0xFFFFFFFFU >> ( 32U - width ) );
+        uint32_t regA, regB;
+
+        poly &= bitMask;
+        xorOut &= bitMask;
+        /*undo the output stage to recover the registers*/
+        regA = ( crcA ^ xorOut ) & bitMask;
+        regB = ( crcB ^ xorOut ) & bitMask;
+        if ( refOut ) {
+            regA = reflect( regA, static_cast<uint8_t>( width ) );
+            regB = reflect( regB, static_cast<uint8_t>( width ) );
+        }
+        /*the register is affine on the data : reg(A|B) = (regA ^ init)*x^(8*lenB) ^ regB*/
+        val = mulxn( regA ^ ( init & bitMask ), poly, width, lengthB ) ^ regB;
+        val = ( refOut ) ? ( reflect( val, static_cast<uint8_t>( width ) )^xorOut ) : ( val^xorOut );
+        val &= bitMask;
+    }
+
+    return val;
+}
+/*============================================================================*/
@@ -110,139 +110,6 @@ static inline float absolute( const float x )
     return bit_cast<float>( F32_NO_SIGN_MASK & bit_cast<uint32_t>( x ) );
 }
 /*============================================================================*/
-bool ffmath::isEqual( const float a,
-                      const float b,
-                      const float tol ) noexcept
-{
-    return ( absolute( a - b ) <= absolute( tol ) );
-}
-/*============================================================================*/
-float ffmath::getInf( void )
-{
-    return limits::infinity();
-}
-/*============================================================================*/
-float ffmath::getNan( void )
-{
-    return limits::nan();
-}
-/*============================================================================*/
-ffmath::classification ffmath::classify( const float f )
-{
-    const uint32_t u = bit_cast<uint32_t>( f ) & F32_NO_SIGN_MASK;
-    ffmath::classification retVal;
-
-    if ( 0U == u ) {
-        retVal = ffmath::classification::FFP_ZERO;
-    }
-    else if ( u < 0x00800000U ) {
-        retVal = ffmath::classification::FFP_SUBNORMAL;
-    }
-    else if ( u < 0x7F800000U ) {
-        retVal = ffmath::classification::FFP_NORMAL;
-    }
-    else if ( 0x7F800000U == u ) {
-        retVal = ffmath::classification::FFP_INFINITE;
-    }
-    else {
-        retVal = ffmath::classification::FFP_NAN;
-    }
-
-    return retVal;
-}
-/*============================================================================*/
-float ffmath::copysign( float mag,
-                        float sgn )
-{
-    uint32_t u_mag = bit_cast<uint32_t>( mag );
-    const uint32_t u_sgn = bit_cast<uint32_t>( sgn );
-    u_mag &= F32_NO_SIGN_MASK;
-    u_mag |= u_sgn & F32_SIGN_MASK;
-
-    return bit_cast<float>(u_mag );
-}
-/*============================================================================*/
-float ffmath::sign( float x )
-{
-    float s;
-
-    if ( x > 0.0F ) {
-        s = 1.0F;
-    }
-    else if ( x < 0.0F ) {
-        s = -1.0F;
-    }
-    else if ( ffmath::classification::FFP_ZERO == ffmath::classify( x ) ) {
-        s = 0.0F;
-    }
-    else {
-        s = limits::nan();
-    }
-
-    return s;
-}
-/*============================================================================*/
-float ffmath::absf( float x )
-{
-    return absolute( x );
-}
-/*============================================================================*/
-float ffmath::recip( float x )
-{
-    float z = 0.0F;
-    uint32_t y = bit_cast<uint32_t>( x );
-
-    y = 0x7EF311C7U - y;
-    z = bit_cast<float>( y );
-
-    return z*( 2.0F - ( x*z ) );
-}
-/*============================================================================*/
-float ffmath::sqrt( float x )
-{
-    float retVal;
-
-    if ( x < 0.0F ) {
-        retVal = limits::nan();
-    }
-    else if ( ffmath::classification::FFP_ZERO == ffmath::classify( x ) ) {
-        retVal = 0.0F;
-    }
-    else {
-        uint32_t y = bit_cast<uint32_t>( x );
-        float z = 0.0F;
-
-        y = ( ( y - 0x00800000U ) >> 1U ) + 0x20000000U;
-        z = bit_cast<float>( y );
-        z = 0.5F*( ( x/z ) + z );
-        retVal = 0.5F*( ( x/z ) + z );
-    }
-
-    return retVal;
-}
-/*============================================================================*/
-float ffmath::rSqrt( float x )
-{
-    float retVal;
-
-    if ( x < 0.0F ) {
-        retVal = limits::nan();
-    }
-    else if ( ffmath::classification::FFP_ZERO  == ffmath::classify( x ) ) {
-        retVal = limits::infinity();
-    }
-    else {
-        uint32_t y = bit_cast<uint32_t>( x );
-        const float z = 0.5F*x;
-
-        y = 0x5F375A86U - ( y >> 1U );
-        x = bit_cast<float>( y );
-        retVal = x*( 1.5F - ( z*x*x ) );
-    }
-
-    return retVal;
-}
-/*============================================================================*/
 static float compute_cbrt( float x , bool r )
 {
     float retVal, y = 0.0F, c, d;
@@ -308,99 +175,6 @@ float ffmath::rounding( float x )
     return ret;
 }
 /*============================================================================*/
-float ffmath::floor( float x )
-{
-    int32_t i0 = bit_cast<int32_t>( x );
-    int32_t j0;
-    float ret = x;
-
-    /*cstat -MISRAC++2008-5-0-21 -ATH-neg-check-nonneg -ATH-shift-neg -CERT-INT34-C_c*/
-    j0 = ( ( i0 >> 23 ) & 0xFF ) - 0x7F;
-    if ( j0 < 23 ) {
-        if ( j0 < 0 ) {
-            if ( i0 >= 0 ) {
-                i0 = 0;
-            }
-            else if ( 0 != ( i0 & static_cast<int32_t>( F32_NO_SIGN_MASK ) ) ) {
-                i0 = static_cast<int32_t>( 0xBF800000U );
-            }
-            else {
-                /*nothing to do here*/
-            }
-            ret = bit_cast<float>( i0 );
-        }
-        else {
-            const int32_t i = 0x007FFFFF >> j0;
-            if ( 0 != ( i0 & i ) ) {
-                if ( i0 < 0 ) {
-                    i0 += 0x00800000 >> j0;
-                }
-                i0 &= (~i);
-                ret = bit_cast<float>( i0 );
-            }
-        }
-    }
-    /*cstat +MISRAC++2008-5-0-21 +ATH-neg-check-nonneg +ATH-shift-neg +CERT-INT34-C_c*/
-    return ret;
-}
-/*============================================================================*/
-float ffmath::ceil( float x )
-{
-    int32_t i0 = bit_cast<int32_t>( x );
-    int32_t j0;
-    float ret = x;
-
-    /*cstat -MISRAC++2008-5-0-21 -ATH-neg-check-nonneg -ATH-shift-neg -CERT-INT34-C_c*/
-    j0 = ( ( i0 >> 23 ) & 0xFF ) - 0x7F;
-    if ( j0 < 23 ) {
-        if ( j0 < 0 ) {
-            if ( i0 < 0 ) {
-                i0 = static_cast<int32_t>( F32_SIGN_MASK );
-            }
-            else if ( 0 != i0 ) {
-                i0 = static_cast<int32_t>( 0x3F800000 );
-            }
-            else {
-                /*nothing to do here*/
-            }
-            ret = bit_cast<float>( i0 );
-        }
-        else {
-            const int32_t i = 0x007FFFFF >> j0;
-            if ( 0 != ( i0 & i ) ) {
-                if ( i0 > 0 ) {
-                    i0 += 0x00800000 >> j0;
-                }
-                i0 &= (~i);
-                ret = bit_cast<float>( i0 );
-            }
-        }
-    }
-    /*cstat +MISRAC++2008-5-0-21 +ATH-neg-check-nonneg +ATH-shift-neg +CERT-INT34-C_c*/
-    return ret;
-}
-/*============================================================================*/
-float ffmath::trunc( float x )
-{
-    const int32_t i0 = bit_cast<int32_t>( x );
-    int32_t sx, j0;
-    float ret = x;
-    /*cstat -MISRAC++2008-5-0-21 -ATH-neg-check-nonneg -ATH-shift-neg -CERT-INT34-C_c*/
-    sx = i0 & static_cast<int32_t>( F32_SIGN_MASK );
-    j0 = ( ( i0 >> 23 ) & 0xFF ) - 0x7F;
-    if ( j0 < 23 ) {
-        const int32_t tmp = ( j0 < 0 ) ? sx : ( sx | ( i0 & ~( 0x007FFFFF >> j0 ) ) );
-        ret = bit_cast<float>( tmp );
-    }
-    /*cstat +MISRAC++2008-5-0-21 +ATH-neg-check-nonneg +ATH-shift-neg +CERT-INT34-C_c*/
-    return ret;
-}
-/*============================================================================*/
-float ffmath::frac( float x )
-{
-    return x - ffmath::trunc( x );
-}
-/*============================================================================*/
 float ffmath::rem( float x,
                    float y )
 {
@@ -736,46 +510,6 @@ float ffmath::lerp( float a,
     return y;
 }
 /*============================================================================*/
-float ffmath::normalize( const float x,
-                         const float xMin,
-                         const float xMax ) noexcept
-{
-    return ( x - xMin )/( xMax - xMin );
-}
-/*============================================================================*/
-float ffmath::map(  const float x,
-                    const float xMin,
-                    const float xMax,
-                    const float yMin,
-                    const float yMax ) noexcept
-{
-    return ( ( yMax - yMin )*ffmath::normalize( x, xMin, xMax ) ) + yMin;
-}
-/*============================================================================*/
-bool ffmath::inRangeCoerce( float &x,
-                            const float lowerL,
-                            const float upperL ) noexcept
-{
-    bool retVal = false;
-
-    if ( ffmath::isNan( x ) ) {
-        x = lowerL;
-    }
-    else {
-        if ( x < lowerL ) {
-            x = lowerL;
-        }
-        else if ( x > upperL ) {
-            x = upperL;
-        }
-        else {
-            retVal = true;
-        }
-    }
-
-    return retVal;
-}
-/*============================================================================*/
 bool ffmath::inPolygon( const float x,
                         const float y,
                         const float * const px,
@@ -2955,3 +2689,452 @@ float ffmath::sph_legendre( size_t l,
     }
     return y;
 }
+/*============================================================================*/
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __aarch64__ ) || defined( __ARM_NEON ) )
+    #define FFMATH_BATCH_SIMD
+#endif
+
+/*! @cond */
+namespace {
+    #if defined( FFMATH_BATCH_SIMD )
+        /*The kernels below are written once with the GCC vector extensions and
+        instantiated for every lane width. They replicate the exact sequence of
+        floating-point operations of the scalar functions above so the results
+        are bitwise identical.*/
+        /*the kernels write their result through a reference instead of
+        returning it, so no wide vector is ever returned by a function built
+        without AVX and GCC has no ABI note to emit*/
+        #define FFMATH_INLINE   inline __attribute__( ( always_inline ) )
+        /*keep the same rounding of the scalar versions on targets with FMA*/
+        #if defined( __clang__ )
+            #define FFMATH_KERNEL( isa )    __attribute__( ( target( isa ) ) )
+            #define FFMATH_KERNEL_BASE      /*EMPTY MACRO*/
+        #else
+            #define FFMATH_KERNEL( isa )    __attribute__( ( target( isa ), optimize( "fp-contract=off" ) ) )
+            #define FFMATH_KERNEL_BASE      __attribute__( ( optimize( "fp-contract=off" ) ) )
+        #endif
+
+        template<size_t N>
+        struct lanes {
+            typedef float f __attribute__( ( vector_size( N*sizeof(float) ) ) );
+            typedef int32_t i __attribute__( ( vector_size( N*sizeof(float) ) ) );
+            typedef uint32_t u __attribute__( ( vector_size( N*sizeof(float) ) ) );
+        };
+
+        template<typename V, typename I>
+        FFMATH_INLINE void vSelect( V &r, const I &m, const V &a, const V &b )
+        {
+            r = reinterpret_cast<V>( ( reinterpret_cast<I>( a ) & m ) | ( reinterpret_cast<I>( b ) & ~m ) );
+        }
+        template<typename V, typename I>
+        FFMATH_INLINE void vConst( V &r, const uint32_t bits )
+        {
+            r = reinterpret_cast<V>( I{} + static_cast<int32_t>( bits ) );
+        }
+        template<typename V, typename I>
+        FFMATH_INLINE void vAbs( V &r, const V &x )
+        {
+            r = reinterpret_cast<V>( reinterpret_cast<I>( x ) & static_cast<int32_t>( F32_NO_SIGN_MASK ) );
+        }
+        /*same as ffmath::floor() for |x| < 2^31*/
+        template<typename V, typename I>
+        FFMATH_INLINE void vFloor( V &r, const V &x )
+        {
+            const V t = __builtin_convertvector( __builtin_convertvector( x, I ), V );
+            vSelect<V, I>( r, t > x, t - 1.0F, t );
+        }
+        template<typename V, typename I>
+        FFMATH_INLINE void vExp2( V &r, const V &x )
+        {
+            V xc, ip, fp, y, c;
+            I ep_i;
+
+            /*clamp the argument so the conversions are always defined*/
+            vSelect<V, I>( xc, x < -127.0F, V{} - 127.0F, x );
+            vSelect<V, I>( xc, x > 128.0F, V{} + 128.0F, xc );
+            vFloor<V, I>( ip, xc + 0.5F );
+            fp = xc - ip;
+            ep_i = ( __builtin_convertvector( ip, I ) + 127 ) << 23;
+            y = V{} + 1.535336188319500e-4F;
+            y = ( y*fp ) + 1.339887440266574e-3F;
+            y = ( y*fp ) + 9.618437357674640e-3F;
+            y = ( y*fp ) + 5.550332471162809e-2F;
+            y = ( y*fp ) + 2.402264791363012e-1F;
+            y = ( y*fp ) + 6.931472028550421e-1F;
+            y = ( y*fp ) + 1.0F;
+            y *= reinterpret_cast<V>( ep_i );
+            /*NaN lanes fail both comparisons and propagate through fp as in the scalar version*/
+            vSelect<V, I>( y, x != x, x, y );
+            vConst<V, I>( c, 0x7F800000U );
+            vSelect<V, I>( y, x > 128.0F, c, y );
+            vSelect<V, I>( r, x <= -126.0F, V{}, y );
+        }
+        template<typename V, typename I>
+        FFMATH_INLINE void vLog2( V &r, const V &x )
+        {
+            const I val_i = reinterpret_cast<I>( x );
+            I ip = ( val_i & 2139095040 ) >> 23;
+            V y = reinterpret_cast<V>( ( val_i & 8388607 ) | 1065353216 );
+            const I big = y > ffmath::FFP_SQRT2;
+            V px, z, c;
+
+            ip -= 127;
+            vSelect<V, I>( y, big, y*0.5F, y );
+            ip -= big; /*comparison lanes are -1 when true*/
+            y -= 1.0F;
+            px = V{} + 7.0376836292e-2F;
+            px = ( px*y ) - 1.1514610310e-1F;
+            px = ( px*y ) + 1.1676998740e-1F;
+            px = ( px*y ) - 1.2420140846e-1F;
+            px = ( px*y ) + 1.4249322787e-1F;
+            px = ( px*y ) - 1.6668057665e-1F;
+            px = ( px*y ) + 2.0000714765e-1F;
+            px = ( px*y ) - 2.4999993993e-1F;
+            px = ( px*y ) + 3.3333331174e-1F;
+            z = y*y;
+            z = ( y*z*px ) - ( 0.5F*z ) + y;
+            z *= ffmath::FFP_LOG2E;
+            z = __builtin_convertvector( ip, V ) + z;
+            vConst<V, I>( c, 0xFF800000U );
+            vSelect<V, I>( z, x == 0.0F, c, z );
+            vConst<V, I>( c, 0x7FBFFFFFU );
+            vSelect<V, I>( r, x < 0.0F, c, z );
+        }
+        template<typename V, typename I>
+        FFMATH_INLINE void vSin( V &r, const V &x0 )
+        {
+            V x = x0;
+            V y, a;
+
+            x *= -ffmath::FFP_1_PI;
+            y = x + 25165824.0F;
+            x -= y - 25165824.0F;
+            vAbs<V, I>( a, x );
+            x *= a - 1.0F;
+            vAbs<V, I>( a, x );
+            y = x*( ( 3.5841304553896F*a ) + 3.1039673861526F );
+            vAbs<V, I>( a, x0 );
+            vSelect<V, I>( r, a <= 0.0066F, x0, y );
+        }
+
+        struct opSqrt {
+            static float scalar( const float x ) { return ffmath::sqrt( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                U y = reinterpret_cast<U>( x );
+                V z, c;
+
+                y = ( ( y - 0x00800000U ) >> 1U ) + 0x20000000U;
+                z = reinterpret_cast<V>( y );
+                z = 0.5F*( ( x/z ) + z );
+                z = 0.5F*( ( x/z ) + z );
+                vSelect<V, I>( z, x == 0.0F, V{}, z );
+                vConst<V, I>( c, 0x7FBFFFFFU );
+                vSelect<V, I>( r, x < 0.0F, c, z );
+            }
+        };
+        struct opRSqrt {
+            static float scalar( const float x ) { return ffmath::rSqrt( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                const U y = 0x5F375A86U - ( reinterpret_cast<U>( x ) >> 1U );
+                const V z = 0.5F*x;
+                const V q = reinterpret_cast<V>( y );
+                V ret = q*( 1.5F - ( z*q*q ) );
+                V c;
+
+                vConst<V, I>( c, 0x7F800000U );
+                vSelect<V, I>( ret, x == 0.0F, c, ret );
+                vConst<V, I>( c, 0x7FBFFFFFU );
+                vSelect<V, I>( r, x < 0.0F, c, ret );
+            }
+        };
+        struct opSin {
+            static float scalar( const float x ) { return ffmath::sin( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                vSin<V, I>( r, x );
+            }
+        };
+        struct opCos {
+            static float scalar( const float x ) { return ffmath::cos( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                V d, s;
+
+                vAbs<V, I>( d, x );
+                vAbs<V, I>( d, d - ffmath::FFP_PI_2 );
+                vSin<V, I>( s, x + ffmath::FFP_PI_2 );
+                vSelect<V, I>( r, d <= 1.175494351e-38F, V{} + 1.0e-12F, s );
+            }
+        };
+        struct opExp2 {
+            static float scalar( const float x ) { return ffmath::exp2( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                vExp2<V, I>( r, x );
+            }
+        };
+        struct opLog2 {
+            static float scalar( const float x ) { return ffmath::log2( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                vLog2<V, I>( r, x );
+            }
+        };
+        struct opExp {
+            static float scalar( const float x ) { return ffmath::exp( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                vExp2<V, I>( r, ffmath::FFP_LOG2E*x );
+            }
+        };
+        struct opLog {
+            static float scalar( const float x ) { return ffmath::log( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                V l;
+
+                vLog2<V, I>( l, x );
+                r = ffmath::FFP_LN2*l;
+            }
+        };
+        struct opTanh {
+            static float scalar( const float x ) { return ffmath::tanh( x ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &x )
+            {
+                V e;
+
+                vExp2<V, I>( e, ffmath::FFP_LOG2E*( -2.0F*x ) );
+                r = ( 1.0F - e )/( 1.0F + e );
+            }
+        };
+        struct opPow {
+            static float scalar( const float b, const float e ) { return ffmath::pow( b, e ); }
+            template<typename V, typename I, typename U>
+            static FFMATH_INLINE void apply( V &r, const V &b, const V &e )
+            {
+                V l;
+
+                vLog2<V, I>( l, b );
+                vExp2<V, I>( r, e*l );
+            }
+        };
+
+        template<typename Op, size_t N>
+        FFMATH_INLINE void batchLoop( const float * const in,
+                                      float * const out,
+                                      const size_t n )
+        {
+            typedef typename lanes<N>::f V;
+            typedef typename lanes<N>::i I;
+            typedef typename lanes<N>::u U;
+            size_t i = 0U;
+
+            for ( ; ( i + N ) <= n ; i += N ) {
+                V x, r;
+                (void)memcpy( &x, &in[ i ], sizeof(V) );
+                Op::template apply<V, I, U>( r, x );
+                (void)memcpy( &out[ i ], &r, sizeof(V) );
+            }
+            for ( ; i < n ; ++i ) {
+                out[ i ] = Op::scalar( in[ i ] );
+            }
+        }
+        template<typename Op, size_t N>
+        FFMATH_INLINE void batchLoop( const float * const in1,
+                                      const float * const in2,
+                                      float * const out,
+                                      const size_t n )
+        {
+            typedef typename lanes<N>::f V;
+            typedef typename lanes<N>::i I;
+            typedef typename lanes<N>::u U;
+            size_t i = 0U;
+
+            for ( ; ( i + N ) <= n ; i += N ) {
+                V x, y, r;
+                (void)memcpy( &x, &in1[ i ], sizeof(V) );
+                (void)memcpy( &y, &in2[ i ], sizeof(V) );
+                Op::template apply<V, I, U>( r, x, y );
+                (void)memcpy( &out[ i ], &r, sizeof(V) );
+            }
+            for ( ; i < n ; ++i ) {
+                out[ i ] = Op::scalar( in1[ i ], in2[ i ] );
+            }
+        }
+
+        #if defined( __x86_64__ )
+            enum class batchISA { SSE2, AVX2, AVX512 };
+
+            batchISA batchLevel( void ) noexcept
+            {
+                static const batchISA level = ( __builtin_cpu_init(),
+                                                ( 0 != __builtin_cpu_supports( "avx512f" ) ) ? batchISA::AVX512 :
+                                                ( 0 != __builtin_cpu_supports( "avx2" ) ) ? batchISA::AVX2 : batchISA::SSE2 );
+                return level;
+            }
+            template<typename Op, typename... Args>
+            FFMATH_KERNEL( "avx512f" ) void batchAVX512( Args... args )
+            {
+                batchLoop<Op, 16U>( args... );
+            }
+            template<typename Op, typename... Args>
+            FFMATH_KERNEL( "avx2" ) void batchAVX2( Args... args )
+            {
+                batchLoop<Op, 8U>( args... );
+            }
+            template<typename Op, typename... Args>
+            FFMATH_KERNEL_BASE void batchSSE2( Args... args )
+            {
+                batchLoop<Op, 4U>( args... );
+            }
+            template<typename Op, typename... Args>
+            void batch( Args... args ) noexcept
+            {
+                switch ( batchLevel() ) {
+                    case batchISA::AVX512:
+                        batchAVX512<Op>( args... );
+                        break;
+                    case batchISA::AVX2:
+                        batchAVX2<Op>( args... );
+                        break;
+                    default:
+                        batchSSE2<Op>( args... );
+                        break;
+                }
+            }
+        #else
+            template<typename Op, typename... Args>
+            FFMATH_KERNEL_BASE void batch( Args... args ) noexcept
+            {
+                batchLoop<Op, 4U>( args... );
+            }
+        #endif
+        #undef FFMATH_INLINE
+        #undef FFMATH_KERNEL
+        #undef FFMATH_KERNEL_BASE
+    #else
+        template<float (*fcn)( float )>
+        struct op1 {
+            static float scalar( const float x ) { return fcn( x ); }
+        };
+        template<float (*fcn)( float, float )>
+        struct op2 {
+            static float scalar( const float x, const float y ) { return fcn( x, y ); }
+        };
+        using opSqrt = op1<&ffmath::sqrt>;
+        using opRSqrt = op1<&ffmath::rSqrt>;
+        using opSin = op1<&ffmath::sin>;
+        using opCos = op1<&ffmath::cos>;
+        using opExp2 = op1<&ffmath::exp2>;
+        using opLog2 = op1<&ffmath::log2>;
+        using opExp = op1<&ffmath::exp>;
+        using opLog = op1<&ffmath::log>;
+        using opTanh = op1<&ffmath::tanh>;
+        using opPow = op2<&ffmath::pow>;
+
+        template<typename Op>
+        void batch( const float * const in,
+                    float * const out,
+                    const size_t n ) noexcept
+        {
+            for ( size_t i = 0U ; i < n ; ++i ) {
+                out[ i ] = Op::scalar( in[ i ] );
+            }
+        }
+        template<typename Op>
+        void batch( const float * const in1,
+                    const float * const in2,
+                    float * const out,
+                    const size_t n ) noexcept
+        {
+            for ( size_t i = 0U ; i < n ; ++i ) {
+                out[ i ] = Op::scalar( in1[ i ], in2[ i ] );
+            }
+        }
+    #endif
+}
+/*! @endcond */
+
+/*============================================================================*/
+void ffmath::sqrt( const float * const in,
+                   float * const out,
+                   const size_t n ) noexcept
+{
+    batch<opSqrt>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::rSqrt( const float * const in,
+                    float * const out,
+                    const size_t n ) noexcept
+{
+    batch<opRSqrt>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::sin( const float * const in,
+                  float * const out,
+                  const size_t n ) noexcept
+{
+    batch<opSin>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::cos( const float * const in,
+                  float * const out,
+                  const size_t n ) noexcept
+{
+    batch<opCos>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::exp2( const float * const in,
+                   float * const out,
+                   const size_t n ) noexcept
+{
+    batch<opExp2>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::log2( const float * const in,
+                   float * const out,
+                   const size_t n ) noexcept
+{
+    batch<opLog2>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::exp( const float * const in,
+                  float * const out,
+                  const size_t n ) noexcept
+{
+    batch<opExp>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::log( const float * const in,
+                  float * const out,
+                  const size_t n ) noexcept
+{
+    batch<opLog>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::tanh( const float * const in,
+                   float * const out,
+                   const size_t n ) noexcept
+{
+    batch<opTanh>( in, out, n );
+}
+/*============================================================================*/
+void ffmath::pow( const float * const b,
+                  const float * const e,
+                  float * const out,
+                  const size_t n ) noexcept
+{
+    batch<opPow>( b, e, out, n );
+}
+/*============================================================================*/
@@ -0,0 +1,1554 @@
+#include <include/ffmath.hpp>
+
+/*
+Double-precision overloads of ffmath. The kernels are written for the 64-bit
+IEEE 754 format: table driven reductions with the significant parts carried
+as hi + lo pairs, so the results keep the full precision ( about 1 ULP, a
+few ULP for tanh, erf and erfc ) without using <cmath>.
+*/
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __SSE2__ ) || defined( __aarch64__ ) )
+    /*the square root instruction is correctly rounded, use it when present*/
+    #define FFMATH_DOUBLE_HW_SQRT
+    #if defined( __SSE2__ )
+        #include <emmintrin.h>
+    #endif
+#endif
+
+using namespace qlibs;
+
+#if defined( FFMATH_DOUBLE_SUPPORT )
+
+namespace {
+    /*cstat -MISRAC++2008-5-0-21 -CERT-INT34-C_c -ATH-shift-neg -CERT-FLP36-C -CERT-FLP34-C -MISRAC++2008-0-1-4_b*/
+    inline double asDouble( const uint64_t u ) noexcept
+    {
+        return ffmath::impl::bitCast<double>( u );
+    }
+    inline uint64_t asBits( const double x ) noexcept
+    {
+        return ffmath::impl::bitCast<uint64_t>( x );
+    }
+    inline double absolute( const double x ) noexcept
+    {
+        return asDouble( asBits( x ) & 0x7FFFFFFFFFFFFFFFU );
+    }
+    inline double copySign( const double mag,
+                            const double sgn ) noexcept
+    {
+        return asDouble( ( asBits( mag ) & 0x7FFFFFFFFFFFFFFFU ) | ( asBits( sgn ) & 0x8000000000000000U ) );
+    }
+    inline bool isZero( const double x ) noexcept
+    {
+        return 0U == ( asBits( x ) & 0x7FFFFFFFFFFFFFFFU );
+    }
+    inline bool isNanOrInf( const double x ) noexcept
+    {
+        return ( asBits( x ) & 0x7FF0000000000000U ) == 0x7FF0000000000000U;
+    }
+    inline bool isNan( const double x ) noexcept
+    {
+        return ( asBits( x ) & 0x7FFFFFFFFFFFFFFFU ) > 0x7FF0000000000000U;
+    }
+    inline bool isOne( const double x ) noexcept
+    {
+        return 0x3FF0000000000000U == asBits( x );
+    }
+    /*upper 26 bits of the significand of x*/
+    inline double upperHalf( const double x ) noexcept
+    {
+        return asDouble( asBits( x ) & 0xFFFFFFFFF8000000U );
+    }
+    /*s + err = a + b exactly*/
+    inline double twoSum( const double a,
+                          const double b,
+                          double &err ) noexcept
+    {
+        const double s = a + b;
+        const double bb = s - a;
+        err = ( a - ( s - bb ) ) + ( b - bb );
+        return s;
+    }
+    /*same as twoSum, valid when the exponent of a is not below the one of b*/
+    inline double fastTwoSum( const double a,
+                              const double b,
+                              double &err ) noexcept
+    {
+        const double s = a + b;
+        err = ( a - s ) + b;
+        return s;
+    }
+    /*p + err = a*b exactly (Dekker)*/
+    inline double twoProd( const double a,
+                           const double b,
+                           double &err ) noexcept
+    {
+        const double p = a*b;
+    #if defined( __FP_FAST_FMA ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+        err = __builtin_fma( a, b, -p );
+    #else
+        const double ah = upperHalf( a );
+        const double al = a - ah;
+        const double bh = upperHalf( b );
+        const double bl = b - bh;
+        err = ( ( ( ( ah*bh ) - p ) + ( ah*bl ) ) + ( al*bh ) ) + ( al*bl );
+    #endif
+        return p;
+    }
+
+    constexpr double SHIFT = 6755399441055744.0; /*1.5*2^52, rounds to integer when added*/
+    constexpr double HUGE_VALUE = 1.0e300;
+
+    /*2^(j/64) as hi + lo*/
+    const double EXP_T_HI[ 64 ] = {
+        1.0, 1.0108892860517005, 1.0218971486541166, 1.0330248790212284,
+        1.0442737824274138, 1.0556451783605572, 1.0671404006768237, 1.0787607977571199,
+        1.0905077326652577, 1.102382583307841, 1.1143867425958924, 1.1265216186082418,
+        1.1387886347566916, 1.1511892299529827, 1.1637248587775775, 1.1763969916502812,
+        1.189207115002721, 1.202156731452703, 1.215247359980469, 1.22848053610687,
+        1.241857812073484, 1.255380757024691, 1.2690509571917332, 1.2828700160787783,
+        1.2968395546510096, 1.3109612115247644, 1.3252366431597413, 1.339667524053303,
+        1.3542555469368927, 1.3690024229745905, 1.383909881963832, 1.3989796725383112,
+        1.4142135623730951, 1.42961333839197, 1.4451808069770467, 1.460917794180647,
+        1.4768261459394993, 1.4929077282912648, 1.5091644275934228, 1.5255981507445384,
+        1.5422108254079407, 1.559004400237837, 1.5759808451078865, 1.593142151342267,
+        1.6104903319492543, 1.6280274218573478, 1.645755478153965, 1.6636765803267364,
+        1.681792830507429, 1.7001063537185235, 1.718619298122478, 1.7373338352737062,
+        1.7562521603732995, 1.7753764925265212, 1.7947090750031072, 1.8142521755003989,
+        1.8340080864093424, 1.8539791250833855, 1.8741676341103, 1.8945759815869656,
+        1.9152065613971474, 1.9360617934922943, 1.9571441241754002, 1.978456026387951
+    };
+    const double EXP_T_LO[ 64 ] = {
+        0.0, -1.5234778603368577e-17, 5.109225028973444e-17, 7.600838874027088e-18,
+        8.551889705537965e-17, 1.759325738772092e-18, -7.899853966841582e-17, -6.656660436056593e-17,
+        -3.046782079812471e-17, 5.2660368715706944e-17, 1.0410278456845571e-16, 5.165856758795457e-17,
+        8.912812676025408e-17, 3.250710218863827e-17, 3.8292048369240935e-17, 5.554203254218079e-17,
+        3.982015231465646e-17, 6.644981499252301e-17, -7.712630692681488e-17, -1.89878163130253e-17,
+        4.658027591836937e-17, -6.7113898212968784e-18, 2.667932131342186e-18, 1.713594918243561e-17,
+        2.5382502794888315e-17, -7.181536135519454e-17, -2.8587312100388614e-17, 8.927282594831732e-17,
+        7.70094837980299e-17, 9.593797919118849e-17, -6.770511658794786e-17, -9.614213209051323e-17,
+        -9.667293313452913e-17, -1.2031642489053655e-17, -3.0237581349939873e-17, -5.600377186075216e-17,
+        -3.483994556892796e-17, 1.4192920154284036e-17, -1.016455327754295e-16, -1.1024941712342561e-16,
+        7.949834809697621e-17, 3.7812070533575275e-17, -1.0136916471278304e-17, -1.0094406542311964e-16,
+        2.4707192569797888e-17, -6.712955084707084e-17, -1.0125679913674773e-16, 5.8909926967131e-17,
+        8.199010020581497e-17, -8.0237193703977e-18, -1.851380418263111e-17, 3.164389299292957e-17,
+        2.960140695448873e-17, 6.429731796556572e-17, 1.8227458427912087e-17, -9.969531538920349e-17,
+        3.283107224245627e-17, 9.761887490727594e-17, -6.122763413004143e-17, 3.4034035352165297e-17,
+        -1.0619946056195963e-16, 1.0332385960676326e-16, 8.960767791036668e-17, 4.0388753109278167e-17
+    };
+    constexpr double INV_LN2N = 92.332482616893657;             /*64/ln2*/
+    constexpr double LN2N_HI = 0.010830424696223417;            /*ln2/64, 36 bits*/
+    constexpr double LN2N_LO = 2.5728046223276691e-14;
+    constexpr double INV_L10N = 212.60339807279118;             /*64/log10(2)*/
+    constexpr double L10N_HI = 0.0047035936822794611;           /*log10(2)/64, 36 bits*/
+    constexpr double L10N_LO = -2.9754888229944178e-14;
+    constexpr double LN2 = 0.69314718055994529;
+    constexpr double LN2_LO = 2.3190468138462996e-17;
+    constexpr double LN2_HI32 = 0.69314718060195446;            /*ln2, 32 bits*/
+    constexpr double LN2_LO32 = -4.2009150726810846e-11;
+    constexpr double LN10 = 2.3025850929940459;
+    constexpr double LOG2E = 1.4426950408889634;
+    constexpr double LOG2E_LO = 2.0355273740931033e-17;
+    constexpr double LOG10E = 0.43429448190325182;
+    constexpr double LOG10E_LO = 1.0983196502167651e-17;
+    constexpr double LOG10_2_HI32 = 0.30102999566588551;        /*log10(2), 32 bits*/
+    constexpr double LOG10_2_LO32 = -1.9043128467164274e-12;
+
+    /*2^(k/64)*exp(r), with |r| <= ln2/128*/
+    double exp_core( const int32_t k,
+                     const double r,
+                     const double rl )
+    {
+        const uint32_t j = static_cast<uint32_t>( k ) & 63U;
+        const int32_t e = k >> 6;
+        const double p = r + ( ( r*r )*( 0.49999999999935363 + ( r*( 0.16666666666657431 + ( r*( 0.041666730227614517 + ( r*0.0083333424134674587 ) ) ) ) ) ) );
+        const double y = EXP_T_HI[ j ] + ( EXP_T_LO[ j ] + ( EXP_T_HI[ j ]*( p + rl ) ) );
+        double s;
+
+        if ( e > -1022 ) {
+            s = asDouble( asBits( y ) + ( static_cast<uint64_t>( static_cast<int64_t>( e ) ) << 52U ) );
+        }
+        else { /*subnormal result*/
+            s = asDouble( asBits( y ) + ( static_cast<uint64_t>( static_cast<int64_t>( e + 1000 ) ) << 52U ) );
+            s *= 9.3326361850321888e-302; /*2^-1000*/
+        }
+
+        return s;
+    }
+    int32_t roundToInt( const double x,
+                        double &k )
+    {
+        const double t = x + SHIFT;
+        k = t - SHIFT;
+        return static_cast<int32_t>( static_cast<int64_t>( asBits( t ) & 0x000FFFFFFFFFFFFFU ) - 0x0008000000000000 );
+    }
+    /*exp( x + xl ) with xl a small correction of x*/
+    double exp_kernel( const double x,
+                       const double xl )
+    {
+        double y;
+
+        if ( isNan( x ) ) {
+            y = x + x;
+        }
+        else if ( x > 709.78271289338397 ) {
+            y = HUGE_VALUE*HUGE_VALUE;
+        }
+        else if ( x < -745.13321910194122 ) {
+            y = 0.0;
+        }
+        else {
+            double kd;
+            const int32_t k = roundToInt( x*INV_LN2N, kd );
+            const double r = ( ( x - ( kd*LN2N_HI ) ) + xl ) - ( kd*LN2N_LO );
+            y = exp_core( k, r, 0.0 );
+        }
+
+        return y;
+    }
+
+    /*exp( r ) - 1 - r for |r| <= ln2/128, the Taylor series keeps the
+    accuracy relative to r that the exp polynomial does not need*/
+    double expm1_taylor( const double r )
+    {
+        return ( r*r )*( 0.5 + ( r*( 0.16666666666666666 + ( r*( 0.041666666666666664 + ( r*( 0.0083333333333333332 + ( r*0.0013888888888888889 ) ) ) ) ) ) ) );
+    }
+
+    /*exp( x )/2 for x >= 22, that is exp( x - ln2 ) with ln2 as hi + lo*/
+    double exp_half( const double x )
+    {
+        double e;
+        const double h = twoSum( x, -LN2, e );
+        return exp_kernel( h, e - LN2_LO );
+    }
+
+    /*tables for the logarithm: 1/c, with 10 significant bits, and -log(1/c) as hi + lo*/
+    const double LOG_INVC[ 128 ] = {
+        1.451171875, 1.44140625, 1.43359375, 1.42578125,
+        1.41796875, 1.41015625, 1.40234375, 1.39453125,
+        1.38671875, 1.380859375, 1.373046875, 1.365234375,
+        1.357421875, 1.3515625, 1.34375, 1.3359375,
+        1.330078125, 1.322265625, 1.31640625, 1.30859375,
+        1.302734375, 1.296875, 1.2890625, 1.283203125,
+        1.27734375, 1.26953125, 1.263671875, 1.2578125,
+        1.251953125, 1.24609375, 1.240234375, 1.234375,
+        1.228515625, 1.22265625, 1.216796875, 1.2109375,
+        1.205078125, 1.19921875, 1.193359375, 1.1875,
+        1.181640625, 1.177734375, 1.171875, 1.166015625,
+        1.16015625, 1.15625, 1.150390625, 1.14453125,
+        1.140625, 1.134765625, 1.130859375, 1.125,
+        1.12109375, 1.115234375, 1.111328125, 1.10546875,
+        1.1015625, 1.095703125, 1.091796875, 1.087890625,
+        1.08203125, 1.078125, 1.07421875, 1.068359375,
+        1.064453125, 1.060546875, 1.056640625, 1.05078125,
+        1.046875, 1.04296875, 1.0390625, 1.03515625,
+        1.029296875, 1.025390625, 1.021484375, 1.017578125,
+        1.013671875, 1.009765625, 1.005859375, 1.0,
+        1.0, 0.98828125, 0.98046875, 0.9736328125,
+        0.9658203125, 0.958984375, 0.9521484375, 0.9443359375,
+        0.9375, 0.9306640625, 0.923828125, 0.91796875,
+        0.9111328125, 0.904296875, 0.8984375, 0.8916015625,
+        0.8857421875, 0.8798828125, 0.8740234375, 0.8681640625,
+        0.8623046875, 0.8564453125, 0.8505859375, 0.8447265625,
+        0.8388671875, 0.833984375, 0.828125, 0.8232421875,
+        0.818359375, 0.8125, 0.8076171875, 0.802734375,
+        0.7978515625, 0.79296875, 0.7880859375, 0.783203125,
+        0.7783203125, 0.7734375, 0.7685546875, 0.7646484375,
+        0.759765625, 0.7548828125, 0.7509765625, 0.74609375,
+        0.7421875, 0.7373046875, 0.7333984375, 0.7294921875
+    };
+    const double LOG_LOGC_HI[ 128 ] = {
+        -0.3723714196782514, -0.3656191995609647, -0.3601844035750078, -0.35471990910292905,
+        -0.34922538978528833, -0.34370051385331846, -0.3381449440087164, -0.3325583373000766,
+        -0.32694034499585334, -0.32270604085706495, -0.31703226677115715, -0.3113261171943025,
+        -0.30558722052528436, -0.3012613305781618, -0.2954642128938359, -0.28963329258304266,
+        -0.2852376811100046, -0.2793466478727672, -0.2749054858727992, -0.26895308734550394,
+        -0.2644654208761159, -0.25995752443692605, -0.25391520998096345, -0.24935939344510272,
+        -0.24478272641769092, -0.238647737850175, -0.23402166946139277, -0.22937410106484582,
+        -0.22470483188116225, -0.2200136583052821, -0.21530037385318387, -0.21056476910734964,
+        -0.20580663166093274, -0.20102574606059073, -0.19622189374794535, -0.19139485299962947,
+        -0.18654439886588003, -0.18167030310763468, -0.17677233413208754, -0.17185025692665923,
+        -0.16690383299133368, -0.16359257168767766, -0.15860503017663857, -0.1535924883530943,
+        -0.14855469432313714, -0.1451820098444979, -0.14010155861207893, -0.13499516453750482,
+        -0.13157635778871926, -0.12642613181240345, -0.12297785253348746, -0.11778303565638346,
+        -0.11430477128005863, -0.10906458461650244, -0.10555580908682313, -0.10026945316367515,
+        -0.09672962645855111, -0.09139628048318853, -0.08782484811559138, -0.08424061488777623,
+        -0.07884006170777602, -0.07522342123758753, -0.07159365318700882, -0.06612417738247342,
+        -0.06246116962373629, -0.058784694894427655, -0.05509465380697374, -0.04953393512227663,
+        -0.0458095360312942, -0.04207121392068706, -0.0383188643021366, -0.034552381506659735,
+        -0.028875923501854542, -0.02507363755211596, -0.021256839025415118, -0.017425416713859134,
+        -0.013579258126380854, -0.009718249468921346, -0.005842275624228361, 0.0,
+        0.0, 0.01178795575204224, 0.01972450534777859, 0.026721035637614764,
+        0.03477747397674098, 0.04188049724498721, 0.04903433460160592, 0.05727331014615877,
+        0.06453852113757118, 0.07185690194525098, 0.07922923654757481, 0.08559193033540351,
+        0.09306660475210927, 0.10059757095327371, 0.1070981355563671, 0.11473592500448462,
+        0.12132935548431649, 0.12796654799111518, 0.13464808732459774, 0.14137457008554852,
+        0.1481466049954931, 0.15496481322727004, 0.1618298287469503, 0.16874229866757376,
+        0.17570288361519773, 0.18154061181088324, 0.18859116980755003, 0.19450484759759765,
+        0.20045370511737004, 0.2076393647782445, 0.2136671105757618, 0.21973141054327316,
+        0.22583271073945022, 0.23197146543777514, 0.2381481373295043, 0.2443631977329386,
+        0.25061712680923803, 0.2569104137850272, 0.2632435571820499, 0.26833910960865,
+        0.27474528142106147, 0.2811927570120311, 0.2863808360938091, 0.2929040164329326,
+        0.29815337231907635, 0.3047540563504284, 0.3100661538353183, 0.3154066204666358
+    };
+    const double LOG_LOGC_LO[ 128 ] = {
+        6.768796165584149e-19, 1.3629378153461892e-17, 9.183161098421605e-18, 2.5723845333224125e-17,
+        2.7353198661030995e-17, 1.2044907642022741e-17, 2.1615585875304225e-17, 1.0452065576244321e-17,
+        1.7491334247872663e-17, -2.4886685504283264e-17, 2.553561065361781e-17, 4.3785185679582705e-18,
+        1.726862063132527e-17, 9.048511144048564e-18, 2.16461086040599e-17, -2.0535953219858174e-17,
+        4.358829311824243e-20, -1.3154779699911696e-17, -2.2401714494357158e-17, -2.0567264884778372e-17,
+        -2.4580011601807535e-17, -2.069806938978935e-17, 8.048097394424201e-18, -9.925832304970219e-18,
+        -7.690455270851944e-19, 2.480208795706813e-18, -7.084735410896746e-18, -9.927671823978025e-18,
+        -7.036556313488362e-18, 1.0079574422441999e-17, 1.1102464888714096e-17, 4.249405314729895e-18,
+        2.9929664309192887e-18, -9.307006919883831e-18, -5.78647827985703e-18, 1.2129496905792884e-17,
+        5.2568157045427994e-18, 5.8870920167715034e-18, 4.1916460870394425e-19, 6.0224538210113705e-18,
+        5.807755616764237e-18, -7.057912917148893e-19, -1.1257003872182592e-17, 9.826977407254641e-19,
+        1.53995371858771e-19, -8.242418783022475e-18, 9.060680129479457e-18, -1.1344320488590788e-17,
+        -1.1123000879729588e-17, 3.3930485621794785e-18, 2.6556757566389632e-18, 1.1971685747593677e-18,
+        -5.1100358927720175e-18, 6.5439375965481166e-18, -3.768263496733737e-18, 1.9556371293694694e-18,
+        5.597397486289965e-19, -3.68557579677329e-18, 5.943776205117117e-18, -4.3010502267360414e-18,
+        -3.2379150876431256e-18, 5.930604196293241e-18, 3.804421579719008e-19, -6.273795438752119e-19,
+        -1.4978068596302668e-18, 1.907982501648531e-18, 1.3930782317464188e-18, -3.3991672076404202e-18,
+        -1.902959866474257e-18, 3.1329038365070074e-18, 2.357996157351286e-18, 1.6591063781278726e-18,
+        3.958237145953925e-19, -1.0436737280282193e-18, 1.4672122445753155e-18, 7.930339309600615e-19,
+        4.2564778893805965e-19, 5.4121446945839194e-20, 2.9977498684025744e-19, 0.0,
+        0.0, 2.208154666796622e-19, -1.3445979863167511e-18, 2.4017018471934056e-19,
+        -3.060000841238415e-18, -7.52116008109174e-19, 7.9623934450353815e-19, 1.888425434562252e-18,
+        -6.470486661692933e-18, 6.369938849679815e-18, 3.844009567382204e-18, 6.769872319991152e-18,
+        -6.2751506126151326e-18, 3.4358803555888985e-18, -1.73705104015906e-18, 3.133194996976324e-18,
+        1.703415659519968e-18, 3.803220994744838e-18, -1.3819481250435849e-17, -1.653263372270787e-18,
+        -1.126863437412071e-17, 1.1052352542205131e-17, 1.0150283350211873e-17, 1.3574674264207443e-17,
+        -7.382877329480907e-18, -9.164261232838093e-18, -7.432164219196925e-18, -8.854209877020327e-18,
+        1.3565866902520394e-17, 1.2053243216686129e-17, -1.3090964866019104e-17, 1.3474032480672356e-17,
+        -4.65212066772356e-18, 5.774320510479237e-18, 1.8557572450635336e-18, -4.008556524537438e-18,
+        2.154355146939517e-17, 2.502843296152504e-17, -2.503790597780922e-17, 8.951977297695414e-18,
+        2.0578963926931158e-17, 1.882811300010522e-17, 2.053227672517892e-17, -2.097144388760612e-17,
+        -1.720695867445866e-17, -1.3134476873147405e-17, 2.4390036934383104e-17, -2.40660082921959e-17
+    };
+    /*for a positive finite x, returns k and log( x/2^k ) as hi + lo*/
+    double log_kernel( const double x,
+                       int32_t &k,
+                       double &lo )
+    {
+        uint64_t ix = asBits( x );
+        int32_t k0 = 0;
+
+        if ( ix < 0x0010000000000000U ) { /*subnormal*/
+            ix = asBits( x*4503599627370496.0 ); /*2^52*/
+            k0 = -52;
+        }
+        /*x = 2^k*z, with z in [0.6875, 1.375)*/
+        const uint64_t tmp = ix - 0x3FE6000000000000U;
+        const uint32_t i = static_cast<uint32_t>( tmp >> 45U ) & 127U;
+        const double z = asDouble( ix - ( tmp & 0xFFF0000000000000U ) );
+        /*z*invc - 1 = uh + ul exactly, invc has 10 bits*/
+        const double zh = asDouble( asBits( z ) & 0xFFFFFFFFFFFFFC00U );
+        const double uh = ( zh*LOG_INVC[ i ] ) - 1.0;
+        const double ul = ( z - zh )*LOG_INVC[ i ];
+        double e1;
+        /*|uh| never exceeds the exponent of a nonzero log(c)*/
+        const double hi = fastTwoSum( LOG_LOGC_HI[ i ], uh, e1 );
+        /*log1p(u) = u - u^2/2 + u^3*q(u), q evaluated in two halves*/
+        const double z2 = uh*uh;
+        const double qa = 0.33333333333333331 + ( uh*( -0.25000000000000605 + ( uh*( 0.20000000000001106 + ( uh*-0.16666666616024528 ) ) ) ) );
+        const double qb = 0.14285714223452037 + ( uh*( -0.12501276448519755 + ( uh*0.11112411387705814 ) ) );
+        const double q = qa + ( ( z2*z2 )*qb );
+        /*ul/(1 + uh) is the contribution of ul*/
+        const double t = ( ( ( e1 + LOG_LOGC_LO[ i ] ) + ( ul*( ( 1.0 - uh ) + z2 ) ) ) + ( z2*( uh*q ) ) ) - ( 0.5*z2 );
+        const double y = hi + t;
+
+        lo = ( hi - y ) + t;
+        k = static_cast<int32_t>( static_cast<int64_t>( tmp ) >> 52 ) + k0;
+        return y;
+    }
+    /*log(x) as hi + lo for a positive finite x*/
+    double log_full( const double x,
+                     double &lo )
+    {
+        int32_t k;
+        double l, e;
+        const double h = log_kernel( x, k, l );
+        const double kd = static_cast<double>( k );
+        /*|h| < ln2/2, so the sum is exact for any k*/
+        const double y = fastTwoSum( kd*LN2_HI32, h, e );
+        const double t = e + ( l + ( kd*LN2_LO32 ) );
+        const double s = y + t;
+
+        lo = ( y - s ) + t;
+        return s;
+    }
+    /*NaN, -inf or +inf for the arguments out of the domain of the logarithms*/
+    bool log_special( const double x,
+                      double &y )
+    {
+        bool special = true;
+
+        if ( ( asBits( x ) - 0x0010000000000000U ) < 0x7FE0000000000000U ) { /*positive normal*/
+            special = false;
+        }
+        else if ( isNan( x ) ) {
+            y = x + x;
+        }
+        else if ( isZero( x ) ) {
+            y = -HUGE_VALUE*HUGE_VALUE;
+        }
+        else if ( x < 0.0 ) {
+            y = ( x - x )/( x - x );
+        }
+        else if ( isNanOrInf( x ) ) {
+            y = x;
+        }
+        else { /*positive subnormal*/
+            special = false;
+        }
+
+        return special;
+    }
+
+    /*x^y = exp( y*log( x ) ) for a positive finite x, with log( x ) as hi + lo*/
+    double pow_kernel( const double x,
+                       const double y )
+    {
+        double ll, e;
+        const double lh = log_full( x, ll );
+        const double yh = twoProd( y, lh, e );
+
+        return exp_kernel( yh, e + ( y*ll ) );
+    }
+    /*0 for non integer values, 1 for odd integers and 2 for even integers*/
+    int integerKind( const double y )
+    {
+        int kind;
+        const uint64_t iy = asBits( y ) & 0x7FFFFFFFFFFFFFFFU;
+        const int32_t ex = static_cast<int32_t>( iy >> 52U ) - 1023;
+
+        if ( ex > 52 ) {
+            kind = ( iy < 0x7FF0000000000000U ) ? 2 : 0;
+        }
+        else if ( ex < 0 ) {
+            kind = ( 0U == iy ) ? 2 : 0;
+        }
+        else {
+            const uint64_t frac = 0x000FFFFFFFFFFFFFU >> static_cast<uint32_t>( ex );
+            if ( 0U != ( iy & frac ) ) {
+                kind = 0;
+            }
+            else {
+                const uint64_t unit = ( 1ULL << 52U ) >> static_cast<uint32_t>( ex );
+                kind = ( 0U != ( ( iy | 0x0010000000000000U ) & unit ) ) ? 1 : 2;
+            }
+        }
+
+        return kind;
+    }
+
+    /*2/pi, 32 bits per word*/
+    const uint32_t TWO_OVER_PI[ 40 ] = {
+        0xA2F9836EU, 0x4E441529U, 0xFC2757D1U, 0xF534DDC0U, 0xDB629599U, 0x3C439041U, 0xFE5163ABU, 0xDEBBC561U,
+        0xB7246E3AU, 0x424DD2E0U, 0x06492EEAU, 0x09D1921CU, 0xFE1DEB1CU, 0xB129A73EU, 0xE88235F5U, 0x2EBB4484U,
+        0xE99C7026U, 0xB45F7E41U, 0x3991D639U, 0x835339F4U, 0x9C845F8BU, 0xBDF9283BU, 0x1FF897FFU, 0xDE05980FU,
+        0xEF2F118BU, 0x5A0A6D1FU, 0x6D367ECFU, 0x27CB09B7U, 0x4F463F66U, 0x9E5FEA2DU, 0x7527BAC7U, 0xEBE5F17BU,
+        0x3D0739F7U, 0x8A5292EAU, 0x6BFB5FB1U, 0x1F8D5D08U, 0x56033046U, 0xFC7B6BABU, 0xF0CFBC20U, 0x9AF4361DU
+    };
+    constexpr double INV_PIO2 = 0.63661977236758138;
+    constexpr double PIO2_1 = 1.5707963267341256;     /*first 33 bits of pi/2*/
+    constexpr double PIO2_2 = 6.077100506303966e-11;  /*next 33 bits of pi/2*/
+    constexpr double PIO2_3 = 2.0222662487111665e-21; /*next 33 bits of pi/2*/
+    constexpr double PIO2_3T = 8.4784276603688996e-32;
+    constexpr double PIO2_1T = 6.077100506506192e-11;  /*pi/2 - PIO2_1*/
+    constexpr double PIO2_HI = 1.5707963267948966;
+    constexpr double PIO2_LO = 6.123233995736766e-17;
+    constexpr double PI_HI = 3.1415926535897931;
+    constexpr double PI_LO = 1.2246467991473532e-16;
+
+    /*bits [pos, pos + 64) of the little-endian number in w*/
+    uint64_t bitsAt( const uint32_t * const w,
+                     const uint32_t pos )
+    {
+        const uint32_t i = pos >> 5U;
+        const uint32_t b = pos & 31U;
+        uint64_t v = ( static_cast<uint64_t>( w[ i + 1U ] ) << 32U ) | w[ i ];
+
+        v >>= b;
+        if ( 0U != b ) {
+            v |= static_cast<uint64_t>( w[ i + 2U ] ) << ( 64U - b );
+        }
+
+        return v;
+    }
+    /*Payne-Hanek reduction of a large positive x, returns the quadrant*/
+    int32_t rem_pio2_large( const double x,
+                            double &hi,
+                            double &lo )
+    {
+        const uint64_t ix = asBits( x );
+        /*x = m*2^ex, with m an integer of 53 bits*/
+        const int32_t ex = static_cast<int32_t>( ix >> 52U ) - 1075;
+        const uint64_t m = ( ix & 0x000FFFFFFFFFFFFFU ) | 0x0010000000000000U;
+        /*the bits of 2/pi before i0 only add multiples of 4*/
+        const int32_t i0 = ( ex >= 2 ) ? ( ex - 1 ) : 1;
+        const uint32_t sh = static_cast<uint32_t>( i0 + 191 - ex );
+        const uint32_t o = static_cast<uint32_t>( i0 - 1 );
+        const uint32_t wi = o >> 5U;
+        const uint32_t wb = o & 31U;
+        uint32_t win[ 6 ];
+        uint32_t p[ 9 ] = { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+        uint64_t carry = 0U;
+        const uint64_t m0 = m & 0xFFFFFFFFU;
+        const uint64_t m1 = m >> 32U;
+
+        /*192 bits of 2/pi starting at i0, little-endian*/
+        for ( uint32_t k = 0U ; k < 6U ; ++k ) {
+            const uint32_t a = TWO_OVER_PI[ wi + 5U - k ];
+            win[ k ] = ( 0U == wb ) ? a : ( ( a << wb ) | ( TWO_OVER_PI[ wi + 6U - k ] >> ( 32U - wb ) ) );
+        }
+        /*p = m*win*/
+        for ( uint32_t k = 0U ; k < 6U ; ++k ) {
+            const uint64_t t = ( m0*win[ k ] ) + carry;
+            p[ k ] = static_cast<uint32_t>( t );
+            carry = t >> 32U;
+        }
+        p[ 6 ] = static_cast<uint32_t>( carry );
+        carry = 0U;
+        for ( uint32_t k = 0U ; k < 6U ; ++k ) {
+            const uint64_t t = ( m1*win[ k ] ) + p[ k + 1U ] + carry;
+            p[ k + 1U ] = static_cast<uint32_t>( t );
+            carry = t >> 32U;
+        }
+        p[ 7 ] = static_cast<uint32_t>( carry );
+        /*x*2/pi = p*2^-sh, quadrant and 128 bits of the fraction*/
+        int32_t q = static_cast<int32_t>( bitsAt( p, sh ) & 3U );
+        uint64_t f1 = bitsAt( p, sh - 64U );
+        uint64_t f2 = bitsAt( p, sh - 128U );
+        double sign = 1.0;
+
+        if ( 0U != ( f1 & 0x8000000000000000U ) ) { /*fraction >= 1/2, take it from the next quadrant*/
+            f1 = ~f1;
+            f2 = ~f2 + 1U;
+            f1 += ( 0U == f2 ) ? 1U : 0U;
+            sign = -1.0;
+            ++q;
+        }
+        const double fh = static_cast<double>( f1 >> 11U )*1.1102230246251565e-16; /*2^-53*/
+        const double fl = ( static_cast<double>( f1 & 0x7FFU ) + ( static_cast<double>( f2 >> 11U )*1.1102230246251565e-16 ) )*5.4210108624275222e-20; /*2^-64*/
+        double e;
+        const double rh = twoProd( fh, PIO2_HI, e );
+        const double rl = e + ( ( fh*PIO2_LO ) + ( fl*PIO2_HI ) );
+
+        hi = rh + rl;
+        lo = sign*( ( rh - hi ) + rl );
+        hi *= sign;
+        return q & 3;
+    }
+    /*x = n*pi/2 + ( hi + lo ) with |hi| <= pi/4, returns n*/
+    int32_t rem_pio2( const double x,
+                      double &hi,
+                      double &lo )
+    {
+        int32_t n;
+        const double ax = absolute( x );
+
+        if ( ax <= 0.78539816339744828 ) {
+            hi = x;
+            lo = 0.0;
+            n = 0;
+        }
+        else if ( ax < 1647099.0 ) { /*2^20*pi/2, n*PIO2_k are exact*/
+            double nd;
+            n = roundToInt( x*INV_PIO2, nd );
+            const double a = x - ( nd*PIO2_1 );
+            const double w = nd*PIO2_1T;
+            hi = a - w;
+            /*two terms of pi/2 are enough unless the result lost 16 bits*/
+            if ( ( ( asBits( x ) >> 52U ) & 0x7FFU ) > ( ( ( asBits( hi ) >> 52U ) & 0x7FFU ) + 16U ) ) {
+                double e1, e2;
+                const double y1 = twoSum( a, -( nd*PIO2_2 ), e1 );
+                const double y2 = twoSum( y1, -( nd*PIO2_3 ), e2 );
+                const double t = ( e1 + e2 ) - ( nd*PIO2_3T );
+                hi = y2 + t;
+                lo = ( y2 - hi ) + t;
+            }
+            else {
+                lo = ( a - hi ) - w;
+            }
+        }
+        else {
+            n = rem_pio2_large( ax, hi, lo );
+            if ( x < 0.0 ) {
+                hi = -hi;
+                lo = -lo;
+                n = -n;
+            }
+        }
+
+        return n;
+    }
+    /*sin( x + y ) for |x| <= pi/4, with its rounding error in lo*/
+    double sin_kernel( const double x,
+                       const double y,
+                       double &lo )
+    {
+        const double z = x*x;
+        const double s = z*( -0.16666666666666666 + ( z*( 0.0083333333333309011 + ( z*( -0.00019841269836691415 + ( z*( 2.7557316069785486e-06 + ( z*( -2.5051125351534291e-08 + ( z*1.5917680840872135e-10 ) ) ) ) ) ) ) ) ) );
+        const double t = ( x*s ) + ( y*( 1.0 - ( 0.5*z ) ) );
+        const double h = x + t;
+
+        lo = ( x - h ) + t;
+        return h;
+    }
+    /*cos( x + y ) for |x| <= pi/4, with its rounding error in lo*/
+    double cos_kernel( const double x,
+                       const double y,
+                       double &lo )
+    {
+        const double z = x*x;
+        const double c = ( z*z )*( 0.041666666666666664 + ( z*( -0.0013888888888887372 + ( z*( 2.4801587298730561e-05 + ( z*( -2.7557317254347364e-07 + ( z*( 2.0876142781733164e-09 + ( z*-1.1382389088226901e-11 ) ) ) ) ) ) ) ) ) );
+        const double hz = 0.5*z;
+        const double w = 1.0 - hz;
+        const double t = ( ( ( 1.0 - w ) - hz ) + c ) - ( x*y );
+        const double h = w + t;
+
+        lo = ( w - h ) + t;
+        return h;
+    }
+
+    /*atan of the reduction points 0.5, 1, 1.5 and inf as hi + lo*/
+    const double ATAN_HI[ 4 ] = { 0.46364760900080609, 0.78539816339744828, 0.98279372324732905, 1.5707963267948966 };
+    const double ATAN_LO[ 4 ] = { 2.2698777452961687e-17, 3.061616997868383e-17, 1.3903311031230998e-17, 6.123233995736766e-17 };
+    /*atan( ax + axl ) for ax >= 0 as hi + lo, axl being a tiny correction of ax*/
+    double atan_kernel( const double ax,
+                        const double axl,
+                        double &lo )
+    {
+        double hi;
+
+        if ( ax >= 7.3786976294838206e+19 ) { /*2^66*/
+            hi = PIO2_HI;
+            lo = PIO2_LO;
+        }
+        else if ( ax < 3.7252902984619141e-09 ) { /*2^-28*/
+            hi = ax;
+            lo = axl;
+        }
+        else {
+            int32_t id;
+            double t;
+
+            if ( ax < 0.4375 ) {
+                id = -1;
+                t = ax;
+            }
+            else if ( ax < 0.6875 ) {
+                id = 0;
+                t = ( ( 2.0*ax ) - 1.0 )/( 2.0 + ax );
+            }
+            else if ( ax < 1.1875 ) {
+                id = 1;
+                t = ( ax - 1.0 )/( ax + 1.0 );
+            }
+            else if ( ax < 2.4375 ) {
+                id = 2;
+                t = ( ax - 1.5 )/( 1.0 + ( 1.5*ax ) );
+            }
+            else {
+                id = 3;
+                t = -1.0/ax;
+            }
+            /*atan(t) = t + t^3*a(t^2)*/
+            const double z = t*t;
+            const double a = -0.33333333333333331 + ( z*( 0.19999999999999998 + ( z*( -0.14285714285713377 + ( z*( 0.11111111110789083 + ( z*( -0.090909090491130759 + ( z*( 0.076923051347854224 + ( z*( -0.066665814706869331 + ( z*( 0.058806716326423876 + ( z*( -0.052425636176651531 + ( z*( 0.046025071139055095 + ( z*( -0.035751674698681984 + ( z*0.017442350126351945 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) );
+            /*first order contribution of axl*/
+            const double d = axl/( 1.0 + ( ax*ax ) );
+            const double p = ( t*( z*a ) ) + d;
+            double b, tl;
+
+            if ( id < 0 ) {
+                b = t;
+                tl = p;
+            }
+            else {
+                const uint32_t i = static_cast<uint32_t>( id );
+                b = ATAN_HI[ i ];
+                tl = ( p + ATAN_LO[ i ] ) + t;
+            }
+            hi = b + tl;
+            lo = ( b - hi ) + tl;
+        }
+
+        return hi;
+    }
+    /*( asin( sqrt( z ) ) - sqrt( z ) )/( z*sqrt( z ) ) for z in [0, 1/4]*/
+    double asin_poly( const double z )
+    {
+        const double z2 = z*z;
+        const double z4 = z2*z2;
+        const double pa = 0.16666666666666669 + ( z*( 0.074999999999983361 + ( z*( 0.044642857146542106 + ( z*0.030381944124484982 ) ) ) ) );
+        const double pb = 0.022372173487590432 + ( z*( 0.017352380235304672 + ( z*( 0.01397139401819187 + ( z*0.011477450386344824 ) ) ) ) );
+        const double pc = 0.01033379852542911 + ( z*( 0.005411383964603864 + ( z*( 0.017523651469835626 + ( z*( -0.015039561637531212 + ( z*0.028883331268708522 ) ) ) ) ) ) );
+        return pa + ( z4*( pb + ( z4*pc ) ) );
+    }
+    /*asin( sqrt( z ) ) as s + t, where s is the rounded square root*/
+    double asin_root( const double z,
+                      double &t )
+    {
+        double e;
+        const double s = ffmath::sqrt( z );
+        const double p = twoProd( s, s, e );
+        t = ( s > 0.0 ) ? ( ( ( ( z - p ) - e )/( s + s ) ) + ( s*( z*asin_poly( z ) ) ) ) : 0.0;
+        return s;
+    }
+
+    /*erf(x)/x in x^2 for |x| < 0.5*/
+    double erf_small( const double x )
+    {
+        const double z = x*x;
+        return x*( 1.1283791670955126 + ( z*( -0.37612638903183754 + ( z*( 0.11283791670955118 + ( z*( -0.026866170645120563 + ( z*( 0.0052239776248789631 + ( z*( -0.00085483268821389389 + ( z*( 0.0001205531390987703 + ( z*( -1.492418658181356e-05 + ( z*( 1.6398084395743472e-06 + ( z*-1.4871780790677851e-07 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) );
+    }
+    double horner( const double * const c,
+                   const size_t n,
+                   const double t )
+    {
+        double p = c[ n - 1U ];
+
+        for ( size_t i = n - 1U ; i > 0U ; --i ) {
+            p = c[ i - 1U ] + ( t*p );
+        }
+
+        return p;
+    }
+    /*erfc(x)*exp(x^2) on [0.5, 4) in powers of x - mid*/
+    const double ERFC_P0[ 16 ] = { /*[0.5, 1.25), mid 0.875*/
+        0.46431158320266902, -0.31583389649084181, 0.18795692377318343, -0.10091439212620336,
+        0.049828415331224708, -0.022925811484590396, 0.0099227767694820054, -0.004069537660467127,
+        0.0015904825838890034, -0.00059508116213371749, 0.00021396104570256408, -7.4158231115742826e-05,
+        2.4813982451111954e-05, -8.0589457534673228e-06, 2.6754264134890267e-06, -8.1113280052470592e-07
+    };
+    const double ERFC_P1[ 15 ] = { /*[1.25, 2), mid 1.625*/
+        0.30226120936348594, -0.14603023666418338, 0.064962074784187959, -0.026977910093244562,
+        0.010561485441329467, -0.0039261985010034034, 0.0013938042926575206, -0.00047464755936788992,
+        0.00015562549336172515, -4.9279477062303812e-05, 1.5109422635021348e-05, -4.4926211696607594e-06,
+        1.300045997537999e-06, -3.8104435468504684e-07, 1.0410989774568561e-07
+    };
+    const double ERFC_P2[ 15 ] = { /*[2, 3), mid 2.5*/
+        0.21080636406114359, -0.074347346789794724, 0.024937997086656873, -0.0080015693820939225,
+        0.0024670368157024255, -0.00073359093747143067, 0.00021101982429438482, -5.8868958366635968e-05,
+        1.5961852450711133e-05, -4.214357740812232e-06, 1.0852322677478952e-06, -2.726303062813949e-07,
+        6.7079817705493107e-08, -1.7021687825645784e-08, 3.995496691298715e-09
+    };
+    const double ERFC_P3[ 14 ] = { /*[3, 4), mid 3.5*/
+        0.1552936556088943, -0.041323577833252488, 0.010661133192510112, -0.0026730744396436801,
+        0.00065268632690860867, -0.00015546891822906729, 3.6181703648581132e-05, -8.2379864720398874e-06,
+        1.8371959870644513e-06, -4.017410551687357e-07, 8.6172104685087705e-08, -1.8168223317163506e-08,
+        3.9046145759880267e-09, -7.9382244001012031e-10
+    };
+    /*x*erfc(x)*exp(x^2) in powers of 1/x^2 - mid*/
+    const double ERFC_K0[ 11 ] = { /*[4, 6), mid 0.046875*/
+        0.55180204620956352, -0.24818261098674901, 0.31072429101013305, -0.60587116683963382,
+        1.5544104269658727, -4.842088603352221, 17.480658902867575, -70.958781477449747,
+        316.58836894764215, -1567.6121500525387, 9188.4966142158482
+    };
+    const double ERFC_K1[ 11 ] = { /*[6, 27.3), mid 0.015625*/
+        0.5598813296070474, -0.26959440628200643, 0.37841505049215507, -0.86118305295855468,
+        2.6719545451969564, -10.389792498745079, 48.175608701870779, -257.73462474348776,
+        1551.6584084355127, -10653.948139837095, 86748.87180103187
+    };
+    /*erfc(x) for x >= 0.5*/
+    double erfc_large( const double x )
+    {
+        double y;
+
+        if ( x >= 27.3 ) {
+            y = 0.0;
+        }
+        else {
+            double f;
+            /*exp(-x^2) with x^2 as hi + lo*/
+            double sl;
+            const double sh = twoProd( x, x, sl );
+
+            if ( x < 1.25 ) {
+                f = horner( ERFC_P0, 16U, x - 0.875 );
+            }
+            else if ( x < 2.0 ) {
+                f = horner( ERFC_P1, 15U, x - 1.625 );
+            }
+            else if ( x < 3.0 ) {
+                f = horner( ERFC_P2, 15U, x - 2.5 );
+            }
+            else if ( x < 4.0 ) {
+                f = horner( ERFC_P3, 14U, x - 3.5 );
+            }
+            else {
+                const double w = 1.0/( x*x );
+                f = ( x < 6.0 ) ? horner( ERFC_K0, 11U, w - 0.046875 ) : horner( ERFC_K1, 11U, w - 0.015625 );
+                f /= x;
+            }
+            y = exp_kernel( -sh, -sl )*f;
+        }
+
+        return y;
+    }
+    /*cstat +MISRAC++2008-5-0-21 +CERT-INT34-C_c +ATH-shift-neg +CERT-FLP36-C +CERT-FLP34-C +MISRAC++2008-0-1-4_b*/
+}
+
+/*cstat -CERT-FLP34-C -MISRAC++2008-5-0-21*/
+/*============================================================================*/
+double ffmath::sqrt( double x )
+{
+    double y;
+
+#if defined( FFMATH_DOUBLE_HW_SQRT )
+    #if defined( __SSE2__ )
+        y = _mm_cvtsd_f64( _mm_sqrt_sd( _mm_set_sd( x ), _mm_set_sd( x ) ) );
+    #else
+        __asm__( "fsqrt %d0, %d1" : "=w"( y ) : "w"( x ) );
+    #endif
+#else
+    if ( isNan( x ) || isZero( x ) ) {
+        y = x + x;
+    }
+    else if ( x < 0.0 ) {
+        y = ( x - x )/( x - x );
+    }
+    else if ( isNanOrInf( x ) ) {
+        y = x;
+    }
+    else {
+        const bool sub = asBits( x ) < 0x0010000000000000U;
+        const double a = sub ? ( x*18014398509481984.0 ) : x; /*2^54*/
+        double r = asDouble( 0x5FE6EB50C7B537A9U - ( asBits( a ) >> 1U ) );
+        double e;
+
+        for ( int i = 0 ; i < 4 ; ++i ) {
+            r *= 1.5 - ( ( 0.5*a )*( r*r ) );
+        }
+        y = a*r;
+        const double s2 = twoProd( y, y, e );
+        y += ( ( ( a - s2 ) - e )*( 0.5*r ) );
+        y = sub ? ( y*7.4505805969238281e-09 ) : y; /*2^-27*/
+    }
+#endif
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::rSqrt( double x )
+{
+    return 1.0/ffmath::sqrt( x );
+}
+/*============================================================================*/
+double ffmath::cbrt( double x )
+{
+    double y;
+
+    if ( isNanOrInf( x ) || isZero( x ) ) {
+        y = x + x;
+    }
+    else {
+        const double ax = absolute( x );
+        const bool sub = asBits( ax ) < 0x0010000000000000U;
+        const double a = sub ? ( ax*18014398509481984.0 ) : ax; /*2^54*/
+        /*initial guess from the exponent, then Newton iterations*/
+        const uint32_t hx = static_cast<uint32_t>( asBits( a ) >> 32U );
+        double r = asDouble( static_cast<uint64_t>( ( hx/3U ) + 715094163U ) << 32U );
+
+        for ( int i = 0 ; i < 4 ; ++i ) {
+            r = r - ( ( r - ( a/( r*r ) ) )*0.33333333333333331 );
+        }
+        y = sub ? ( r*3.814697265625e-06 ) : r; /*2^-18*/
+        y = copySign( y, x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::rounding( double x )
+{
+    double y = ffmath::trunc( x );
+
+    if ( ffmath::absf( x - y ) >= 0.5 ) {
+        y += ffmath::copysign( 1.0, x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::rem( double x,
+                    double y )
+{
+    return ( isZero( y ) ) ? ( y - y )/( y - y )
+                           : ( x - ( y*ffmath::trunc( x/y ) ) );
+}
+/*============================================================================*/
+double ffmath::mod( double x,
+                    double y )
+{
+    double m;
+
+    if ( isZero( y ) ) {
+        m = x;
+    }
+    else {
+        m = x - ( y*ffmath::floor( x/y ) );
+        if ( y > 0.0 ) {
+            if ( m >= y ) {
+                m = 0.0;
+            }
+            else if ( m < 0.0 ) {
+                const double tmp = y + m;
+                m = ( absolute( tmp - y ) <= DBL_MIN ) ? 0.0 : tmp;
+            }
+            else {
+                /*nothing to do here*/
+            }
+        }
+        else {
+            if ( m <= y ) {
+                m = 0.0;
+            }
+            else if ( m > 0.0 ) {
+                const double tmp = y + m;
+                m = ( absolute( tmp - y ) <= DBL_MIN ) ? 0.0 : tmp;
+            }
+            else {
+                /*nothing to do here*/
+            }
+        }
+    }
+
+    return m;
+}
+/*============================================================================*/
+double ffmath::sin( double x )
+{
+    double y;
+
+    if ( isNanOrInf( x ) ) {
+        y = x - x;
+    }
+    else {
+        double hi, lo, e;
+        const uint32_t n = static_cast<uint32_t>( rem_pio2( x, hi, lo ) ) & 3U;
+        y = ( 0U == ( n & 1U ) ) ? sin_kernel( hi, lo, e ) : cos_kernel( hi, lo, e );
+        y = ( n >= 2U ) ? -y : y;
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::cos( double x )
+{
+    double y;
+
+    if ( isNanOrInf( x ) ) {
+        y = x - x;
+    }
+    else {
+        double hi, lo, e;
+        const uint32_t n = static_cast<uint32_t>( rem_pio2( x, hi, lo ) ) & 3U;
+        y = ( 0U == ( n & 1U ) ) ? cos_kernel( hi, lo, e ) : sin_kernel( hi, lo, e );
+        y = ( ( 1U == n ) || ( 2U == n ) ) ? -y : y;
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::tan( double x )
+{
+    double y;
+
+    if ( isNanOrInf( x ) ) {
+        y = x - x;
+    }
+    else {
+        double hi, lo, sl, cl, e;
+        const uint32_t n = static_cast<uint32_t>( rem_pio2( x, hi, lo ) ) & 3U;
+        const double sh = sin_kernel( hi, lo, sl );
+        const double ch = cos_kernel( hi, lo, cl );
+        const bool odd = 0U != ( n & 1U );
+        /*( nh + nl )/( dh + dl ) with one correction of the quotient*/
+        const double nh = odd ? -ch : sh;
+        const double nl = odd ? -cl : sl;
+        const double dh = odd ? sh : ch;
+        const double dl = odd ? sl : cl;
+        const double q = nh/dh;
+        const double p = twoProd( q, dh, e );
+        y = q + ( ( ( ( nh - p ) - e ) + nl ) - ( q*dl ) )/dh;
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::asin( double x )
+{
+    double y;
+    const double ax = absolute( x );
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( ax > 1.0 ) {
+        y = ( x - x )/( x - x );
+    }
+    else if ( ax < 1.4901161193847656e-08 ) { /*2^-26*/
+        y = x;
+    }
+    else if ( ax < 0.5 ) {
+        const double z = x*x;
+        y = x + ( x*( z*asin_poly( z ) ) );
+    }
+    else {
+        /*asin(x) = pi/2 - 2*asin( sqrt( ( 1 - x )/2 ) )*/
+        double t, e;
+        const double s = asin_root( 0.5*( 1.0 - ax ), t );
+        const double h = fastTwoSum( PIO2_HI, -2.0*s, e );
+        y = copySign( h + ( ( e + PIO2_LO ) - ( 2.0*t ) ), x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::acos( double x )
+{
+    double y;
+    const double ax = absolute( x );
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( ax > 1.0 ) {
+        y = ( x - x )/( x - x );
+    }
+    else if ( ax < 0.5 ) {
+        double e;
+        const double h = fastTwoSum( PIO2_HI, -x, e );
+        const double z = x*x;
+        y = h + ( ( e + PIO2_LO ) - ( x*( z*asin_poly( z ) ) ) );
+    }
+    else {
+        /*acos(x) = 2*asin( sqrt( ( 1 - x )/2 ) ) and acos(-x) = pi - acos(x)*/
+        double t;
+        const double s = asin_root( 0.5*( 1.0 - ax ), t );
+
+        if ( x > 0.0 ) {
+            y = 2.0*( s + t );
+        }
+        else {
+            double e;
+            const double h = fastTwoSum( PI_HI, -2.0*s, e );
+            y = h + ( ( e + PI_LO ) - ( 2.0*t ) );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::atan( double x )
+{
+    double y;
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else {
+        double lo;
+        y = copySign( atan_kernel( absolute( x ), 0.0, lo ), x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::atan2( double y,
+                      double x )
+{
+    double r;
+    const bool xNeg = 0U != ( asBits( x ) & 0x8000000000000000U );
+
+    if ( isNan( x ) || isNan( y ) ) {
+        r = x + y;
+    }
+    else if ( isZero( y ) ) {
+        r = xNeg ? copySign( PI_HI, y ) : y;
+    }
+    else if ( isZero( x ) ) {
+        r = copySign( PIO2_HI, y );
+    }
+    else if ( isNanOrInf( x ) ) {
+        if ( isNanOrInf( y ) ) {
+            r = copySign( xNeg ? 2.3561944901923448 : 0.78539816339744828, y );
+        }
+        else {
+            r = copySign( xNeg ? PI_HI : 0.0, y );
+        }
+    }
+    else if ( isNanOrInf( y ) ) {
+        r = copySign( PIO2_HI, y );
+    }
+    else {
+        const double ax = absolute( x );
+        const double ay = absolute( y );
+        const double q = ay/ax;
+        double ql = 0.0;
+        double zl, e;
+
+        /*ql is the rounding error of the quotient*/
+        if ( ( q > 1.0e-290 ) && ( q < 7.3786976294838206e+19 ) && ( ax > 1.0e-290 ) && ( ay < 1.0e290 ) ) {
+            const double p = twoProd( q, ax, e );
+            ql = ( ( ay - p ) - e )/ax;
+        }
+        const double z = atan_kernel( q, ql, zl );
+        if ( xNeg ) {
+            const double h = twoSum( PI_HI, -z, e );
+            r = h + ( ( e + PI_LO ) - zl );
+        }
+        else {
+            r = z;
+        }
+        r = copySign( r, y );
+    }
+
+    return r;
+}
+/*============================================================================*/
+double ffmath::exp2( double x )
+{
+    double y;
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( x >= 1024.0 ) {
+        y = HUGE_VALUE*HUGE_VALUE;
+    }
+    else if ( x < -1075.0 ) {
+        y = 0.0;
+    }
+    else {
+        double kd;
+        const int32_t k = roundToInt( 64.0*x, kd );
+        const double d = x - ( 0.015625*kd ); /*exact*/
+        y = exp_core( k, d*LN2, d*LN2_LO );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::log2( double x )
+{
+    double y;
+
+    if ( !log_special( x, y ) ) {
+        int32_t k;
+        double lo;
+        double e, s;
+        const double hi = log_kernel( x, k, lo );
+        const double p = twoProd( hi, LOG2E, e );
+        /*|p| < 1/2, so the sum is exact for any k*/
+        const double h = fastTwoSum( static_cast<double>( k ), p, s );
+        y = h + ( s + ( e + ( ( lo*LOG2E ) + ( hi*LOG2E_LO ) ) ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::exp( double x )
+{
+    return exp_kernel( x, 0.0 );
+}
+/*============================================================================*/
+double ffmath::expm1( double x )
+{
+    double y;
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( x > 709.78271289338397 ) {
+        y = HUGE_VALUE*HUGE_VALUE;
+    }
+    else if ( x < -38.0 ) {
+        y = -1.0;
+    }
+    else if ( absolute( x ) < 5.5511151231257827e-17 ) { /*2^-54*/
+        y = x;
+    }
+    else {
+        double kd;
+        const int32_t k = roundToInt( x*INV_LN2N, kd );
+
+        if ( 0 == k ) {
+            y = x + expm1_taylor( x );
+        }
+        else {
+            /*r + rl = x - k*ln2/64, th*r is kept exact since it nearly
+            cancels with th - 1 when k is small*/
+            const double a = x - ( kd*LN2N_HI );
+            const double b = kd*LN2N_LO;
+            const double r = a - b;
+            const double rl = ( a - r ) - b;
+            const double q = expm1_taylor( r );
+            const uint32_t j = static_cast<uint32_t>( k ) & 63U;
+            const double s = asDouble( static_cast<uint64_t>( static_cast<int64_t>( ( k >> 6 ) + 1023 ) ) << 52U );
+            const double th = EXP_T_HI[ j ]*s;
+            const double tl = EXP_T_LO[ j ]*s;
+            double e1, e2;
+            const double pr = twoProd( th, r, e1 );
+            const double h = twoSum( th - 1.0, pr, e2 );
+            y = h + ( ( e2 + e1 ) + ( tl + ( th*( q + rl ) ) ) );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::exp10( double x )
+{
+    double y;
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( x > 308.25471555991675 ) {
+        y = HUGE_VALUE*HUGE_VALUE;
+    }
+    else if ( x < -323.60724533877976 ) {
+        y = 0.0;
+    }
+    else {
+        double kd;
+        const int32_t k = roundToInt( x*INV_L10N, kd );
+        const double d = ( x - ( kd*L10N_HI ) ) - ( kd*L10N_LO );
+        y = exp_core( k, d*LN10, 0.0 );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::log( double x )
+{
+    double y;
+
+    if ( !log_special( x, y ) ) {
+        double lo;
+        const double hi = log_full( x, lo );
+        y = hi + lo;
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::log1p( double x )
+{
+    double y;
+    const double u = 1.0 + x;
+
+    if ( isOne( u ) ) {
+        y = x;
+    }
+    else if ( !log_special( u, y ) ) {
+        double lo;
+        const double hi = log_full( u, lo );
+        /*log(1 + x) = log(u) + c/u, c being the rounding error of u*/
+        const double c = ( u > 2.0 ) ? ( 1.0 - ( u - x ) ) : ( x - ( u - 1.0 ) );
+        y = hi + ( lo + ( c/u ) );
+    }
+    else {
+        /*y already holds the result*/
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::log10( double x )
+{
+    double y;
+
+    if ( !log_special( x, y ) ) {
+        int32_t k;
+        double lo;
+        const double hi = log_kernel( x, k, lo );
+        const double kd = static_cast<double>( k );
+        y = ( kd*LOG10_2_HI32 ) + ( ( hi*LOG10E ) + ( ( ( lo*LOG10E ) + ( hi*LOG10E_LO ) ) + ( kd*LOG10_2_LO32 ) ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::pow( double x,
+                    double y )
+{
+    double r;
+    const double ax = absolute( x );
+
+    /*positive normal x and finite y, the usual case*/
+    if ( ( ( asBits( x ) - 0x0010000000000000U ) < 0x7FE0000000000000U ) && !isNanOrInf( y ) ) {
+        r = pow_kernel( ax, y );
+    }
+    else if ( isZero( y ) || isOne( x ) ) {
+        r = 1.0;
+    }
+    else if ( isNan( x ) || isNan( y ) ) {
+        r = x + y;
+    }
+    else {
+        const int yKind = integerKind( y );
+
+        if ( isZero( x ) ) {
+            r = ( y < 0.0 ) ? HUGE_VALUE*HUGE_VALUE : 0.0;
+            r = ( 1 == yKind ) ? copySign( r, x ) : r;
+        }
+        else if ( isNanOrInf( y ) ) {
+            if ( isOne( ax ) ) {
+                r = 1.0;
+            }
+            else {
+                r = ( ( ax < 1.0 ) == ( y < 0.0 ) ) ? y*y : 0.0;
+            }
+        }
+        else if ( isNanOrInf( x ) ) {
+            r = ( y < 0.0 ) ? 0.0 : ax;
+            r = ( ( 1 == yKind ) && ( x < 0.0 ) ) ? -r : r;
+        }
+        else if ( ( x < 0.0 ) && ( 0 == yKind ) ) {
+            r = ( x - x )/( x - x );
+        }
+        else {
+            r = pow_kernel( ax, y );
+            r = ( ( 1 == yKind ) && ( x < 0.0 ) ) ? -r : r;
+        }
+    }
+
+    return r;
+}
+/*============================================================================*/
+double ffmath::sinh( double x )
+{
+    double y;
+    const double ax = absolute( x );
+
+    if ( isNanOrInf( x ) ) {
+        y = x + x;
+    }
+    else if ( ax < 22.0 ) {
+        const double t = ffmath::expm1( ax );
+        y = ( ax < 1.0 ) ? ( ( 2.0*t ) - ( ( t*t )/( t + 1.0 ) ) ) : ( t + ( t/( t + 1.0 ) ) );
+        y = copySign( 0.5*y, x );
+    }
+    else {
+        y = copySign( exp_half( ax ), x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::cosh( double x )
+{
+    double y;
+    const double ax = absolute( x );
+
+    if ( isNanOrInf( x ) ) {
+        y = x*x;
+    }
+    else if ( ax < 0.34657359027997264 ) { /*ln2/2*/
+        const double t = ffmath::expm1( ax );
+        y = 1.0 + ( ( t*t )/( 2.0*( 1.0 + t ) ) );
+    }
+    else if ( ax < 22.0 ) {
+        const double t = exp_kernel( ax, 0.0 );
+        y = ( 0.5*t ) + ( 0.5/t );
+    }
+    else {
+        y = exp_half( ax );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::tanh( double x )
+{
+    double y;
+    const double ax = absolute( x );
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( ax < 2.7755575615628914e-17 ) { /*2^-55*/
+        y = x;
+    }
+    else if ( ax < 1.0 ) {
+        const double t = ffmath::expm1( -2.0*ax );
+        y = copySign( -t/( t + 2.0 ), x );
+    }
+    else if ( ax < 22.0 ) {
+        const double t = ffmath::expm1( 2.0*ax );
+        y = copySign( 1.0 - ( 2.0/( t + 2.0 ) ), x );
+    }
+    else {
+        y = copySign( 1.0, x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::asinh( double x )
+{
+    double y;
+    const double a = absolute( x );
+
+    if ( isNanOrInf( x ) || ( a < 3.7252902984619141e-09 ) ) { /*2^-28*/
+        y = x + x;
+    }
+    else {
+        if ( a > 268435456.0 ) { /*2^28*/
+            y = ffmath::log( a ) + LN2;
+        }
+        else if ( a > 2.0 ) {
+            y = ffmath::log( ( 2.0*a ) + ( 1.0/( ffmath::sqrt( ( a*a ) + 1.0 ) + a ) ) );
+        }
+        else {
+            const double t = a*a;
+            y = ffmath::log1p( a + ( t/( 1.0 + ffmath::sqrt( 1.0 + t ) ) ) );
+        }
+        y = copySign( y, x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::acosh( double x )
+{
+    double y;
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( x < 1.0 ) {
+        y = ( x - x )/( x - x );
+    }
+    else if ( x > 268435456.0 ) { /*2^28*/
+        y = ffmath::log( x ) + LN2;
+    }
+    else if ( x > 2.0 ) {
+        y = ffmath::log( ( 2.0*x ) - ( 1.0/( x + ffmath::sqrt( ( x*x ) - 1.0 ) ) ) );
+    }
+    else {
+        const double t = x - 1.0;
+        y = ffmath::log1p( t + ffmath::sqrt( ( 2.0*t ) + ( t*t ) ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::atanh( double x )
+{
+    double y;
+    const double a = absolute( x );
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( a > 1.0 ) {
+        y = ( x - x )/( x - x );
+    }
+    else if ( isOne( a ) ) {
+        y = x/0.0;
+    }
+    else if ( a < 0.5 ) {
+        const double t = a + a;
+        y = copySign( 0.5*ffmath::log1p( t + ( ( t*a )/( 1.0 - a ) ) ), x );
+    }
+    else {
+        y = copySign( 0.5*ffmath::log1p( ( a + a )/( 1.0 - a ) ), x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::erf( double x )
+{
+    double y;
+    const double ax = absolute( x );
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( ax < 0.5 ) {
+        y = erf_small( x );
+    }
+    else if ( ax < 6.0 ) {
+        y = copySign( 1.0 - erfc_large( ax ), x );
+    }
+    else {
+        y = copySign( 1.0, x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::erfc( double x )
+{
+    double y;
+    const double ax = absolute( x );
+
+    if ( isNan( x ) ) {
+        y = x + x;
+    }
+    else if ( ax < 0.5 ) {
+        y = 1.0 - erf_small( x );
+    }
+    else if ( x > 0.0 ) {
+        y = erfc_large( x );
+    }
+    else {
+        y = ( ax < 6.0 ) ? ( 2.0 - erfc_large( ax ) ) : 2.0;
+    }
+
+    return y;
+}
+/*============================================================================*/
+double ffmath::hypot( double x,
+                      double y )
+{
+    double r;
+    const double ax = absolute( x );
+    const double ay = absolute( y );
+
+    if ( isNanOrInf( x ) || isNanOrInf( y ) ) {
+        r = ( ( ax > DBL_MAX ) && !isNan( x ) ) ? ax :
+            ( ( ay > DBL_MAX ) && !isNan( y ) ) ? ay : x + y;
+    }
+    else {
+        double a = ( ax > ay ) ? ax : ay;
+        double b = ( ax > ay ) ? ay : ax;
+        double scale = 1.0;
+        double e1, e2;
+
+        if ( a > 3.2733906078961419e+150 ) { /*2^500*/
+            a *= 2.4099198651028841e-181; /*2^-600*/
+            b *= 2.4099198651028841e-181;
+            scale = 4.1495155688809929e+180; /*2^600*/
+        }
+        else if ( b < 3.0549363634996047e-151 ) { /*2^-500*/
+            a *= 4.1495155688809929e+180;
+            b *= 4.1495155688809929e+180;
+            scale = 2.4099198651028841e-181;
+        }
+        else {
+            /*nothing to do here*/
+        }
+        /*a^2 + b^2 as s + e, then one correction of the square root*/
+        const double p1 = twoProd( a, a, e1 );
+        const double p2 = twoProd( b, b, e2 );
+        const double s = p1 + p2;
+        const double e = ( ( ( p1 - s ) + p2 ) + e1 ) + e2;
+        r = ffmath::sqrt( s );
+        r = ( isZero( r ) ) ? r : ( r + ( e/( 2.0*r ) ) );
+        r *= scale;
+    }
+
+    return r;
+}
+/*============================================================================*/
+/*cstat +CERT-FLP34-C +MISRAC++2008-5-0-21*/
+
+#endif
@@ -0,0 +1,254 @@
+#include <include/ffmath.hpp>
+
+/*
+Fast tier of ffmath: minimax polynomials with a maximum relative error around
+1e-4, written with few branches so the compiler can keep them in registers
+and vectorize the loops that call them.
+*/
+
+using namespace qlibs;
+
+namespace {
+    /*cstat -MISRAC++2008-5-0-21 -CERT-INT34-C_c -ATH-shift-neg*/
+    /*round to nearest for |x| < 2^22 using the float mantissa, k gets the integer*/
+    inline float roundNear( const float x,
+                            int32_t &k ) noexcept
+    {
+        const float t = x + 12582912.0F;
+        k = ffmath::impl::bitCast<int32_t>( t ) - 0x4B400000;
+        return t - 12582912.0F;
+    }
+    /*changes the sign of x when k is odd*/
+    inline float oddFlip( const float x,
+                          const int32_t k ) noexcept
+    {
+        return ffmath::impl::bitCast<float>( ffmath::impl::bitCast<uint32_t>( x ) ^ ( static_cast<uint32_t>( k ) << 31U ) );
+    }
+    /*2^x for x in [-126, 128), relative error 7.5e-5*/
+    inline float exp2Core( const float x ) noexcept
+    {
+        int32_t k;
+        const float f = x - roundNear( x - 0.5F, k );
+        const float p = 0.999925220F + ( f*( 0.695833523F + ( f*( 0.226067169F + ( f*0.0780245274F ) ) ) ) );
+        return p*ffmath::impl::bitCast<float>( static_cast<uint32_t>( k + 127 ) << 23U );
+    }
+    /*log2(1 + f)/f for f in [-1/3, 1/3]*/
+    template <bool fine>
+    inline float log2Poly( const float f ) noexcept
+    {
+        return ( fine ) ? 1.44269483F + ( f*( -0.721379872F + ( f*( 0.480960931F + ( f*( -0.358389421F + ( f*( 0.285691793F + ( f*( -0.279993426F + ( f*0.246203835F ) ) ) ) ) ) ) ) ) ) )
+                        : 1.44270370F + ( f*( -0.720300429F + ( f*( 0.479372879F + ( f*( -0.397268133F + ( f*0.325629502F ) ) ) ) ) ) );
+    }
+    template <bool fine>
+    inline float log2Eval( const float x ) noexcept
+    {
+        float y;
+        uint32_t ix = ffmath::impl::bitCast<uint32_t>( x );
+
+        if ( x < 0.0F ) {
+            y = ffmath::getNan();
+        }
+        else if ( 0U == ( ix & 0x7FFFFFFFU ) ) {
+            y = -ffmath::getInf();
+        }
+        else if ( ix >= 0x7F800000U ) {
+            y = x; /*+inf or nan*/
+        }
+        else {
+            float k0 = 0.0F;
+            uint32_t tmp;
+            float f;
+
+            if ( ix < 0x00800000U ) { /*subnormal, normalize it first*/
+                ix = ffmath::impl::bitCast<uint32_t>( x*8388608.0F );
+                k0 = -23.0F;
+            }
+            /*x = 2^k*m with m in [2/3, 4/3)*/
+            tmp = ix - 0x3F2AAAABU;
+            f = ffmath::impl::bitCast<float>( ix - ( tmp & 0xFF800000U ) ) - 1.0F;
+            /*cstat -CERT-FLP36-C*/
+            y = k0 + static_cast<float>( ffmath::impl::bitCast<int32_t>( tmp ) >> 23 ) + ( f*log2Poly<fine>( f ) );
+            /*cstat +CERT-FLP36-C*/
+        }
+
+        return y;
+    }
+    /*atan(t) for t in [0, 1], relative error 3e-5*/
+    inline float atanPoly( const float t ) noexcept
+    {
+        const float z = t*t;
+        return t*( 0.999970036F + ( z*( -0.331700814F + ( z*( 0.185215516F + ( z*( -0.0919263213F + ( z*0.0238632812F ) ) ) ) ) ) ) );
+    }
+    /*cstat +MISRAC++2008-5-0-21 +CERT-INT34-C_c +ATH-shift-neg*/
+}
+
+/*============================================================================*/
+float ffmath::fast::exp2( float x )
+{
+    float y;
+
+    if ( x < -126.0F ) {
+        y = 0.0F;
+    }
+    else if ( x >= 128.0F ) {
+        y = ffmath::getInf();
+    }
+    else {
+        y = exp2Core( x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+float ffmath::fast::exp( float x )
+{
+    return ffmath::fast::exp2( ffmath::FFP_LOG2E*x );
+}
+/*============================================================================*/
+float ffmath::fast::exp10( float x )
+{
+    return ffmath::fast::exp2( 3.32192809F*x );
+}
+/*============================================================================*/
+float ffmath::fast::log2( float x )
+{
+    return log2Eval<false>( x );
+}
+/*============================================================================*/
+float ffmath::fast::log( float x )
+{
+    return ffmath::FFP_LN2*log2Eval<false>( x );
+}
+/*============================================================================*/
+float ffmath::fast::log10( float x )
+{
+    return ffmath::FFP_LOG10_2*log2Eval<false>( x );
+}
+/*============================================================================*/
+float ffmath::fast::pow( float b,
+                         float e )
+{
+    float y;
+
+    if ( classification::FFP_ZERO == ffmath::classify( e ) ) {
+        y = 1.0F;
+    }
+    else {
+        /*a finer logarithm here, its error is scaled by e*/
+        y = ffmath::fast::exp2( e*log2Eval<true>( b ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+float ffmath::fast::sin( float x )
+{
+    int32_t k;
+    /*x = k*pi + r, with r in [-pi/2, pi/2]*/
+    const float q = roundNear( ffmath::FFP_1_PI*x, k );
+    const float r = ( x - ( q*3.140625F ) ) - ( q*0.000967653585F );
+    const float z = r*r;
+    const float y = r*( 0.999999061F + ( z*( -0.166655541F + ( z*( 0.00831190002F + ( z*-0.000184881455F ) ) ) ) ) );
+
+    return oddFlip( y, k );
+}
+/*============================================================================*/
+float ffmath::fast::cos( float x )
+{
+    int32_t k;
+    /*x = ( k - 1/2 )*pi + r, with r in [-pi/2, pi/2]*/
+    const float q = roundNear( ( ffmath::FFP_1_PI*x ) + 0.5F, k ) - 0.5F;
+    const float r = ( x - ( q*3.140625F ) ) - ( q*0.000967653585F );
+    const float z = r*r;
+    const float y = r*( 0.999999061F + ( z*( -0.166655541F + ( z*( 0.00831190002F + ( z*-0.000184881455F ) ) ) ) ) );
+
+    return oddFlip( y, k );
+}
+/*============================================================================*/
+float ffmath::fast::tan( float x )
+{
+    int32_t k;
+    /*x = k*pi/2 + r, with r in [-pi/4, pi/4]*/
+    const float q = roundNear( ffmath::FFP_2_PI*x, k );
+    const float r = ( x - ( q*1.5703125F ) ) - ( q*0.000483826792F );
+    const float z = r*r;
+    const float s = r*( 0.999998493F + ( z*( -0.166623823F + ( z*0.00815005667F ) ) ) );
+    const float c = 0.999988217F + ( z*( -0.499685486F + ( z*0.0403622961F ) ) );
+    /*cstat -MISRAC++2008-5-0-21*/
+    return ( 0 != ( k & 1 ) ) ? -c/s : s/c;
+    /*cstat +MISRAC++2008-5-0-21*/
+}
+/*============================================================================*/
+float ffmath::fast::atan( float x )
+{
+    const float a = ffmath::absf( x );
+    float y;
+
+    if ( a > 1.0F ) {
+        y = ffmath::FFP_PI_2 - atanPoly( 1.0F/a );
+    }
+    else {
+        y = atanPoly( a );
+    }
+
+    return ffmath::copysign( y, x );
+}
+/*============================================================================*/
+float ffmath::fast::atan2( float y,
+                           float x )
+{
+    const float ax = ffmath::absf( x );
+    const float ay = ffmath::absf( y );
+    const float hi = ( ay > ax ) ? ay : ax;
+    const float lo = ( ay > ax ) ? ax : ay;
+    float a = 0.0F;
+
+    if ( hi > 0.0F ) {
+        a = atanPoly( lo/hi );
+        if ( ay > ax ) {
+            a = ffmath::FFP_PI_2 - a;
+        }
+        if ( x < 0.0F ) {
+            a = ffmath::FFP_PI - a;
+        }
+    }
+
+    return ffmath::copysign( a, y );
+}
+/*============================================================================*/
+float ffmath::fast::tanh( float x )
+{
+    const float a = ffmath::absf( x );
+    float y;
+
+    if ( a < 0.625F ) {
+        const float z = x*x;
+        y = x*( 0.999920750F + ( z*( -0.329621095F + ( z*0.106609832F ) ) ) );
+    }
+    else {
+        const float e = ffmath::fast::exp2( 2.88539008F*a );
+        y = ffmath::copysign( 1.0F - ( 2.0F/( e + 1.0F ) ), x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+float ffmath::fast::erf( float x )
+{
+    const float a = ffmath::absf( x );
+    float y;
+
+    if ( a < 0.5F ) {
+        const float z = x*x;
+        y = x*( 1.12836676F + ( z*( -0.375239088F + ( z*0.103267291F ) ) ) );
+    }
+    else {
+        /*Abramowitz and Stegun 7.1.26*/
+        const float t = 1.0F/( 1.0F + ( 0.3275911F*a ) );
+        const float p = t*( 0.254829592F + ( t*( -0.284496736F + ( t*( 1.421413741F + ( t*( -1.453152027F + ( t*1.061405429F ) ) ) ) ) ) ) );
+        y = ffmath::copysign( 1.0F - ( p*ffmath::fast::exp2( -ffmath::FFP_LOG2E*a*a ) ), x );
+    }
+
+    return y;
+}
+/*============================================================================*/
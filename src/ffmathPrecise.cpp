@@ -0,0 +1,265 @@
+#include <include/ffmath.hpp>
+
+/*
+Precise tier of ffmath: the functions are evaluated with the double-precision
+overloads, so the single-precision result is correctly rounded except in very
+rare cases and always within 1 ULP.
+*/
+
+using namespace qlibs;
+
+#if defined( FFMATH_DOUBLE_SUPPORT )
+
+/*cstat -CERT-FLP34-C*/
+/*============================================================================*/
+float ffmath::precise::sqrt( float x )
+{
+    return static_cast<float>( ffmath::sqrt( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::rSqrt( float x )
+{
+    return static_cast<float>( ffmath::rSqrt( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::cbrt( float x )
+{
+    return static_cast<float>( ffmath::cbrt( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::sin( float x )
+{
+    return static_cast<float>( ffmath::sin( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::cos( float x )
+{
+    return static_cast<float>( ffmath::cos( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::tan( float x )
+{
+    return static_cast<float>( ffmath::tan( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::asin( float x )
+{
+    return static_cast<float>( ffmath::asin( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::acos( float x )
+{
+    return static_cast<float>( ffmath::acos( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::atan( float x )
+{
+    return static_cast<float>( ffmath::atan( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::atan2( float y,
+                              float x )
+{
+    return static_cast<float>( ffmath::atan2( static_cast<double>( y ), static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::exp2( float x )
+{
+    return static_cast<float>( ffmath::exp2( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::log2( float x )
+{
+    return static_cast<float>( ffmath::log2( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::exp( float x )
+{
+    return static_cast<float>( ffmath::exp( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::expm1( float x )
+{
+    return static_cast<float>( ffmath::expm1( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::exp10( float x )
+{
+    return static_cast<float>( ffmath::exp10( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::log( float x )
+{
+    return static_cast<float>( ffmath::log( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::log1p( float x )
+{
+    return static_cast<float>( ffmath::log1p( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::log10( float x )
+{
+    return static_cast<float>( ffmath::log10( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::pow( float b,
+                            float e )
+{
+    return static_cast<float>( ffmath::pow( static_cast<double>( b ), static_cast<double>( e ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::sinh( float x )
+{
+    return static_cast<float>( ffmath::sinh( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::cosh( float x )
+{
+    return static_cast<float>( ffmath::cosh( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::tanh( float x )
+{
+    return static_cast<float>( ffmath::tanh( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::erf( float x )
+{
+    return static_cast<float>( ffmath::erf( static_cast<double>( x ) ) );
+}
+/*============================================================================*/
+float ffmath::precise::erfc( float x )
+{
+    return static_cast<float>( ffmath::erfc( static_cast<double>( x ) ) );
+}
+/*cstat +CERT-FLP34-C*/
+
+#else
+
+/*double is not binary64 on this target, use the default implementations*/
+/*============================================================================*/
+float ffmath::precise::sqrt( float x )
+{
+    return ffmath::sqrt( x );
+}
+/*============================================================================*/
+float ffmath::precise::rSqrt( float x )
+{
+    return 1.0F/ffmath::sqrt( x );
+}
+/*============================================================================*/
+float ffmath::precise::cbrt( float x )
+{
+    return ffmath::cbrt( x );
+}
+/*============================================================================*/
+float ffmath::precise::sin( float x )
+{
+    return ffmath::sin( x );
+}
+/*============================================================================*/
+float ffmath::precise::cos( float x )
+{
+    return ffmath::cos( x );
+}
+/*============================================================================*/
+float ffmath::precise::tan( float x )
+{
+    return ffmath::tan( x );
+}
+/*============================================================================*/
+float ffmath::precise::asin( float x )
+{
+    return ffmath::asin( x );
+}
+/*============================================================================*/
+float ffmath::precise::acos( float x )
+{
+    return ffmath::acos( x );
+}
+/*============================================================================*/
+float ffmath::precise::atan( float x )
+{
+    return ffmath::atan( x );
+}
+/*============================================================================*/
+float ffmath::precise::atan2( float y,
+                              float x )
+{
+    return ffmath::atan2( y, x );
+}
+/*============================================================================*/
+float ffmath::precise::exp2( float x )
+{
+    return ffmath::exp2( x );
+}
+/*============================================================================*/
+float ffmath::precise::log2( float x )
+{
+    return ffmath::log2( x );
+}
+/*============================================================================*/
+float ffmath::precise::exp( float x )
+{
+    return ffmath::exp( x );
+}
+/*============================================================================*/
+float ffmath::precise::expm1( float x )
+{
+    return ffmath::expm1( x );
+}
+/*============================================================================*/
+float ffmath::precise::exp10( float x )
+{
+    return ffmath::exp10( x );
+}
+/*============================================================================*/
+float ffmath::precise::log( float x )
+{
+    return ffmath::log( x );
+}
+/*============================================================================*/
+float ffmath::precise::log1p( float x )
+{
+    return ffmath::log1p( x );
+}
+/*============================================================================*/
+float ffmath::precise::log10( float x )
+{
+    return ffmath::log10( x );
+}
+/*============================================================================*/
+float ffmath::precise::pow( float b,
+                            float e )
+{
+    return ffmath::pow( b, e );
+}
+/*============================================================================*/
+float ffmath::precise::sinh( float x )
+{
+    return ffmath::sinh( x );
+}
+/*============================================================================*/
+float ffmath::precise::cosh( float x )
+{
+    return ffmath::cosh( x );
+}
+/*============================================================================*/
+float ffmath::precise::tanh( float x )
+{
+    return ffmath::tanh( x );
+}
+/*============================================================================*/
+float ffmath::precise::erf( float x )
+{
+    return ffmath::erf( x );
+}
+/*============================================================================*/
+float ffmath::precise::erfc( float x )
+{
+    return ffmath::erfc( x );
+}
+
+#endif
+/*============================================================================*/
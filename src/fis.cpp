@@ -1,8 +1,161 @@
 #include <include/fis.hpp>
+#include <include/ffmath.hpp>
 
 using namespace qlibs;
 
 const size_t fis::instance::INFERENCE_ERROR = 0U;
+
+namespace {
+    /*number of points of the output universe that are aggregated together*/
+    constexpr size_t FIS_GRID_BLOCK = 16U;
+    /*values of the input sets and rule strengths that the batch of an
+    instance keeps on the stack*/
+    constexpr size_t FIS_BATCH_AREA = 256U;
+    /*initial covariance of the least-squares estimate of the consequents*/
+    constexpr real_t FIS_TRAIN_COVARIANCE = 1000.0_re;
+    /*finite difference step of the rule strengths of a Mamdani system*/
+    constexpr real_t FIS_TRAIN_STEP = 0.001_re;
+
+    /*same result as fis::core::bound() on the [ 0, 1 ] range*/
+    inline real_t unitBound( const real_t y )
+    {
+        return ( y >= 0.0_re ) ? ( ( y > 1.0_re ) ? 1.0_re : y ) : 0.0_re;
+    }
+
+    /*linear interpolation on a table of n uniform samples, u is the
+    position in samples*/
+    inline real_t tableLookup( const real_t * const t,
+                               const size_t n,
+                               const real_t u )
+    {
+        size_t i = ( u > 0.0_re ) ? static_cast<size_t>( u ) : 0U;
+
+        i = ( i > ( n - 2U ) ) ? ( n - 2U ) : i;
+        return t[ i ] + ( ( u - static_cast<real_t>( i ) )*( t[ i + 1U ] - t[ i ] ) );
+    }
+
+    /*same result as fis::core::TriMF()*/
+    inline real_t triValue( const real_t * const p,
+                            const real_t x )
+    {
+        const real_t l = ( x - p[ 0 ] )/( p[ 1 ] - p[ 0 ] );
+        const real_t r = ( p[ 2 ] - x )/( p[ 2 ] - p[ 1 ] );
+        const real_t t = unitBound( ( l < r ) ? l : r );
+
+        return unitBound( ( t > 0.0_re ) ? t : 0.0_re );
+    }
+
+    /*same result as fis::core::TrapMF()*/
+    inline real_t trapValue( const real_t * const p,
+                             const real_t x )
+    {
+        const real_t l = ( x - p[ 0 ] )/( p[ 1 ] - p[ 0 ] );
+        const real_t r = ( p[ 3 ] - x )/( p[ 3 ] - p[ 2 ] );
+        real_t t = unitBound( ( l < 1.0_re ) ? l : 1.0_re );
+
+        t = unitBound( ( t < r ) ? t : r );
+        return unitBound( ( t > 0.0_re ) ? t : 0.0_re );
+    }
+    /*derivatives of ( x - a )/( b - a ) on a and b*/
+    inline void rampGradient( const real_t x,
+                              const real_t a,
+                              const real_t b,
+                              real_t * const g )
+    {
+        const real_t d = ( b - a )*( b - a );
+
+        g[ 0 ] = ( x - b )/d;
+        g[ 1 ] = ( a - x )/d;
+    }
+
+    /*derivatives of a Gaussian curve on its points, returns its value*/
+    inline real_t gaussGradient( const real_t x,
+                                 const real_t * const p,
+                                 real_t * const g )
+    {
+        const real_t u = ( x - p[ 1 ] )/p[ 0 ];
+        const real_t y = ffmath::exp( -0.5_re*u*u );
+
+        g[ 0 ] = y*u*u/p[ 0 ];
+        g[ 1 ] = y*u/p[ 0 ];
+
+        return y;
+    }
+
+    /*derivatives of a sigmoid on its points, returns its value*/
+    inline real_t sigGradient( const real_t x,
+                               const real_t * const p,
+                               real_t * const g )
+    {
+        const real_t y = 1.0_re/( 1.0_re + ffmath::exp( -p[ 0 ]*( x - p[ 1 ] ) ) );
+        const real_t k = y*( 1.0_re - y );
+
+        g[ 0 ] = k*( x - p[ 1 ] );
+        g[ 1 ] = -k*p[ 0 ];
+
+        return y;
+    }
+
+    /*derivatives of the S-shaped curve on its points, zero out of ( a, b )*/
+    inline void sGradient( const real_t x,
+                           const real_t * const p,
+                           real_t * const g )
+    {
+        g[ 0 ] = 0.0_re;
+        g[ 1 ] = 0.0_re;
+        if ( ( x > p[ 0 ] ) && ( x < p[ 1 ] ) ) {
+            const bool rising = ( x <= ( 0.5_re*( p[ 0 ] + p[ 1 ] ) ) );
+            const real_t t = ( x - ( ( rising ) ? p[ 0 ] : p[ 1 ] ) )/( p[ 1 ] - p[ 0 ] );
+            const real_t k = ( rising ) ? ( 4.0_re*t ) : ( -4.0_re*t );
+
+            rampGradient( x, p[ 0 ], p[ 1 ], g );
+            g[ 0 ] *= k;
+            g[ 1 ] *= k;
+        }
+    }
+
+    /*solves A*x = r in place, with A symmetric positive definite given on
+    its lower triangle. The Cholesky factor is kept transposed on the upper
+    triangle of A and its diagonal on dg*/
+    void choleskySolve( real_t * const A,
+                        real_t * const dg,
+                        real_t * const x,
+                        const size_t m )
+    {
+        for ( size_t j = 0U ; j < m ; ++j ) {
+            for ( size_t i = j ; i < m ; ++i ) {
+                real_t s = A[ ( i*m ) + j ];
+
+                for ( size_t k = 0U ; k < j ; ++k ) {
+                    s -= A[ ( k*m ) + i ]*A[ ( k*m ) + j ];
+                }
+                if ( i == j ) {
+                    dg[ j ] = ( s > 0.0_re ) ? ffmath::sqrt( s ) : 0.0_re;
+                }
+                else {
+                    A[ ( j*m ) + i ] = ( dg[ j ] > 0.0_re ) ? ( s/dg[ j ] ) : 0.0_re;
+                }
+            }
+        }
+        for ( size_t i = 0U ; i < m ; ++i ) {
+            real_t s = x[ i ];
+
+            for ( size_t k = 0U ; k < i ; ++k ) {
+                s -= A[ ( k*m ) + i ]*x[ k ];
+            }
+            x[ i ] = ( dg[ i ] > 0.0_re ) ? ( s/dg[ i ] ) : 0.0_re;
+        }
+        for ( size_t i = m ; i > 0U ; --i ) {
+            const size_t a = i - 1U;
+            real_t s = x[ a ];
+
+            for ( size_t k = i ; k < m ; ++k ) {
+                s -= A[ ( a*m ) + k ]*x[ k ];
+            }
+            x[ a ] = ( dg[ a ] > 0.0_re ) ? ( s/dg[ a ] ) : 0.0_re;
+        }
+    }
+}
 /*============================================================================*/
 bool fis::instance::setParameter( const fis::parameter p,
                                   const fis::paramValue x ) noexcept
@@ -102,6 +255,10 @@ bool fis::instance::setup( const fis::type t,
         xRules = r;
         wi = rWeights;
         nRules = n;
+        program = nullptr;
+        nPremises = 0U;
+        nConsequents = 0U;
+        ruleFirst = nullptr;
         deFuzz = ( Mamdani == xType )? &deFuzzCentroid : &deFuzzWtAverage;
         (void)setParameter( FIS_AND, FIS_MIN );
         (void)setParameter( FIS_OR, FIS_MAX );
@@ -222,6 +379,8 @@ bool fis::instance::setMF( fis::mf *m,
         m[ mf ].shape = ( nullptr != customMf ) ? customMf : fShape[ s ];
         m[ mf ].index = static_cast<size_t>( io );
         m[ mf ].points = cp;
+        m[ mf ].table = nullptr;
+        m[ mf ].nTable = 0U;
         m[ mf ].fx = 0.0_re;
         m[ mf ].h = bound( h );
         /*cstat +CERT-STR34-C*/
@@ -243,7 +402,16 @@ bool fis::instance::fuzzify( void ) noexcept
         /* evaluate input membership functions */
         for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
             const size_t mfIndex = inMF[ i ].getIndex();
-            (void)inMF[ i ].membership( &xInput[ mfIndex ] );
+
+            if ( nullptr != inMF[ i ].table ) {
+                const fis::input &in = xInput[ mfIndex ];
+                const real_t u = ( in.value - in.min )*static_cast<real_t>( inMF[ i ].nTable - 1U )/( in.max - in.min );
+
+                inMF[ i ].fx = tableLookup( inMF[ i ].table, inMF[ i ].nTable, u );
+            }
+            else {
+                (void)inMF[ i ].membership( &xInput[ mfIndex ] );
+            }
         }
         retValue = true;
     }
@@ -251,6 +419,81 @@ bool fis::instance::fuzzify( void ) noexcept
     return retValue;
 }
 /*============================================================================*/
+bool fis::instance::tabulateInputMF( const fis::tag mf,
+                                     real_t *buffer,
+                                     const size_t n,
+                                     const real_t tol ) noexcept
+{
+    bool retValue = false;
+
+    /*cstat -CERT-STR34-C*/
+    if ( ( nullptr != inMF ) && ( mf >= 0 ) && ( static_cast<size_t>( mf ) < nMFInputs ) &&
+         ( nullptr != inMF[ mf ].shape ) && ( nullptr != buffer ) && ( n >= 2U ) ) {
+        fis::mf &m = inMF[ mf ];
+        const fis::input &in = xInput[ m.getIndex() ];
+        const real_t step = ( in.max - in.min )/static_cast<real_t>( n - 1U );
+        const real_t * const p = m.points;
+        const size_t np = shapePoints( m.shape );
+        real_t support = -1.0_re; /*negative when unbounded*/
+        fis::input probe;
+        real_t err = 0.0_re;
+
+        m.table = nullptr;
+        m.nTable = 0U;
+        if ( ( &TriMF == m.shape ) || ( &RectangleMF == m.shape ) ) {
+            support = p[ np - 1U ] - p[ 0 ];
+        }
+        else if ( ( &TrapMF == m.shape ) || ( &PiMF == m.shape ) ) {
+            support = p[ 3 ] - p[ 0 ];
+        }
+        else if ( &CosineMF == m.shape ) {
+            support = p[ 1 ];
+        }
+        else if ( &SingletonMF == m.shape ) {
+            support = 0.0_re;
+        }
+        else {
+            /*the set is never zero*/
+        }
+        /*a set narrower than the step can fall between two samples*/
+        if ( ( step > 0.0_re ) && ( ( support < 0.0_re ) || ( step <= support ) ) ) {
+            probe.min = in.min;
+            probe.max = in.max;
+            for ( size_t i = 0U ; i < n ; ++i ) {
+                probe.value = in.min + ( static_cast<real_t>( i )*step );
+                buffer[ i ] = m.h*m.shape( &probe, m.points, 1U );
+            }
+            /*the error is checked between samples and at the points of the
+            set, where the corners and peaks are*/
+            for ( size_t i = 0U ; i < ( n - 1U ) ; ++i ) {
+                real_t e;
+
+                probe.value = in.min + ( ( static_cast<real_t>( i ) + 0.5_re )*step );
+                e = ffmath::absf( ( m.h*m.shape( &probe, m.points, 1U ) ) - ( 0.5_re*( buffer[ i ] + buffer[ i + 1U ] ) ) );
+                err = ( e > err ) ? e : err;
+            }
+            for ( size_t i = 0U ; i < np ; ++i ) {
+                if ( ( p[ i ] >= in.min ) && ( p[ i ] <= in.max ) ) {
+                    const real_t u = ( p[ i ] - in.min )*static_cast<real_t>( n - 1U )/( in.max - in.min );
+                    real_t e;
+
+                    probe.value = p[ i ];
+                    e = ffmath::absf( ( m.h*m.shape( &probe, m.points, 1U ) ) - tableLookup( buffer, n, u ) );
+                    err = ( e > err ) ? e : err;
+                }
+            }
+            if ( err <= tol ) {
+                m.table = buffer;
+                m.nTable = n;
+                retValue = true;
+            }
+        }
+    }
+    /*cstat +CERT-STR34-C*/
+
+    return retValue;
+}
+/*============================================================================*/
 real_t fis::instance::parseFuzzValue( fis::mf * const mfIO,
                                       fis::rules index ) noexcept
 {
@@ -331,10 +574,7 @@ size_t fis::instance::inferenceReachEnd( size_t i ) noexcept
     if ( Q_FIS_AND != connector ) {
         inferenceState = &fis::instance::inferenceAntecedent;
         lastConnector = -1;
-        wi[ ruleCount ] = rStrength;
-        if ( nullptr != ruleWeight ) {
-            wi[ ruleCount ] *= bound( ruleWeight[ ruleCount ] );
-        }
+        setRuleStrength( ruleCount );
         rStrength = 0.0_re;
         ++ruleCount;
         --i;
@@ -343,6 +583,14 @@ size_t fis::instance::inferenceReachEnd( size_t i ) noexcept
     return i;
 }
 /*============================================================================*/
+void fis::instance::setRuleStrength( const size_t r ) noexcept
+{
+    wi[ r ] = rStrength;
+    if ( nullptr != ruleWeight ) {
+        wi[ r ] *= bound( ruleWeight[ r ] );
+    }
+}
+/*============================================================================*/
 size_t fis::instance::aggregationFindConsequent( size_t i ) noexcept
 {
     while ( Q_FIS_THEN != xRules[ i++ ] ) {}
@@ -354,21 +602,35 @@ size_t fis::instance::aggregationFindConsequent( size_t i ) noexcept
 /*============================================================================*/
 size_t fis::instance::inferenceConsequent( size_t i ) noexcept
 {
-    fis::rules outIndex, MFOutIndex, connector;
-    bool neg = false;
+    fis::rules connector;
 
-    outIndex = xRules[ i ];
     /*cstat -CERT-INT30-C_a*/
-    MFOutIndex = xRules[ i + 1U ];
     connector = ( nOutputs > 1U )? xRules[ i + 2U ] : -1;
+    aggregateConsequent( ruleCount, xRules[ i ], xRules[ i + 1U ] );
     /*cstat +CERT-INT30-C_a*/
+    i += 2U;
+    if ( Q_FIS_AND != connector ) {
+        aggregationState = &fis::instance::aggregationFindConsequent;
+        ++ruleCount;
+        --i;
+    }
+
+    return i;
+}
+/*============================================================================*/
+void fis::instance::aggregateConsequent( const size_t r,
+                                         const fis::rules outIndex,
+                                         fis::rules MFOutIndex ) noexcept
+{
+    bool neg = false;
+
     if ( MFOutIndex < 0 ) {
         MFOutIndex = -MFOutIndex;
         neg = true;
     }
     MFOutIndex -= 1;
 
-    if ( wi[ ruleCount ] > 0.0_re ) {
+    if ( wi[ r ] > 0.0_re ) {
         /*cstat -CERT-STR34-C*/
         fis::output &o = xOutput[ outIndex ];
         fis::mf &m = outMF[ MFOutIndex ];
@@ -378,29 +640,27 @@ size_t fis::instance::inferenceConsequent( size_t i ) noexcept
             real_t v;
             v = m.membership( &o );
             v = ( neg )? ( 1.0_re - v ) : v;
-            o.y = aggregate( o.y, implicate( wi[ ruleCount ], v ) );
+            o.y = aggregate( o.y, implicate( wi[ r ], v ) );
         }
         else { /* Sugeno and Tsukamoto*/
             real_t zi;
             zi = m.membership( xInput, nInputs );
-            o.v[ sum_wz ] += zi*wi[ ruleCount ];
-            o.v[ sum_w ] += wi[ ruleCount ];
+            o.v[ sum_wz ] += zi*wi[ r ];
+            o.v[ sum_w ] += wi[ r ];
         }
     }
-
-    i += 2U;
-    if ( Q_FIS_AND != connector ) {
-        aggregationState = &fis::instance::aggregationFindConsequent;
-        ++ruleCount;
-        --i;
-    }
-
-    return i;
 }
 /*============================================================================*/
 void fis::instance::fuzzyAggregate( void ) noexcept
 {
-    if ( Q_FIS_RULES_BEGIN == xRules[ 0 ] ) {
+    if ( nullptr != program ) {
+        const fis::ruleTerm * const c = &program[ nPremises ];
+
+        for ( size_t k = 0U ; k < nConsequents ; ++k ) {
+            aggregateConsequent( c[ k ].rule, c[ k ].io, c[ k ].set );
+        }
+    }
+    else if ( Q_FIS_RULES_BEGIN == xRules[ 0 ] ) {
         size_t i = 1U;
 
         aggregationState = &fis::instance::aggregationFindConsequent;
@@ -419,13 +679,38 @@ bool fis::instance::deFuzzify( void ) noexcept
 {
     bool retValue = false;
 
-    if ( ( nullptr != xOutput ) && ( nullptr != outMF ) ) {
+    if ( ( nullptr != xOutput ) && ( nullptr != outMF ) && analyticReady( xOutput ) ) {
+        for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+            xOutput[ i ].value = analyticDeFuzz( wi, xOutput[ i ], i );
+            xOutput[ i ].value = bound( xOutput[ i ].value, xOutput[ i ].min, xOutput[ i ].max );
+        }
+        retValue = true;
+    }
+    else if ( ( nullptr != xOutput ) && ( nullptr != outMF ) ) {
         size_t i;
 
         for ( i = 0U ; i < nOutputs ; ++i ) {
             deFuzz( &xOutput[ i ] , FIS_DEFUZZ_INIT );
         }
-        if ( Mamdani == xType ) {
+        if ( ( Mamdani == xType ) && ( nullptr != program ) ) {
+            const fis::ruleTerm * const c = &program[ nPremises ];
+
+            for ( i = 0U ; i < nOutputs ; ++i ) {
+                aggregateGrid( wi, xOutput[ i ], i );
+                xOutput[ i ].value = xOutput[ i ].x;
+            }
+            /*the fired output sets keep their membership at the last point,
+            as in the point-by-point aggregation*/
+            for ( size_t q = 0U ; q < nConsequents ; ++q ) {
+                if ( wi[ c[ q ].rule ] > 0.0_re ) {
+                    const fis::rules set = c[ q ].set;
+                    /*cstat -CERT-INT30-C_a -CERT-INT32-C_a -CERT-STR34-C*/
+                    (void)outMF[ ( ( set < 0 ) ? -set : set ) - 1 ].membership( &xOutput[ c[ q ].io ] );
+                    /*cstat +CERT-INT30-C_a +CERT-INT32-C_a +CERT-STR34-C*/
+                }
+            }
+        }
+        else if ( Mamdani == xType ) {
             size_t k;
 
             for ( k = 0U ; k < nPoints ; ++k ) {
@@ -464,40 +749,1773 @@ bool fis::instance::deFuzzify( void ) noexcept
     return retValue;
 }
 /*============================================================================*/
-bool fis::instance::setRuleWeights( real_t *rWeights ) noexcept
+void fis::instance::gridBlock( const real_t * const ws,
+                              fis::output &o,
+                              const size_t out,
+                              const size_t k0,
+                              real_t * const x,
+                              real_t * const y ) const noexcept
+{
+    const fis::ruleTerm * const c = &program[ nPremises ];
+    const size_t n = ( ( nPoints - k0 ) < FIS_GRID_BLOCK ) ? ( nPoints - k0 ) : FIS_GRID_BLOCK;
+    real_t v[ FIS_GRID_BLOCK ];
+
+    /*the whole block is computed, only the first n points are used*/
+    for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+        x[ j ] = o.min + ( ( static_cast<real_t>( k0 + j ) + 0.5_re )*o.res );
+        y[ j ] = 0.0_re;
+    }
+    for ( size_t q = 0U ; q < nConsequents ; ++q ) {
+        const real_t w = ws[ c[ q ].rule ];
+
+        if ( ( static_cast<size_t>( c[ q ].io ) == out ) && ( w > 0.0_re ) ) {
+            const fis::rules set = c[ q ].set;
+            /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+            const fis::mf &m = outMF[ ( ( set < 0 ) ? -set : set ) - 1 ];
+            /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+            const real_t * const p = m.points;
+
+            if ( &TriMF == m.shape ) {
+                for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+                    v[ j ] = m.h*triValue( p, x[ j ] );
+                }
+            }
+            else if ( &TrapMF == m.shape ) {
+                for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+                    v[ j ] = m.h*trapValue( p, x[ j ] );
+                }
+            }
+            else {
+                for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+                    o.value = x[ j ];
+                    v[ j ] = ( j < n ) ? m.h*m.shape( &o, m.points, 1U ) : 0.0_re;
+                }
+            }
+            if ( set < 0 ) {
+                for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+                    v[ j ] = 1.0_re - v[ j ];
+                }
+            }
+            if ( &Min == implicate ) {
+                for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+                    v[ j ] = unitBound( ( w < v[ j ] ) ? w : v[ j ] );
+                }
+            }
+            else if ( &Prod == implicate ) {
+                for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+                    v[ j ] = unitBound( w*v[ j ] );
+                }
+            }
+            else {
+                for ( size_t j = 0U ; j < n ; ++j ) {
+                    v[ j ] = implicate( w, v[ j ] );
+                }
+            }
+            if ( &Max == aggregate ) {
+                for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+                    y[ j ] = unitBound( ( y[ j ] > v[ j ] ) ? y[ j ] : v[ j ] );
+                }
+            }
+            else if ( &Sum == aggregate ) {
+                for ( size_t j = 0U ; j < FIS_GRID_BLOCK ; ++j ) {
+                    y[ j ] = unitBound( y[ j ] + v[ j ] );
+                }
+            }
+            else {
+                for ( size_t j = 0U ; j < n ; ++j ) {
+                    y[ j ] = aggregate( y[ j ], v[ j ] );
+                }
+            }
+        }
+    }
+}
+/*============================================================================*/
+void fis::instance::aggregateGrid( const real_t * const ws,
+                                  fis::output &o,
+                                  const size_t out ) const noexcept
+{
+    for ( size_t k0 = 0U ; k0 < nPoints ; k0 += FIS_GRID_BLOCK ) {
+        real_t x[ FIS_GRID_BLOCK ], y[ FIS_GRID_BLOCK ];
+        const size_t n = ( ( nPoints - k0 ) < FIS_GRID_BLOCK ) ? ( nPoints - k0 ) : FIS_GRID_BLOCK;
+
+        gridBlock( ws, o, out, k0, x, y );
+        for ( size_t j = 0U ; j < n ; ++j ) {
+            o.x = x[ j ];
+            o.y = y[ j ];
+            deFuzz( &o, FIS_DEFUZZ_COMPUTE );
+            if ( nullptr != o.xag ) { /*store aggregated*/
+                o.xag[ k0 + j ] = o.x;
+                o.yag[ k0 + j ] = o.y;
+            }
+        }
+    }
+}
+/*============================================================================*/
+bool fis::instance::evaluateBatch( const real_t *inputs,
+                                   real_t *outputs,
+                                   const size_t count ) noexcept
+{
+    bool retValue = ( nullptr != inputs ) && ( nullptr != outputs ) &&
+                    ( nullptr != xInput ) && ( nullptr != xOutput );
+    /*the compiled rules let the vectors go through in blocks*/
+    const size_t width = ( retValue && ( nullptr != program ) && ( nullptr == ruleFirst ) && ( nullptr != inMF ) ) ?
+                         ( FIS_BATCH_AREA/( nMFInputs + nRules ) ) : 0U;
+
+    if ( width > 0U ) {
+        real_t area[ FIS_BATCH_AREA ];
+
+        for ( size_t k0 = 0U ; retValue && ( k0 < count ) ; k0 += width ) {
+            const size_t w = ( ( count - k0 ) < width ) ? ( count - k0 ) : width;
+            real_t * const ws = &area[ w*nMFInputs ];
+
+            batchPremises( &inputs[ k0*nInputs ], w, area, ws );
+            for ( size_t s = 0U ; retValue && ( s < w ) ; ++s ) {
+                const real_t * const in = &inputs[ ( k0 + s )*nInputs ];
+                real_t * const out = &outputs[ ( k0 + s )*nOutputs ];
+
+                for ( size_t i = 0U ; i < nInputs ; ++i ) {
+                    xInput[ i ].value = bound( in[ i ], xInput[ i ].min, xInput[ i ].max );
+                }
+                for ( size_t r = 0U ; r < nRules ; ++r ) {
+                    wi[ r ] = ws[ ( s*nRules ) + r ];
+                }
+                retValue = deFuzzify();
+                for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+                    out[ i ] = xOutput[ i ].value;
+                }
+            }
+            /*the input sets keep the values of the last vector*/
+            for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
+                inMF[ i ].fx = area[ ( i*w ) + w - 1U ];
+            }
+        }
+        rStrength = 0.0_re;
+        ruleCount = nRules;
+    }
+    else {
+        for ( size_t k = 0U ; retValue && ( k < count ) ; ++k ) {
+            const real_t * const in = &inputs[ k*nInputs ];
+            real_t * const out = &outputs[ k*nOutputs ];
+
+            for ( size_t i = 0U ; i < nInputs ; ++i ) {
+                xInput[ i ].value = in[ i ];
+            }
+            retValue = fuzzify() && inference() && deFuzzify();
+            for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+                out[ i ] = xOutput[ i ].value;
+            }
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+real_t fis::instance::gridBisector( const real_t * const ws,
+                                   fis::output &o,
+                                   const size_t out ) const noexcept
+{
+    const real_t half = 0.5_re*o.v[ sum_y ];
+    real_t area = 0.0_re;
+    bool found = false;
+
+    /*same scan as deFuzzBisector(), without the aggregation of the owner*/
+    for ( size_t k0 = 0U ; ( !found ) && ( k0 < nPoints ) ; k0 += FIS_GRID_BLOCK ) {
+        real_t x[ FIS_GRID_BLOCK ], y[ FIS_GRID_BLOCK ];
+        const size_t n = ( ( nPoints - k0 ) < FIS_GRID_BLOCK ) ? ( nPoints - k0 ) : FIS_GRID_BLOCK;
+
+        gridBlock( ws, o, out, k0, x, y );
+        for ( size_t j = 0U ; ( !found ) && ( j < n ) ; ++j ) {
+            o.x = x[ j ];
+            area += y[ j ];
+            found = ( area >= half );
+        }
+    }
+
+    return o.x;
+}
+/*============================================================================*/
+bool fis::context::setup( fis::input * const inputs,
+                          const size_t ni,
+                          fis::output * const outputs,
+                          const size_t no,
+                          real_t * const mfValues,
+                          const size_t nmi,
+                          real_t * const rWeights,
+                          const size_t n ) noexcept
 {
     bool retValue = false;
-    if ( nullptr != rWeights ) {
-        ruleWeight = rWeights;
+
+    if ( ( nullptr != inputs ) && ( ni > 0U ) &&
+         ( nullptr != outputs ) && ( no > 0U ) &&
+         ( nullptr != mfValues ) && ( nmi > 0U ) &&
+         ( nullptr != rWeights ) && ( n > 0U ) ) {
+        xInput = inputs;
+        nInputs = ni;
+        xOutput = outputs;
+        nOutputs = no;
+        fx = mfValues;
+        nMFInputs = nmi;
+        wi = rWeights;
+        nRules = n;
         retValue = true;
     }
 
     return retValue;
 }
 /*============================================================================*/
-bool fis::instance::inference( void ) noexcept
+bool fis::context::setupTraining( real_t * const area,
+                                  const size_t nArea ) noexcept
 {
     bool retValue = false;
 
-    if ( nullptr != xRules  ) {
-        size_t i = 0U;
+    if ( ( nullptr != area ) && ( nArea > 0U ) ) {
+        for ( size_t i = 0U ; i < nArea ; ++i ) {
+            area[ i ] = 0.0_re;
+        }
+        acc = area;
+        nAcc = nArea;
+        retValue = true;
+    }
 
-        if ( Q_FIS_RULES_BEGIN == xRules[ 0 ] ) {
-            inferenceState = &fis::instance::inferenceAntecedent;
-            rStrength = 0.0_re;
-            lastConnector = -1;
-            ruleCount = 0U;
-            i = 1U;
-            while ( ( Q_FIS_RULES_END != xRules[ i ] ) && ( ruleCount < nRules ) ) {
-                i = (this->*inferenceState)( i );
-                if ( INFERENCE_ERROR == i ) {
-                    break;
-                }
-                ++i;
+    return retValue;
+}
+/*============================================================================*/
+bool fis::trainer::setup( real_t * const area,
+                          const size_t nArea,
+                          const real_t learningRate ) noexcept
+{
+    bool retValue = false;
+
+    if ( ( nullptr != area ) && ( nArea > 0U ) && ( learningRate > 0.0_re ) ) {
+        owner = nullptr;
+        buffer = area;
+        n = nArea;
+        rate = learningRate;
+        error = 0.0_re;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+real_t fis::instance::fuzzValue( const real_t * const fx,
+                                 fis::rules index,
+                                 const size_t w,
+                                 const size_t s ) noexcept
+{
+    const bool neg = ( index < 0 );
+    real_t y;
+
+    if ( neg ) {
+        index = -index;
+    }
+    /*cstat -CERT-INT30-C_a -CERT-STR34-C -CERT-INT32-C_a*/
+    y = bound( fx[ ( static_cast<size_t>( index - 1 )*w ) + s ] );
+    /*cstat +CERT-INT30-C_a +CERT-STR34-C +CERT-INT32-C_a*/
+
+    return ( neg ) ? ( 1.0_re - y ) : y;
+}
+/*============================================================================*/
+void fis::instance::batchPremises( const real_t * const inputs,
+                                   const size_t w,
+                                   real_t * const fx,
+                                   real_t * const ws ) const noexcept
+{
+    size_t k = 0U;
+
+    /*a row of fx holds the values of an input set for the w vectors*/
+    for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
+        const fis::mf &m = inMF[ i ];
+        const size_t j = m.getIndex();
+        const fis::input &x = xInput[ j ];
+        real_t * const row = &fx[ i*w ];
+
+        for ( size_t s = 0U ; s < w ; ++s ) {
+            row[ s ] = bound( inputs[ ( s*nInputs ) + j ], x.min, x.max );
+        }
+        if ( nullptr != m.table ) {
+            for ( size_t s = 0U ; s < w ; ++s ) {
+                const real_t u = ( row[ s ] - x.min )*static_cast<real_t>( m.nTable - 1U )/( x.max - x.min );
+
+                row[ s ] = tableLookup( m.table, m.nTable, u );
             }
         }
-        if ( ( Q_FIS_RULES_END == xRules[ i ] ) && ( ruleCount == nRules) ) {
-            retValue = true;
+        else if ( &TriMF == m.shape ) {
+            for ( size_t s = 0U ; s < w ; ++s ) {
+                row[ s ] = m.h*triValue( m.points, row[ s ] );
+            }
+        }
+        else if ( &TrapMF == m.shape ) {
+            for ( size_t s = 0U ; s < w ; ++s ) {
+                row[ s ] = m.h*trapValue( m.points, row[ s ] );
+            }
+        }
+        else if ( nullptr != m.shape ) {
+            fis::input probe;
+
+            probe.min = x.min;
+            probe.max = x.max;
+            for ( size_t s = 0U ; s < w ; ++s ) {
+                probe.value = row[ s ];
+                row[ s ] = m.h*m.shape( &probe, m.points, 1U );
+            }
+        }
+        else {
+            for ( size_t s = 0U ; s < w ; ++s ) {
+                row[ s ] = 0.0_re;
+            }
+        }
+    }
+    /*a row of ws holds the rule strengths of a vector*/
+    while ( k < nPremises ) {
+        const size_t r = program[ k ].rule;
+        const size_t first = k;
+
+        for ( size_t s = 0U ; s < w ; ++s ) {
+            ws[ ( s*nRules ) + r ] = Sum( 0.0_re, fuzzValue( fx, program[ first ].set, w, s ) );
+        }
+        for ( ++k ; ( k < nPremises ) && ( r == program[ k ].rule ) ; ++k ) {
+            const fis::rules set = program[ k ].set;
+            const fis::fuzzyOperator op = ( Q_FIS_AND == program[ k ].connector ) ? andOp : orOp;
+
+            for ( size_t s = 0U ; s < w ; ++s ) {
+                real_t &a = ws[ ( s*nRules ) + r ];
+
+                a = op( a, fuzzValue( fx, set, w, s ) );
+            }
+        }
+        if ( nullptr != ruleWeight ) {
+            const real_t rw = bound( ruleWeight[ r ] );
+
+            for ( size_t s = 0U ; s < w ; ++s ) {
+                ws[ ( s*nRules ) + r ] *= rw;
+            }
+        }
+    }
+}
+/*============================================================================*/
+void fis::instance::contextDeFuzzify( fis::context &ctx,
+                                      const real_t * const ws ) const noexcept
+{
+    fis::output * const o = ctx.xOutput;
+
+    for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+        o[ i ].min = xOutput[ i ].min;
+        o[ i ].max = xOutput[ i ].max;
+        o[ i ].res = xOutput[ i ].res;
+    }
+    if ( analyticReady( o ) ) {
+        for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+            o[ i ].value = bound( analyticDeFuzz( ws, o[ i ], i ), o[ i ].min, o[ i ].max );
+        }
+    }
+    else {
+        for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+            deFuzz( &o[ i ], FIS_DEFUZZ_INIT );
+        }
+        if ( Mamdani == xType ) {
+            for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+                aggregateGrid( ws, o[ i ], i );
+            }
+        }
+        else { /*Sugeno and Tsukamoto systems*/
+            const fis::ruleTerm * const c = &program[ nPremises ];
+
+            for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+                o[ i ].v[ sum_wz ] = 0.0_re;
+                o[ i ].v[ sum_w ] = 0.0_re;
+            }
+            for ( size_t q = 0U ; q < nConsequents ; ++q ) {
+                const real_t w = ws[ c[ q ].rule ];
+
+                if ( w > 0.0_re ) {
+                    const fis::rules set = c[ q ].set;
+                    /*cstat -CERT-INT30-C_a -CERT-INT32-C_a -CERT-STR34-C*/
+                    const fis::mf &m = outMF[ ( ( set < 0 ) ? -set : set ) - 1 ];
+                    fis::output &y = o[ c[ q ].io ];
+                    /*cstat +CERT-INT30-C_a +CERT-INT32-C_a +CERT-STR34-C*/
+                    const real_t zi = m.h*m.shape( ctx.xInput, m.points, nInputs );
+
+                    y.v[ sum_wz ] += zi*w;
+                    y.v[ sum_w ] += w;
+                }
+            }
+            for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+                deFuzz( &o[ i ], FIS_DEFUZZ_COMPUTE );
+            }
+        }
+        for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+            const bool bisect = ( Mamdani == xType ) && ( &deFuzzBisector == deFuzz );
+            const real_t d = ( bisect ) ? gridBisector( ws, o[ i ], i ) : deFuzz( &o[ i ], FIS_DEFUZZ_END );
+
+            o[ i ].value = bound( d, o[ i ].min, o[ i ].max );
+        }
+    }
+}
+/*============================================================================*/
+bool fis::instance::evaluateBatch( fis::context &ctx,
+                                   const real_t *inputs,
+                                   real_t *outputs,
+                                   const size_t count ) const noexcept
+{
+    const bool retValue = ( nullptr != inputs ) && ( nullptr != outputs ) &&
+                          ( nullptr != program ) && ( nullptr != outMF ) &&
+                          ( nullptr != ctx.xInput ) &&
+                          ( ctx.nInputs >= nInputs ) && ( ctx.nOutputs >= nOutputs ) &&
+                          ( ctx.nMFInputs >= nMFInputs ) && ( ctx.nRules >= nRules );
+    /*the arrays of the context set how many vectors go in a block*/
+    const size_t nSets = ( retValue ) ? ( ctx.nMFInputs/nMFInputs ) : 0U;
+    const size_t nStrengths = ( retValue ) ? ( ctx.nRules/nRules ) : 0U;
+    const size_t width = ( nSets < nStrengths ) ? nSets : nStrengths;
+
+    for ( size_t k0 = 0U ; retValue && ( k0 < count ) ; k0 += width ) {
+        const size_t w = ( ( count - k0 ) < width ) ? ( count - k0 ) : width;
+
+        batchPremises( &inputs[ k0*nInputs ], w, ctx.fx, ctx.wi );
+        for ( size_t s = 0U ; s < w ; ++s ) {
+            const real_t * const in = &inputs[ ( k0 + s )*nInputs ];
+            real_t * const out = &outputs[ ( k0 + s )*nOutputs ];
+
+            for ( size_t i = 0U ; i < nInputs ; ++i ) {
+                ctx.xInput[ i ].min = xInput[ i ].min;
+                ctx.xInput[ i ].max = xInput[ i ].max;
+                ctx.xInput[ i ].value = bound( in[ i ], xInput[ i ].min, xInput[ i ].max );
+            }
+            contextDeFuzzify( ctx, &ctx.wi[ s*nRules ] );
+            for ( size_t i = 0U ; i < nOutputs ; ++i ) {
+                out[ i ] = ctx.xOutput[ i ].value;
+            }
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool fis::instance::evaluateBatch( fis::context &ctx,
+                                   const real_t *inputs,
+                                   real_t *outputs,
+                                   const size_t count,
+                                   const size_t part,
+                                   const size_t nParts ) const noexcept
+{
+    bool retValue = false;
+
+    if ( ( nullptr != inputs ) && ( nullptr != outputs ) && ( part < nParts ) ) {
+        const size_t first = ( count*part )/nParts;
+        const size_t last = ( count*( part + 1U ) )/nParts;
+
+        retValue = evaluateBatch( ctx, &inputs[ first*nInputs ], &outputs[ first*nOutputs ], last - first );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool fis::instance::setAnalyticDeFuzz( const bool enable ) noexcept
+{
+    bool retValue = false;
+
+    if ( Mamdani == xType ) {
+        analytic = enable;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool fis::instance::setRuleWeights( real_t *rWeights ) noexcept
+{
+    bool retValue = false;
+    if ( nullptr != rWeights ) {
+        ruleWeight = rWeights;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool fis::instance::inference( void ) noexcept
+{
+    bool retValue = false;
+
+    if ( nullptr != ruleFirst ) {
+        sparseInference();
+        retValue = true;
+    }
+    else if ( nullptr != program ) {
+        compiledInference();
+        retValue = true;
+    }
+    else if ( nullptr != xRules  ) {
+        size_t i = 0U;
+
+        if ( Q_FIS_RULES_BEGIN == xRules[ 0 ] ) {
+            inferenceState = &fis::instance::inferenceAntecedent;
+            rStrength = 0.0_re;
+            lastConnector = -1;
+            ruleCount = 0U;
+            i = 1U;
+            while ( ( Q_FIS_RULES_END != xRules[ i ] ) && ( ruleCount < nRules ) ) {
+                i = (this->*inferenceState)( i );
+                if ( INFERENCE_ERROR == i ) {
+                    break;
+                }
+                ++i;
+            }
+        }
+        if ( ( Q_FIS_RULES_END == xRules[ i ] ) && ( ruleCount == nRules) ) {
+            retValue = true;
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+size_t fis::instance::compiledRule( size_t k ) noexcept
+{
+    const size_t r = program[ k ].rule;
+
+    /*k is the first premise of the rule*/
+    rStrength = Sum( 0.0_re, parseFuzzValue( inMF, program[ k ].set ) );
+    for ( ++k ; ( k < nPremises ) && ( r == program[ k ].rule ) ; ++k ) {
+        const real_t v = parseFuzzValue( inMF, program[ k ].set );
+
+        rStrength = ( Q_FIS_AND == program[ k ].connector ) ? andOp( rStrength, v ) : orOp( rStrength, v );
+    }
+    setRuleStrength( r );
+
+    return k;
+}
+/*============================================================================*/
+void fis::instance::compiledInference( void ) noexcept
+{
+    size_t k = 0U;
+
+    while ( k < nPremises ) {
+        k = compiledRule( k );
+    }
+    rStrength = 0.0_re;
+    ruleCount = nRules;
+}
+/*============================================================================*/
+void fis::instance::sparseInference( void ) noexcept
+{
+    ++epoch;
+    if ( 0U == epoch ) { /*the marks of the rules wrapped around*/
+        for ( size_t r = 0U ; r < nRules ; ++r ) {
+            ruleMark[ r ] = 0U;
+        }
+        epoch = 1U;
+    }
+    for ( size_t r = 0U ; r < nRules ; ++r ) {
+        wi[ r ] = 0.0_re;
+    }
+    /*the last group holds the rules with negated premises*/
+    for ( size_t j = 0U ; j <= nMFInputs ; ++j ) {
+        if ( ( j == nMFInputs ) || ( bound( inMF[ j ].fx ) > 0.0_re ) ) {
+            for ( size_t e = mfFirst[ j ] ; e < mfFirst[ j + 1U ] ; ++e ) {
+                const size_t r = mfRules[ e ];
+
+                if ( epoch != ruleMark[ r ] ) {
+                    ruleMark[ r ] = epoch;
+                    (void)compiledRule( ruleFirst[ r ] );
+                }
+            }
+        }
+    }
+    rStrength = 0.0_re;
+    ruleCount = nRules;
+}
+/*============================================================================*/
+bool fis::instance::setActiveSet( size_t * const buffer,
+                                  const size_t n ) noexcept
+{
+    bool retValue = false;
+
+    ruleFirst = nullptr;
+    if ( ( nullptr != program ) && ( nullptr != buffer ) &&
+         ( n >= ( ( 3U*nRules ) + nMFInputs + nPremises + 2U ) ) ) {
+        size_t * const first = buffer;
+        size_t * const group = &buffer[ nRules ];
+        size_t * const list = &group[ nMFInputs + 2U ];
+        size_t * const mark = &list[ nPremises + nRules ];
+
+        for ( size_t j = 0U ; j < ( nMFInputs + 2U ) ; ++j ) {
+            group[ j ] = 0U;
+        }
+        for ( size_t r = 0U ; r < nRules ; ++r ) {
+            mark[ r ] = 0U;
+        }
+        /*count the rules of every group, a rule with negated premises is
+        stored once in the last group*/
+        for ( size_t k = 0U ; k < nPremises ; ++k ) {
+            const fis::ruleTerm &t = program[ k ];
+
+            if ( t.set > 0 ) {
+                /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+                ++group[ static_cast<size_t>( t.set ) ];
+                /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+            }
+            else if ( 1U != mark[ t.rule ] ) {
+                mark[ t.rule ] = 1U;
+                ++group[ nMFInputs + 1U ];
+            }
+            else {
+                /*nothing to do*/
+            }
+        }
+        for ( size_t j = 1U ; j < ( nMFInputs + 2U ) ; ++j ) {
+            group[ j ] += group[ j - 1U ];
+        }
+        for ( size_t r = 0U ; r < nRules ; ++r ) {
+            mark[ r ] = 0U;
+        }
+        /*fill the groups, group[ j ] is used as the insertion point of the
+        group j, so it ends up at the start of the next one*/
+        for ( size_t k = nPremises ; k > 0U ; --k ) {
+            const fis::ruleTerm &t = program[ k - 1U ];
+
+            first[ t.rule ] = k - 1U;
+            if ( t.set > 0 ) {
+                /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+                list[ group[ static_cast<size_t>( t.set ) - 1U ]++ ] = t.rule;
+                /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+            }
+            else if ( 1U != mark[ t.rule ] ) {
+                mark[ t.rule ] = 1U;
+                list[ group[ nMFInputs ]++ ] = t.rule;
+            }
+            else {
+                /*nothing to do*/
+            }
+        }
+        for ( size_t j = nMFInputs + 1U ; j > 0U ; --j ) {
+            group[ j ] = group[ j - 1U ];
+        }
+        group[ 0 ] = 0U;
+        for ( size_t r = 0U ; r < nRules ; ++r ) {
+            mark[ r ] = 0U;
+        }
+        ruleFirst = first;
+        mfFirst = group;
+        mfRules = list;
+        ruleMark = mark;
+        epoch = 0U;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool fis::instance::parseRules( fis::ruleTerm * const premises,
+                                fis::ruleTerm * const consequents,
+                                size_t &np,
+                                size_t &nc ) const noexcept
+{
+    bool valid = ( Q_FIS_RULES_BEGIN == xRules[ 0 ] );
+    size_t i = 1U;
+    size_t r = 0U;
+
+    np = 0U;
+    nc = 0U;
+    while ( valid && ( Q_FIS_RULES_END != xRules[ i ] ) && ( r < nRules ) ) {
+        fis::rules connector = -1;
+        /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+        do {
+            const fis::rules in = xRules[ i ];
+            const fis::rules set = xRules[ i + 1U ];
+            const size_t s = static_cast<size_t>( ( set < 0 ) ? -set : set );
+
+            valid = ( in >= 0 ) && ( static_cast<size_t>( in ) < nInputs ) &&
+                    ( s > 0U ) && ( s <= nMFInputs );
+            if ( valid && ( nullptr != premises ) ) {
+                premises[ np ].rule = r;
+                premises[ np ].io = in;
+                premises[ np ].set = set;
+                premises[ np ].connector = connector;
+            }
+            ++np;
+            connector = xRules[ i + 2U ];
+            i += 3U;
+        } while ( valid && ( ( Q_FIS_AND == connector ) || ( Q_FIS_OR == connector ) ) );
+        valid = valid && ( Q_FIS_THEN == connector );
+        while ( valid && ( Q_FIS_THEN == connector ) ) {
+            const fis::rules out = xRules[ i ];
+            const fis::rules set = xRules[ i + 1U ];
+            const size_t s = static_cast<size_t>( ( set < 0 ) ? -set : set );
+
+            valid = ( out >= 0 ) && ( static_cast<size_t>( out ) < nOutputs ) &&
+                    ( s > 0U ) && ( s <= nMFOutputs );
+            if ( valid && ( nullptr != consequents ) ) {
+                consequents[ nc ].rule = r;
+                consequents[ nc ].io = out;
+                consequents[ nc ].set = set;
+                consequents[ nc ].connector = Q_FIS_THEN;
+            }
+            ++nc;
+            /*more consequents are joined with the AND connector*/
+            if ( ( nOutputs > 1U ) && ( Q_FIS_AND == xRules[ i + 2U ] ) ) {
+                i += 3U;
+            }
+            else {
+                connector = -1;
+                i += 2U;
+            }
+        }
+        /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+        ++r;
+    }
+
+    return valid && ( Q_FIS_RULES_END == xRules[ i ] ) && ( r == nRules );
+}
+/*============================================================================*/
+bool fis::instance::compileRules( fis::ruleTerm * const buffer,
+                                  const size_t n ) noexcept
+{
+    bool retValue = false;
+
+    if ( ( nullptr != xRules ) && ( nullptr != buffer ) ) {
+        size_t np = 0U;
+        size_t nc = 0U;
+
+        program = nullptr;
+        ruleFirst = nullptr;
+        /*count the items first, the consequents are stored after the premises*/
+        if ( parseRules( nullptr, nullptr, np, nc ) && ( ( np + nc ) <= n ) ) {
+            retValue = parseRules( buffer, &buffer[ np ], np, nc );
+            if ( retValue ) {
+                program = buffer;
+                nPremises = np;
+                nConsequents = nc;
+            }
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool fis::instance::analyticReady( const fis::output * const outs ) const noexcept
+{
+    bool retValue = analytic && ( nullptr != program ) && ( Mamdani == xType ) &&
+                    ( ( &Min == implicate ) || ( &Prod == implicate ) ) &&
+                    ( ( &Max == aggregate ) || ( &Sum == aggregate ) );
+
+    for ( size_t i = 0U ; retValue && ( i < nOutputs ) ; ++i ) {
+        retValue = ( nullptr == outs[ i ].xag );
+    }
+    for ( size_t k = nPremises ; retValue && ( k < ( nPremises + nConsequents ) ) ; ++k ) {
+        const fis::rules set = program[ k ].set;
+        /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+        const fis::mfFunction shape = outMF[ ( ( set < 0 ) ? -set : set ) - 1 ].shape;
+        /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+
+        retValue = ( &TriMF == shape ) || ( &TrapMF == shape );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+real_t fis::instance::nextKink( const real_t * const ws,
+                                const fis::ruleTerm &c,
+                                const real_t x,
+                                real_t k ) const noexcept
+{
+    /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+    const fis::mf &m = outMF[ ( ( c.set < 0 ) ? -c.set : c.set ) - 1 ];
+    /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+    const bool tri = ( &TriMF == m.shape );
+    real_t p[ 6 ] = { m.points[ 0 ], m.points[ 1 ], m.points[ 2 ], 0.0_re, 0.0_re, 0.0_re };
+    size_t n = 4U;
+
+    p[ 3 ] = ( tri ) ? m.points[ 2 ] : m.points[ 3 ];
+    p[ 2 ] = ( tri ) ? m.points[ 1 ] : m.points[ 2 ];
+    if ( &Min == implicate ) {
+        /*the set is clipped where it crosses the rule strength*/
+        const real_t w = ws[ c.rule ];
+        const real_t t = ( ( c.set < 0 ) ? ( 1.0_re - w ) : w )/m.h;
+
+        if ( ( t > 0.0_re ) && ( t < 1.0_re ) ) {
+            p[ 4 ] = p[ 0 ] + ( t*( p[ 1 ] - p[ 0 ] ) );
+            p[ 5 ] = p[ 3 ] - ( t*( p[ 3 ] - p[ 2 ] ) );
+            n = 6U;
+        }
+    }
+    for ( size_t i = 0U ; i < n ; ++i ) {
+        if ( ( p[ i ] > x ) && ( p[ i ] < k ) ) {
+            k = p[ i ];
+        }
+    }
+
+    return k;
+}
+/*============================================================================*/
+void fis::instance::termLine( const real_t * const ws,
+                              const fis::ruleTerm &c,
+                              const real_t x0,
+                              const real_t xm,
+                              real_t &y0,
+                              real_t &s ) const noexcept
+{
+    /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+    const fis::mf &m = outMF[ ( ( c.set < 0 ) ? -c.set : c.set ) - 1 ];
+    /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+    const bool tri = ( &TriMF == m.shape );
+    const real_t a = m.points[ 0 ];
+    const real_t b = m.points[ 1 ];
+    const real_t cp = ( tri ) ? m.points[ 1 ] : m.points[ 2 ];
+    const real_t d = ( tri ) ? m.points[ 2 ] : m.points[ 3 ];
+    const real_t w = ws[ c.rule ];
+
+    /*the piece of the set that holds the middle of the interval*/
+    y0 = 0.0_re;
+    s = 0.0_re;
+    if ( ( xm > a ) && ( xm < b ) ) {
+        s = 1.0_re/( b - a );
+        y0 = ( x0 - a )*s;
+    }
+    else if ( ( xm >= b ) && ( xm <= cp ) ) {
+        y0 = 1.0_re;
+    }
+    else if ( ( xm > cp ) && ( xm < d ) ) {
+        s = -1.0_re/( d - cp );
+        y0 = ( d - x0 )/( d - cp );
+    }
+    else {
+        /*nothing to do*/
+    }
+    y0 *= m.h;
+    s *= m.h;
+    if ( c.set < 0 ) {
+        y0 = 1.0_re - y0;
+        s = -s;
+    }
+    if ( &Prod == implicate ) {
+        y0 *= w;
+        s *= w;
+    }
+    else if ( ( y0 + ( s*( xm - x0 ) ) ) > w ) {
+        y0 = w;
+        s = 0.0_re;
+    }
+    else {
+        /*nothing to do*/
+    }
+}
+/*============================================================================*/
+void fis::instance::addPiece( region &r,
+                              const real_t u0,
+                              const real_t u1,
+                              const real_t y0,
+                              const real_t y1 ) noexcept
+{
+    constexpr real_t tol = 1.0e-6_re;
+    const real_t dx = u1 - u0;
+    const real_t a = 0.5_re*dx*( y0 + y1 );
+
+    if ( dx > 0.0_re ) {
+        const bool at0 = ffmath::isEqual( y0, r.yMax, tol );
+        const bool at1 = ffmath::isEqual( y1, r.yMax, tol );
+
+        if ( 0U == r.pass ) {
+            const real_t hi = ( y0 > y1 ) ? y0 : y1;
+
+            r.area += a;
+            r.moment += dx*( ( u0*( ( 2.0_re*y0 ) + y1 ) ) + ( u1*( y0 + ( 2.0_re*y1 ) ) ) )/6.0_re;
+            if ( hi > ( r.yMax + tol ) ) {
+                r.yMax = hi;
+                r.xSmallest = ( ffmath::isEqual( y0, hi, tol ) ) ? u0 : u1;
+                r.xLargest = ( ffmath::isEqual( y1, hi, tol ) ) ? u1 : u0;
+            }
+            else if ( at1 ) {
+                r.xLargest = u1;
+            }
+            else if ( at0 ) {
+                r.xLargest = u0;
+            }
+            else {
+                /*nothing to do*/
+            }
+        }
+        else if ( 1U == r.pass ) { /*bisector*/
+            if ( !r.found && ( ( r.area + a ) >= r.target ) ) {
+                const real_t rem = r.target - r.area;
+                const real_t k = ( y1 - y0 )/dx;
+                const real_t den = y0 + ffmath::sqrt( ( y0*y0 ) + ( 2.0_re*k*rem ) );
+
+                r.x = ( den > 0.0_re ) ? u0 + ( 2.0_re*rem/den ) : u0;
+                r.found = true;
+            }
+            r.area += a;
+        }
+        else { /*first plateau of the maximum*/
+            if ( !r.started && ( at0 || at1 ) ) {
+                r.started = true;
+                r.xSmallest = ( at0 ) ? u0 : u1;
+                r.xLargest = r.xSmallest;
+            }
+            if ( r.started && !r.found && at0 ) {
+                if ( at1 ) {
+                    r.xLargest = u1;
+                }
+                else {
+                    r.found = true;
+                }
+            }
+        }
+    }
+}
+/*============================================================================*/
+void fis::instance::envelope( const real_t * const ws,
+                              const size_t out,
+                              const real_t x0,
+                              const real_t x1,
+                              fis::instance::region &r ) const noexcept
+{
+    const fis::ruleTerm * const c = &program[ nPremises ];
+    const real_t xm = 0.5_re*( x0 + x1 );
+    real_t u = x0;
+    real_t by = 0.0_re; /*the aggregation starts from the zero set*/
+    real_t bs = 0.0_re;
+    real_t y0, s;
+
+    for ( size_t k = 0U ; k < nConsequents ; ++k ) {
+        if ( ( static_cast<size_t>( c[ k ].io ) == out ) && ( ws[ c[ k ].rule ] > 0.0_re ) ) {
+            termLine( ws, c[ k ], x0, xm, y0, s );
+            if ( ( y0 > by ) || ( !( y0 < by ) && ( s > bs ) ) ) {
+                by = y0;
+                bs = s;
+            }
+        }
+    }
+    /*walk the upper envelope of the sets, each switch goes to a steeper
+    set, so there are no more switches than sets*/
+    while ( u < x1 ) {
+        real_t t = x1;
+        real_t ny = by;
+        real_t ns = bs;
+
+        for ( size_t k = 0U ; k < nConsequents ; ++k ) {
+            if ( ( static_cast<size_t>( c[ k ].io ) == out ) && ( ws[ c[ k ].rule ] > 0.0_re ) ) {
+                termLine( ws, c[ k ], x0, xm, y0, s );
+                if ( s > bs ) {
+                    const real_t yu = y0 + ( s*( u - x0 ) );
+                    real_t tc = u + ( ( by - yu )/( s - bs ) );
+
+                    tc = ( tc < u ) ? u : tc;
+                    if ( ( tc < t ) || ( !( tc > t ) && ( s > ns ) ) ) {
+                        t = tc;
+                        ny = yu;
+                        ns = s;
+                    }
+                }
+            }
+        }
+        addPiece( r, u, t, by, by + ( bs*( t - u ) ) );
+        /*continue on the set that crosses at t*/
+        by = ny + ( ns*( t - u ) );
+        bs = ns;
+        u = t;
+    }
+}
+/*============================================================================*/
+void fis::instance::analyticSweep( const real_t * const ws,
+                                   const fis::output &o,
+                                   const size_t out,
+                                   fis::instance::region &r ) const noexcept
+{
+    const fis::ruleTerm * const c = &program[ nPremises ];
+    real_t x0 = o.min;
+
+    /*the sets are linear between two consecutive kinks*/
+    while ( x0 < o.max ) {
+        real_t x1 = o.max;
+
+        for ( size_t k = 0U ; k < nConsequents ; ++k ) {
+            if ( ( static_cast<size_t>( c[ k ].io ) == out ) && ( ws[ c[ k ].rule ] > 0.0_re ) ) {
+                x1 = nextKink( ws, c[ k ], x0, x1 );
+            }
+        }
+        if ( &Max == aggregate ) {
+            envelope( ws, out, x0, x1, r );
+        }
+        else { /*bounded sum*/
+            const real_t xm = 0.5_re*( x0 + x1 );
+            real_t ya = 0.0_re;
+            real_t sa = 0.0_re;
+            real_t y0, s;
+
+            for ( size_t k = 0U ; k < nConsequents ; ++k ) {
+                if ( ( static_cast<size_t>( c[ k ].io ) == out ) && ( ws[ c[ k ].rule ] > 0.0_re ) ) {
+                    termLine( ws, c[ k ], x0, xm, y0, s );
+                    ya += y0;
+                    sa += s;
+                }
+            }
+            const real_t yb = ya + ( sa*( x1 - x0 ) );
+            if ( ( ya > 1.0_re ) != ( yb > 1.0_re ) ) {
+                const real_t t = x0 + ( ( 1.0_re - ya )/sa );
+
+                addPiece( r, x0, t, ( ya > 1.0_re ) ? 1.0_re : ya, 1.0_re );
+                addPiece( r, t, x1, 1.0_re, ( yb > 1.0_re ) ? 1.0_re : yb );
+            }
+            else {
+                addPiece( r, x0, x1, ( ya > 1.0_re ) ? 1.0_re : ya, ( yb > 1.0_re ) ? 1.0_re : yb );
+            }
+        }
+        x0 = x1;
+    }
+}
+/*============================================================================*/
+real_t fis::instance::analyticDeFuzz( const real_t * const ws,
+                                      const fis::output &o,
+                                      const size_t out ) const noexcept
+{
+    fis::instance::region r = { 0.0_re, 0.0_re, -1.0_re, o.min, o.max, 0.0_re, o.min, 0U, false, false };
+    real_t d;
+
+    analyticSweep( ws, o, out, r );
+    if ( &deFuzzCentroid == deFuzz ) {
+        d = r.moment/r.area;
+    }
+    else if ( &deFuzzBisector == deFuzz ) {
+        r.target = 0.5_re*r.area;
+        r.area = 0.0_re;
+        r.pass = 1U;
+        analyticSweep( ws, o, out, r );
+        d = r.x;
+    }
+    else if ( &deFuzzMOM == deFuzz ) {
+        r.pass = 2U;
+        analyticSweep( ws, o, out, r );
+        d = 0.5_re*( r.xSmallest + r.xLargest );
+    }
+    else if ( &deFuzzLOM == deFuzz ) {
+        d = r.xLargest;
+    }
+    else {
+        d = r.xSmallest;
+    }
+
+    return d;
+}
+/*============================================================================*/
+size_t fis::instance::shapePoints( const fis::mfFunction s ) noexcept
+{
+    static const fis::mfFunction shape[ 18 ] = {
+        &TriMF, &TrapMF, &GBellMF, &GaussMF, &Gauss2MF, &SigMF, &DSigMF, &PSigMF,
+        &PiMF, &SMF, &ZMF, &SingletonMF, &ConcaveMF, &SpikeMF, &LinSMF, &LinZMF,
+        &RectangleMF, &CosineMF
+    };
+    static const size_t points[ 18 ] = {
+        3U, 4U, 3U, 2U, 4U, 2U, 4U, 4U,
+        4U, 2U, 2U, 1U, 2U, 2U, 2U, 2U,
+        2U, 2U
+    };
+    size_t n = 0U;
+
+    for ( size_t i = 0U ; i < 18U ; ++i ) {
+        if ( shape[ i ] == s ) {
+            n = points[ i ];
+            break;
+        }
+    }
+
+    return n;
+}
+/*============================================================================*/
+size_t fis::instance::coefficients( const fis::mf &m ) const noexcept
+{
+    size_t n = 0U;
+
+    if ( Sugeno == xType ) {
+        if ( &LinearMF == m.shape ) {
+            n = nInputs + 1U;
+        }
+        else if ( &ConstantMF == m.shape ) {
+            n = 1U;
+        }
+        else {
+            n = 0U;
+        }
+    }
+
+    return n;
+}
+/*============================================================================*/
+void fis::instance::shapeGradient( const fis::mfFunction s,
+                                   const real_t x,
+                                   const real_t * const p,
+                                   real_t * const g ) noexcept
+{
+    constexpr real_t pi = 3.14159265358979323846_re;
+    fis::input probe;
+
+    probe.value = x;
+    g[ 0 ] = 0.0_re;
+    g[ 1 ] = 0.0_re;
+    g[ 2 ] = 0.0_re;
+    g[ 3 ] = 0.0_re;
+    if ( &TriMF == s ) {
+        const real_t l = ( x - p[ 0 ] )/( p[ 1 ] - p[ 0 ] );
+        const real_t r = ( p[ 2 ] - x )/( p[ 2 ] - p[ 1 ] );
+
+        if ( l < r ) {
+            if ( ( l > 0.0_re ) && ( l < 1.0_re ) ) {
+                rampGradient( x, p[ 0 ], p[ 1 ], g );
+            }
+        }
+        else if ( ( r > 0.0_re ) && ( r < 1.0_re ) ) {
+            const real_t d = ( p[ 2 ] - p[ 1 ] )*( p[ 2 ] - p[ 1 ] );
+
+            g[ 1 ] = ( p[ 2 ] - x )/d;
+            g[ 2 ] = ( x - p[ 1 ] )/d;
+        }
+        else {
+            /*nothing to do*/
+        }
+    }
+    else if ( &TrapMF == s ) {
+        const real_t l = ( x - p[ 0 ] )/( p[ 1 ] - p[ 0 ] );
+        const real_t r = ( p[ 3 ] - x )/( p[ 3 ] - p[ 2 ] );
+        const real_t t = unitBound( ( l < 1.0_re ) ? l : 1.0_re );
+
+        if ( t < r ) {
+            if ( ( l > 0.0_re ) && ( l < 1.0_re ) ) {
+                rampGradient( x, p[ 0 ], p[ 1 ], g );
+            }
+        }
+        else if ( ( r > 0.0_re ) && ( r < 1.0_re ) ) {
+            const real_t d = ( p[ 3 ] - p[ 2 ] )*( p[ 3 ] - p[ 2 ] );
+
+            g[ 2 ] = ( p[ 3 ] - x )/d;
+            g[ 3 ] = ( x - p[ 2 ] )/d;
+        }
+        else {
+            /*nothing to do*/
+        }
+    }
+    else if ( &GBellMF == s ) {
+        const real_t u = ffmath::absf( ( x - p[ 2 ] )/p[ 0 ] );
+
+        if ( u > 0.0_re ) {
+            const real_t t = ffmath::pow( u, 2.0_re*p[ 1 ] );
+            const real_t y = 1.0_re/( 1.0_re + t );
+            const real_t k = t*y*y;
+
+            g[ 0 ] = 2.0_re*p[ 1 ]*k/p[ 0 ];
+            g[ 1 ] = -2.0_re*k*ffmath::log( u );
+            g[ 2 ] = 2.0_re*p[ 1 ]*k/( x - p[ 2 ] );
+        }
+    }
+    else if ( &GaussMF == s ) {
+        (void)gaussGradient( x, p, g );
+    }
+    else if ( &Gauss2MF == s ) {
+        const real_t f1 = ( x <= p[ 1 ] ) ? gaussGradient( x, p, g ) : 1.0_re;
+        const real_t f2 = ( x <= p[ 3 ] ) ? gaussGradient( x, &p[ 2 ], &g[ 2 ] ) : 1.0_re;
+
+        g[ 0 ] *= f2;
+        g[ 1 ] *= f2;
+        g[ 2 ] *= f1;
+        g[ 3 ] *= f1;
+    }
+    else if ( &SigMF == s ) {
+        (void)sigGradient( x, p, g );
+    }
+    else if ( ( &DSigMF == s ) || ( &PSigMF == s ) ) {
+        const real_t s1 = sigGradient( x, p, g );
+        const real_t s2 = sigGradient( x, &p[ 2 ], &g[ 2 ] );
+        real_t k1 = s2, k2 = s1;
+
+        if ( &DSigMF == s ) {
+            k1 = ( s1 >= s2 ) ? 1.0_re : -1.0_re;
+            k2 = -k1;
+        }
+        g[ 0 ] *= k1;
+        g[ 1 ] *= k1;
+        g[ 2 ] *= k2;
+        g[ 3 ] *= k2;
+    }
+    else if ( ( &SMF == s ) || ( &ZMF == s ) ) {
+        const real_t k = ( &SMF == s ) ? 1.0_re : -1.0_re;
+
+        sGradient( x, p, g );
+        g[ 0 ] *= k;
+        g[ 1 ] *= k;
+    }
+    else if ( &PiMF == s ) {
+        const real_t ys = SMF( &probe, p, 1U );
+        const real_t yz = ZMF( &probe, &p[ 2 ], 1U );
+
+        sGradient( x, p, g );
+        sGradient( x, &p[ 2 ], &g[ 2 ] );
+        g[ 0 ] *= yz;
+        g[ 1 ] *= yz;
+        g[ 2 ] *= -ys;
+        g[ 3 ] *= -ys;
+    }
+    else if ( &ConcaveMF == s ) {
+        const real_t i = p[ 0 ];
+        const real_t e = p[ 1 ];
+        const bool rising = ( i <= e ) && ( x < e );
+
+        if ( rising || ( ( i > e ) && ( x > e ) ) ) {
+            const real_t d = ( rising ) ? ( ( 2.0_re*e ) - i - x ) : ( i + x - ( 2.0_re*e ) );
+
+            g[ 0 ] = ( x - e )/( d*d );
+            g[ 1 ] = ( i - x )/( d*d );
+        }
+    }
+    else if ( &SpikeMF == s ) {
+        const real_t v = 10.0_re*( x - p[ 1 ] )/p[ 0 ];
+        const real_t y = ffmath::exp( -ffmath::absf( v ) );
+
+        g[ 0 ] = y*ffmath::absf( v )/p[ 0 ];
+        if ( v > 0.0_re ) {
+            g[ 1 ] = 10.0_re*y/p[ 0 ];
+        }
+        else if ( v < 0.0_re ) {
+            g[ 1 ] = -10.0_re*y/p[ 0 ];
+        }
+        else {
+            /*nothing to do*/
+        }
+    }
+    else if ( ( &LinSMF == s ) || ( &LinZMF == s ) ) {
+        /*both are ( x - a )/( b - a ) between the points*/
+        if ( ( p[ 0 ] < p[ 1 ] ) && ( x >= p[ 0 ] ) && ( x <= p[ 1 ] ) ) {
+            rampGradient( x, p[ 0 ], p[ 1 ], g );
+        }
+    }
+    else if ( &CosineMF == s ) {
+        if ( ( x >= ( p[ 0 ] - ( 0.5_re*p[ 1 ] ) ) ) && ( x <= ( p[ 0 ] + ( 0.5_re*p[ 1 ] ) ) ) ) {
+            const real_t t = 2.0_re*pi*( x - p[ 0 ] )/p[ 1 ];
+            const real_t sn = ffmath::sin( t );
+
+            g[ 0 ] = pi*sn/p[ 1 ];
+            g[ 1 ] = 0.5_re*sn*t/p[ 1 ];
+        }
+    }
+    else {
+        /*singleton and rectangle sets are flat on their points*/
+    }
+}
+/*============================================================================*/
+void fis::instance::operatorGradient( const methods_fcn op,
+                                      const real_t a,
+                                      const real_t b,
+                                      real_t &ga,
+                                      real_t &gb ) noexcept
+{
+    if ( &Min == op ) {
+        ga = ( a < b ) ? 1.0_re : 0.0_re;
+        gb = 1.0_re - ga;
+    }
+    else if ( &Max == op ) {
+        ga = ( a > b ) ? 1.0_re : 0.0_re;
+        gb = 1.0_re - ga;
+    }
+    else if ( &Prod == op ) {
+        ga = b;
+        gb = a;
+    }
+    else if ( &ProbOr == op ) {
+        ga = 1.0_re - b;
+        gb = 1.0_re - a;
+    }
+    else { /*bounded sum*/
+        ga = ( ( a + b ) < 1.0_re ) ? 1.0_re : 0.0_re;
+        gb = ga;
+    }
+}
+/*============================================================================*/
+void fis::instance::trainingSizes( size_t &q,
+                                   size_t &c,
+                                   size_t &cov,
+                                   size_t &co ) const noexcept
+{
+    q = 0U;
+    c = 0U;
+    cov = 0U;
+    co = 0U;
+    for ( size_t i = 0U ; ( nullptr != inMF ) && ( i < nMFInputs ) ; ++i ) {
+        q += shapePoints( inMF[ i ].shape );
+    }
+    for ( size_t o = 0U ; ( nullptr != outMF ) && ( o < nOutputs ) ; ++o ) {
+        size_t m = 0U;
+
+        for ( size_t i = 0U ; i < nMFOutputs ; ++i ) {
+            m += ( o == outMF[ i ].getIndex() ) ? coefficients( outMF[ i ] ) : 0U;
+        }
+        c += m;
+        cov += m*m;
+        co = ( m > co ) ? m : co;
+    }
+}
+/*============================================================================*/
+size_t fis::instance::getTrainingSize( void ) const noexcept
+{
+    size_t q, c, cov, co;
+
+    trainingSizes( q, c, cov, co );
+    /*parameters, information matrices, the scratch of the solver and the
+    gradient*/
+    return q + c + cov + ( 2U*co ) + q;
+}
+/*============================================================================*/
+size_t fis::instance::getAccumulatorSize( void ) const noexcept
+{
+    size_t q, c, cov, co;
+
+    trainingSizes( q, c, cov, co );
+    /*gradient, normal equations, error and count, then the scratch of a
+    sample*/
+    return q + cov + c + 2U + nPremises + nMFInputs + nRules + nMFOutputs + nOutputs + co;
+}
+/*============================================================================*/
+bool fis::instance::bindTrainer( fis::trainer &t ) const noexcept
+{
+    bool retValue = ( this == t.owner );
+
+    /*a trainer bound to another instance holds the parameters of its sets*/
+    if ( !retValue && ( nullptr == t.owner ) &&
+         ( nullptr != t.buffer ) && ( t.n >= getTrainingSize() ) ) {
+        real_t * const b = t.buffer;
+        size_t q, c, cov, co, k = 0U;
+
+        trainingSizes( q, c, cov, co );
+        for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
+            const size_t np = shapePoints( inMF[ i ].shape );
+
+            for ( size_t j = 0U ; j < np ; ++j ) {
+                b[ k + j ] = inMF[ i ].points[ j ];
+            }
+            k += np;
+        }
+        /*one information matrix per output, initialized to a small
+        diagonal*/
+        for ( size_t o = 0U, base = q + c ; o < nOutputs ; ++o ) {
+            const size_t k0 = k;
+            size_t m;
+
+            for ( size_t i = 0U ; i < nMFOutputs ; ++i ) {
+                const size_t nc = ( o == outMF[ i ].getIndex() ) ? coefficients( outMF[ i ] ) : 0U;
+
+                for ( size_t j = 0U ; j < nc ; ++j ) {
+                    b[ k + j ] = outMF[ i ].points[ j ];
+                }
+                k += nc;
+            }
+            m = k - k0;
+            for ( size_t a = 0U ; a < m ; ++a ) {
+                for ( size_t j = 0U ; j < m ; ++j ) {
+                    b[ base + ( a*m ) + j ] = ( a == j ) ? ( 1.0_re/FIS_TRAIN_COVARIANCE ) : 0.0_re;
+                }
+            }
+            base += m*m;
+        }
+        for ( k = 0U ; k < q ; ++k ) {
+            b[ q + c + cov + ( 2U*co ) + k ] = 0.0_re;
+        }
+        t.nPremise = q;
+        t.nConsequent = c;
+        t.nCovariance = cov;
+        t.nBlock = co;
+        t.owner = this;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+void fis::instance::trainOutputs( const real_t * const theta,
+                                  fis::context &ctx,
+                                  const real_t * const target,
+                                  const size_t q,
+                                  const size_t cov,
+                                  const size_t c ) const noexcept
+{
+    real_t * const S = &ctx.acc[ q ];
+    real_t * const b = &S[ cov ];
+    real_t * const sums = &b[ c ];
+    real_t * const dw = &sums[ 2U + nPremises + nMFInputs ];
+    real_t * const z = &dw[ nRules ];
+    real_t * const e = &z[ nMFOutputs ];
+    real_t * const phi = &e[ nOutputs ];
+
+    for ( size_t r = 0U ; r < nRules ; ++r ) {
+        dw[ r ] = 0.0_re;
+    }
+    if ( Mamdani == xType ) {
+        contextDeFuzzify( ctx, ctx.wi );
+        for ( size_t o = 0U ; o < nOutputs ; ++o ) {
+            e[ o ] = ctx.xOutput[ o ].value - target[ o ];
+            sums[ 0 ] += e[ o ]*e[ o ];
+        }
+        /*the de-Fuzzification is differentiated numerically on each rule
+        strength*/
+        for ( size_t r = 0U ; r < nRules ; ++r ) {
+            const real_t w = ctx.wi[ r ];
+            real_t d = 0.0_re;
+
+            ctx.wi[ r ] = w + FIS_TRAIN_STEP;
+            contextDeFuzzify( ctx, ctx.wi );
+            for ( size_t o = 0U ; o < nOutputs ; ++o ) {
+                d += e[ o ]*ctx.xOutput[ o ].value;
+            }
+            ctx.wi[ r ] = w - FIS_TRAIN_STEP;
+            contextDeFuzzify( ctx, ctx.wi );
+            for ( size_t o = 0U ; o < nOutputs ; ++o ) {
+                d -= e[ o ]*ctx.xOutput[ o ].value;
+            }
+            ctx.wi[ r ] = w;
+            dw[ r ] = d/FIS_TRAIN_STEP;
+        }
+    }
+    else { /*Sugeno and Tsukamoto systems*/
+        const fis::ruleTerm * const cq = &program[ nPremises ];
+        const bool wtsum = ( &deFuzzWtSum == deFuzz );
+
+        /*the fitted sets are evaluated with the coefficients of the
+        trainer*/
+        for ( size_t o = 0U, k = q ; o < nOutputs ; ++o ) {
+            for ( size_t i = 0U ; i < nMFOutputs ; ++i ) {
+                const fis::mf &m = outMF[ i ];
+
+                if ( o == m.getIndex() ) {
+                    const size_t nc = coefficients( m );
+                    const real_t * const p = ( ( nullptr != theta ) && ( nc > 0U ) ) ? &theta[ k ] : m.points;
+
+                    z[ i ] = m.h*m.shape( ctx.xInput, p, nInputs );
+                    k += nc;
+                }
+            }
+        }
+        for ( size_t o = 0U, kb = 0U, ks = 0U ; o < nOutputs ; ++o ) {
+            const fis::output &y = xOutput[ o ];
+            real_t sw = 0.0_re, swz = 0.0_re, d, g;
+            size_t m = 0U;
+
+            for ( size_t j = 0U ; j < nConsequents ; ++j ) {
+                const real_t w = ctx.wi[ cq[ j ].rule ];
+                /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+                const size_t set = static_cast<size_t>( ( ( cq[ j ].set < 0 ) ? -cq[ j ].set : cq[ j ].set ) - 1 );
+                /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+
+                if ( ( static_cast<size_t>( cq[ j ].io ) == o ) && ( w > 0.0_re ) ) {
+                    sw += w;
+                    swz += w*z[ set ];
+                }
+            }
+            d = ( wtsum ) ? swz : ( swz/sw );
+            e[ o ] = bound( d, y.min, y.max ) - target[ o ];
+            sums[ 0 ] += e[ o ]*e[ o ];
+            g = ( ( d >= y.min ) && ( d <= y.max ) ) ? ( 2.0_re*e[ o ] ) : 0.0_re;
+            /*derivative on the strengths, through their normalization for
+            wtaver*/
+            for ( size_t j = 0U ; j < nConsequents ; ++j ) {
+                const real_t w = ctx.wi[ cq[ j ].rule ];
+                /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+                const size_t set = static_cast<size_t>( ( ( cq[ j ].set < 0 ) ? -cq[ j ].set : cq[ j ].set ) - 1 );
+                /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+
+                if ( ( static_cast<size_t>( cq[ j ].io ) == o ) && ( w > 0.0_re ) ) {
+                    dw[ cq[ j ].rule ] += g*( ( wtsum ) ? z[ set ] : ( ( z[ set ] - d )/sw ) );
+                }
+            }
+            /*the output is linear on the coefficients of its sets, the
+            regressor of each one is its strength, normalized for wtaver*/
+            for ( size_t i = 0U ; i < nMFOutputs ; ++i ) {
+                const size_t nc = ( o == outMF[ i ].getIndex() ) ? coefficients( outMF[ i ] ) : 0U;
+                real_t wb = 0.0_re;
+
+                for ( size_t j = 0U ; ( nc > 0U ) && ( j < nConsequents ) ; ++j ) {
+                    /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+                    const size_t set = static_cast<size_t>( ( ( cq[ j ].set < 0 ) ? -cq[ j ].set : cq[ j ].set ) - 1 );
+                    /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+
+                    wb += ( ( static_cast<size_t>( cq[ j ].io ) == o ) && ( set == i ) ) ? ctx.wi[ cq[ j ].rule ] : 0.0_re;
+                }
+                if ( wtsum ) {
+                    wb = outMF[ i ].h*wb;
+                }
+                else {
+                    wb = ( sw > 0.0_re ) ? ( outMF[ i ].h*wb/sw ) : 0.0_re;
+                }
+                for ( size_t j = 0U ; j < nc ; ++j ) {
+                    phi[ m + j ] = ( ( nc > 1U ) && ( j < nInputs ) ) ? ( wb*ctx.xInput[ j ].value ) : wb;
+                }
+                m += nc;
+            }
+            /*normal equations, only the lower triangle is kept*/
+            if ( ( m > 0U ) && ( sw > 0.0_re ) ) {
+                for ( size_t a = 0U ; a < m ; ++a ) {
+                    b[ kb + a ] += phi[ a ]*target[ o ];
+                    for ( size_t j = 0U ; j <= a ; ++j ) {
+                        S[ ks + ( a*m ) + j ] += phi[ a ]*phi[ j ];
+                    }
+                }
+            }
+            kb += m;
+            ks += m*m;
+        }
+    }
+}
+/*============================================================================*/
+void fis::instance::trainSample( const real_t * const theta,
+                                 fis::context &ctx,
+                                 const real_t * const in,
+                                 const real_t * const target,
+                                 const size_t q,
+                                 const size_t cov,
+                                 const size_t c ) const noexcept
+{
+    real_t * const grad = ctx.acc;
+    real_t * const sums = &ctx.acc[ q + cov + c ];
+    real_t * const dv = &sums[ 2U ];
+    real_t * const dfx = &dv[ nPremises ];
+    real_t * const dw = &dfx[ nMFInputs ];
+    size_t k = 0U;
+
+    for ( size_t i = 0U ; i < nInputs ; ++i ) {
+        ctx.xInput[ i ].min = xInput[ i ].min;
+        ctx.xInput[ i ].max = xInput[ i ].max;
+        ctx.xInput[ i ].value = bound( in[ i ], xInput[ i ].min, xInput[ i ].max );
+    }
+    /*the trained sets are evaluated on their shape with the points of the
+    trainer, their lookup tables are not used*/
+    for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
+        const fis::mf &m = inMF[ i ];
+        const fis::input &x = ctx.xInput[ m.getIndex() ];
+        const size_t np = shapePoints( m.shape );
+
+        if ( np > 0U ) {
+            ctx.fx[ i ] = m.h*m.shape( &x, ( nullptr != theta ) ? &theta[ k ] : m.points, 1U );
+            k += np;
+        }
+        else if ( nullptr != m.table ) {
+            const real_t u = ( x.value - x.min )*static_cast<real_t>( m.nTable - 1U )/( x.max - x.min );
+
+            ctx.fx[ i ] = tableLookup( m.table, m.nTable, u );
+        }
+        else if ( nullptr != m.shape ) {
+            ctx.fx[ i ] = m.h*m.shape( &x, m.points, 1U );
+        }
+        else {
+            ctx.fx[ i ] = 0.0_re;
+        }
+    }
+    /*rule strengths, with the derivative on each of their terms*/
+    k = 0U;
+    while ( k < nPremises ) {
+        const size_t r = program[ k ].rule;
+        const size_t first = k;
+        real_t s = Sum( 0.0_re, fuzzValue( ctx.fx, program[ first ].set, 1U, 0U ) );
+
+        dv[ first ] = 1.0_re;
+        for ( ++k ; ( k < nPremises ) && ( r == program[ k ].rule ) ; ++k ) {
+            const methods_fcn op = ( Q_FIS_AND == program[ k ].connector ) ? andOp : orOp;
+            const real_t v = fuzzValue( ctx.fx, program[ k ].set, 1U, 0U );
+            real_t ga, gb;
+
+            operatorGradient( op, s, v, ga, gb );
+            for ( size_t j = first ; j < k ; ++j ) {
+                dv[ j ] *= ga;
+            }
+            dv[ k ] = gb;
+            s = op( s, v );
+        }
+        ctx.wi[ r ] = ( nullptr != ruleWeight ) ? ( s*bound( ruleWeight[ r ] ) ) : s;
+    }
+    trainOutputs( theta, ctx, target, q, cov, c );
+    sums[ 1 ] += 1.0_re;
+    /*back from the strengths to the membership values and their points*/
+    for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
+        dfx[ i ] = 0.0_re;
+    }
+    for ( k = 0U ; k < nPremises ; ++k ) {
+        const size_t r = program[ k ].rule;
+        const fis::rules set = program[ k ].set;
+        /*cstat -CERT-INT30-C_a -CERT-INT32-C_a*/
+        const size_t i = static_cast<size_t>( ( ( set < 0 ) ? -set : set ) - 1 );
+        /*cstat +CERT-INT30-C_a +CERT-INT32-C_a*/
+        const real_t rw = ( nullptr != ruleWeight ) ? bound( ruleWeight[ r ] ) : 1.0_re;
+
+        if ( ( ctx.fx[ i ] >= 0.0_re ) && ( ctx.fx[ i ] <= 1.0_re ) ) {
+            const real_t d = dw[ r ]*rw*dv[ k ];
+
+            dfx[ i ] += ( set < 0 ) ? -d : d;
+        }
+    }
+    k = 0U;
+    for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
+        const fis::mf &m = inMF[ i ];
+        const size_t np = shapePoints( m.shape );
+
+        if ( np > 0U ) {
+            real_t g[ 4 ];
+
+            shapeGradient( m.shape, ctx.xInput[ m.getIndex() ].value, ( nullptr != theta ) ? &theta[ k ] : m.points, g );
+            for ( size_t j = 0U ; j < np ; ++j ) {
+                grad[ k + j ] += dfx[ i ]*m.h*g[ j ];
+            }
+            k += np;
+        }
+    }
+}
+/*============================================================================*/
+bool fis::instance::trainAccumulate( const fis::trainer &t,
+                                     fis::context &ctx,
+                                     const real_t *inputs,
+                                     const real_t *outputs,
+                                     const size_t count ) const noexcept
+{
+    const bool retValue = ( nullptr != inputs ) && ( nullptr != outputs ) &&
+                          ( nullptr != program ) && ( nullptr != inMF ) &&
+                          ( nullptr != outMF ) &&
+                          ( ( nullptr == t.owner ) || ( this == t.owner ) ) &&
+                          ( nullptr != ctx.xInput ) &&
+                          ( ctx.nInputs >= nInputs ) && ( ctx.nOutputs >= nOutputs ) &&
+                          ( ctx.nMFInputs >= nMFInputs ) && ( ctx.nRules >= nRules ) &&
+                          ( nullptr != ctx.acc ) && ( ctx.nAcc >= getAccumulatorSize() );
+
+    if ( retValue ) {
+        /*a trainer not used yet takes the parameters of the instance*/
+        const real_t * const theta = ( this == t.owner ) ? t.buffer : nullptr;
+        size_t q, c, cov, co;
+
+        trainingSizes( q, c, cov, co );
+        for ( size_t k = 0U ; k < count ; ++k ) {
+            trainSample( theta, ctx, &inputs[ k*nInputs ], &outputs[ k*nOutputs ], q, cov, c );
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool fis::instance::trainReduce( fis::trainer &t,
+                                 fis::context * const ctx,
+                                 const size_t nCtx ) const noexcept
+{
+    size_t q = 0U, c = 0U, cov = 0U, co = 0U;
+    real_t nk = 0.0_re, err = 0.0_re;
+    bool retValue = ( nullptr != ctx ) && ( nCtx > 0U ) && ( nullptr != program ) &&
+                    ( nullptr != inMF ) && ( nullptr != outMF );
+
+    if ( retValue ) {
+        trainingSizes( q, c, cov, co );
+    }
+    for ( size_t i = 0U ; retValue && ( i < nCtx ) ; ++i ) {
+        retValue = ( nullptr != ctx[ i ].acc ) && ( ctx[ i ].nAcc >= getAccumulatorSize() );
+        if ( retValue ) {
+            err += ctx[ i ].acc[ q + cov + c ];
+            nk += ctx[ i ].acc[ q + cov + c + 1U ];
+        }
+    }
+    retValue = retValue && ( nk > 0.0_re ) && bindTrainer( t );
+    if ( retValue ) {
+        real_t * const p = t.buffer;
+        real_t * const R = &p[ q + c ];
+        real_t * const dg = &R[ cov ];
+        real_t * const x = &dg[ co ];
+        real_t * const g = &x[ co ];
+        size_t k = 0U;
+
+        t.error = err/( nk*static_cast<real_t>( nOutputs ) );
+        /*the coefficients take the step that solves ( R + S )*d = b - S*p,
+        where R holds the information of the previous steps*/
+        for ( size_t o = 0U, kb = 0U, ks = 0U ; o < nOutputs ; ++o ) {
+            real_t * const th = &p[ q + kb ];
+            real_t * const Ro = &R[ ks ];
+            size_t m = 0U;
+
+            for ( size_t i = 0U ; i < nMFOutputs ; ++i ) {
+                m += ( o == outMF[ i ].getIndex() ) ? coefficients( outMF[ i ] ) : 0U;
+            }
+            for ( size_t a = 0U ; a < m ; ++a ) {
+                x[ a ] = 0.0_re;
+                for ( size_t i = 0U ; i < nCtx ; ++i ) {
+                    const real_t * const S = &ctx[ i ].acc[ q + ks ];
+
+                    x[ a ] += ctx[ i ].acc[ q + cov + kb + a ];
+                    for ( size_t j = 0U ; j < m ; ++j ) {
+                        x[ a ] -= S[ ( j <= a ) ? ( ( a*m ) + j ) : ( ( j*m ) + a ) ]*th[ j ];
+                    }
+                    for ( size_t j = 0U ; j <= a ; ++j ) {
+                        Ro[ ( a*m ) + j ] += S[ ( a*m ) + j ];
+                    }
+                }
+            }
+            choleskySolve( Ro, dg, x, m );
+            for ( size_t a = 0U ; a < m ; ++a ) {
+                th[ a ] += x[ a ];
+            }
+            kb += m;
+            ks += m*m;
+        }
+        /*the points of the input sets take one step of gradient descent*/
+        for ( k = 0U ; k < q ; ++k ) {
+            g[ k ] = 0.0_re;
+            for ( size_t i = 0U ; i < nCtx ; ++i ) {
+                g[ k ] += ctx[ i ].acc[ k ];
+            }
+            g[ k ] /= nk;
+            p[ k ] -= t.rate*g[ k ];
+        }
+        /*a large step can swap the points of a set, so they are sorted
+        again to keep a <= b <= c <= d*/
+        k = 0U;
+        for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
+            const size_t np = shapePoints( inMF[ i ].shape );
+
+            if ( ( &TriMF == inMF[ i ].shape ) || ( &TrapMF == inMF[ i ].shape ) || ( &PiMF == inMF[ i ].shape ) ) {
+                for ( size_t j = k + 1U ; j < ( k + np ) ; ++j ) {
+                    const real_t v = p[ j ];
+                    size_t a = j;
+
+                    for ( ; ( a > k ) && ( p[ a - 1U ] > v ) ; --a ) {
+                        p[ a ] = p[ a - 1U ];
+                    }
+                    p[ a ] = v;
+                }
+            }
+            k += np;
+        }
+        for ( size_t i = 0U ; i < nCtx ; ++i ) {
+            for ( k = 0U ; k < ( q + cov + c + 2U ) ; ++k ) {
+                ctx[ i ].acc[ k ] = 0.0_re;
+            }
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool fis::instance::applyTraining( const fis::trainer &t ) noexcept
+{
+    const bool retValue = ( this == t.owner ) && ( nullptr != inMF ) && ( nullptr != outMF );
+
+    if ( retValue ) {
+        size_t k = 0U;
+
+        for ( size_t i = 0U ; i < nMFInputs ; ++i ) {
+            const size_t np = shapePoints( inMF[ i ].shape );
+
+            if ( np > 0U ) {
+                inMF[ i ].points = &t.buffer[ k ];
+                inMF[ i ].table = nullptr;
+                inMF[ i ].nTable = 0U;
+                k += np;
+            }
+        }
+        for ( size_t o = 0U ; o < nOutputs ; ++o ) {
+            for ( size_t i = 0U ; i < nMFOutputs ; ++i ) {
+                const size_t nc = ( o == outMF[ i ].getIndex() ) ? coefficients( outMF[ i ] ) : 0U;
+
+                if ( nc > 0U ) {
+                    outMF[ i ].points = &t.buffer[ k ];
+                    k += nc;
+                }
+            }
         }
     }
 
@@ -11,6 +11,14 @@
 
 #include <include/qlibs_types.hpp>
 
+/*the presets use the bitwise engine on small targets, where an 8KiB
+table per polynomial does not fit, unless QLIBS_CRC_FAST is defined*/
+#if !defined( QLIBS_CRC_FAST ) && !defined( QLIBS_CRC_BITWISE )
+    #if defined( __AVR__ ) || defined( __MSP430__ ) || ( defined( __ARM_ARCH_PROFILE ) && ( 'M' == __ARM_ARCH_PROFILE ) )
+        #define QLIBS_CRC_BITWISE
+    #endif
+#endif
+
 /**
 * @brief The qLibs++ library namespace.
 */
@@ -30,10 +38,175 @@ namespace qlibs {
         CRC32,       /*!< 32-Bit Cyclic Redundancy Check*/
     };
 
+    /*! @cond */
+    namespace impl {
+        /*cstat -MISRAC++2008-5-0-8 -MISRAC++2008-5-0-10*/
+        constexpr uint32_t crcWidth( const crcMode mode )
+        {
+            return ( CRC8 == mode ) ? 8U : ( ( CRC16 == mode ) ? 16U : 32U );
+        }
+        constexpr uint32_t crcReflect( const uint32_t x,
+                                       const uint32_t nBits,
+                                       const uint32_t r = 0U )
+        {
+            return ( 0U == nBits ) ? r
+                                   : crcReflect( x >> 1U, nBits - 1U, ( r << 1U ) | ( x & 1U ) );
+        }
+        /*register polynomial, left-aligned for MSB-first or reflected for LSB-first*/
+        constexpr uint32_t crcPoly( const uint32_t poly,
+                                    const uint32_t width,
+                                    const bool reflected )
+        {
+            return ( reflected ) ? crcReflect( poly, width )
+                                 : ( ( poly << ( 32U - width ) ) & 0xFFFFFFFFU );
+        }
+        constexpr uint32_t crcShift( const uint32_t c,
+                                     const uint32_t poly,
+                                     const bool reflected,
+                                     const uint32_t nBits )
+        {
+            return ( 0U == nBits ) ? c
+                   : crcShift( ( reflected ) ? ( ( 0U != ( c & 1U ) ) ? ( ( c >> 1U ) ^ poly ) : ( c >> 1U ) )
+                                             : ( ( 0U != ( c & 0x80000000U ) ) ? ( ( c << 1U ) ^ poly ) : ( c << 1U ) ),
+                               poly, reflected, nBits - 1U );
+        }
+        constexpr uint32_t crcEntry0( const uint32_t b,
+                                      const uint32_t poly,
+                                      const bool reflected )
+        {
+            return crcShift( ( reflected ) ? b : ( b << 24U ), poly, reflected, 8U );
+        }
+        /*extend the entry of the previous slice by one zero byte*/
+        constexpr uint32_t crcEntryK( const uint32_t c,
+                                      const uint32_t poly,
+                                      const bool reflected,
+                                      const uint32_t k )
+        {
+            return ( 0U == k ) ? c
+                   : crcEntryK( ( reflected ) ? ( ( c >> 8U ) ^ crcEntry0( c & 0xFFU, poly, reflected ) )
+                                              : ( ( c << 8U ) ^ crcEntry0( c >> 24U, poly, reflected ) ),
+                                poly, reflected, k - 1U );
+        }
+        constexpr uint32_t crcEntry( const size_t i,
+                                     const uint32_t poly,
+                                     const bool reflected )
+        {
+            return crcEntryK( crcEntry0( static_cast<uint32_t>( i & 0xFFU ), poly, reflected ),
+                              poly, reflected, static_cast<uint32_t>( i >> 8U ) );
+        }
+        /*cstat +MISRAC++2008-5-0-8 +MISRAC++2008-5-0-10*/
+
+        template<size_t... I>
+        struct indexList {};
+        template<typename A, typename B>
+        struct indexConcat;
+        template<size_t... A, size_t... B>
+        struct indexConcat<indexList<A...>, indexList<B...>> {
+            using type = indexList<A..., ( sizeof...( A ) + B )...>;
+        };
+        template<size_t N>
+        struct indexRange {
+            using type = typename indexConcat<typename indexRange<N/2U>::type,
+                                              typename indexRange<N - N/2U>::type>::type;
+        };
+        template<>
+        struct indexRange<0U> {
+            using type = indexList<>;
+        };
+        template<>
+        struct indexRange<1U> {
+            using type = indexList<0U>;
+        };
+
+        /*slice-by-8 lookup table : entry [k*256 + b] holds the register
+        contribution of byte b followed by k zero bytes*/
+        template<uint32_t poly, bool reflected, typename = typename indexRange<2048U>::type>
+        struct crcTable;
+        template<uint32_t poly, bool reflected, size_t... I>
+        struct crcTable<poly, reflected, indexList<I...>> {
+            static constexpr uint32_t lut[ sizeof...( I ) ] = { crcEntry( I, poly, reflected )... };
+        };
+        template<uint32_t poly, bool reflected, size_t... I>
+        constexpr uint32_t crcTable<poly, reflected, indexList<I...>>::lut[ sizeof...( I ) ];
+
+        /*x^n mod G, with G = x^32 + g*/
+        constexpr uint32_t crcXpowStep( const uint32_t r,
+                                        const uint32_t g,
+                                        const uint32_t k )
+        {
+            return ( 0U == k ) ? r
+                   : crcXpowStep( ( 0U != ( r & 0x80000000U ) ) ? ( ( r << 1U ) ^ g ) : ( r << 1U ), g, k - 1U );
+        }
+        constexpr uint32_t crcXpow( const uint32_t n,
+                                    const uint32_t g )
+        {
+            return ( n <= 32U ) ? crcXpowStep( 1U, g, n )
+                                : crcXpowStep( crcXpow( n - 32U, g ), g, 32U );
+        }
+        constexpr uint64_t crcFoldKey( const uint32_t n,
+                                       const uint32_t g,
+                                       const bool reflected )
+        {
+            return ( reflected ) ? ( static_cast<uint64_t>( crcReflect( crcXpow( n - 1U, g ), 32U ) ) << 32U )
+                                 : static_cast<uint64_t>( crcXpow( n, g ) );
+        }
+
+        /*carry-less multiply folding constants for 128 and 512-bit distances
+        stored as {low, high} lane pairs*/
+        template<uint32_t g, bool reflected>
+        struct crcFold {
+            static constexpr uint64_t keys[ 4 ] = {
+                crcFoldKey( ( reflected ) ? 192U : 128U, g, reflected ),
+                crcFoldKey( ( reflected ) ? 128U : 192U, g, reflected ),
+                crcFoldKey( ( reflected ) ? 576U : 512U, g, reflected ),
+                crcFoldKey( ( reflected ) ? 512U : 576U, g, reflected ),
+            };
+        };
+        template<uint32_t g, bool reflected>
+        constexpr uint64_t crcFold<g, reflected>::keys[ 4 ];
+    }
+    /*! @endcond */
+
+    template<crcMode mode, uint32_t poly, uint32_t init, bool refIn, bool refOut, uint32_t xorOut>
+    class crcContext;
+
     class crc {
+        template<crcMode, uint32_t, uint32_t, bool, bool, uint32_t>
+        friend class crcContext;
         private:
             static uint32_t reflect( uint32_t xData,
                                      const uint8_t nBits ) noexcept;
+            static uint32_t sliceBy8( const uint32_t * const lut,
+                                      const uint32_t width,
+                                      const void * const pData,
+                                      const size_t length,
+                                      const uint32_t init,
+                                      const bool refIn,
+                                      const bool refOut,
+                                      const uint32_t xorOut ) noexcept;
+            static uint32_t engine( const uint32_t * const lut,
+                                    const uint64_t * const keys,
+                                    const uint32_t poly,
+                                    const uint32_t width,
+                                    const void * const pData,
+                                    const size_t length,
+                                    const uint32_t init,
+                                    const bool refIn,
+                                    const bool refOut,
+                                    const uint32_t xorOut ) noexcept;
+            static uint32_t mulxn( uint32_t value,
+                                   const uint32_t poly,
+                                   const uint32_t width,
+                                   size_t nBytes ) noexcept;
+            template<crcMode mode, uint32_t poly, uint32_t init = 0U, bool refIn = false, bool refOut = false, uint32_t xorOut = 0U>
+            static inline uint32_t preset( const void * const pData, const size_t length ) noexcept
+            {
+                #if defined( QLIBS_CRC_BITWISE )
+                    return generic( mode, pData, length, poly, init, refIn, refOut, xorOut );
+                #else
+                    return fast<mode, poly, init, refIn, refOut, xorOut>( pData, length );
+                #endif
+            }
             crc() = default;
         public:
 
@@ -61,6 +234,68 @@ namespace qlibs {
                                      bool refOut = false,
                                      uint32_t xorOut = 0U ) noexcept;
 
+            /**
+            * @brief Calculates in one pass the common @a width bit CRC value for a
+            * block of data using a slice-by-8 table-driven engine. The lookup
+            * table is generated at compile-time from the template parameters.
+            * @note The result is the same as the one obtained with
+            * crc::generic() using the same parameter set, but eight bytes are
+            * processed per iteration. Each distinct @a poly / @a refIn pair
+            * adds a 8KiB lookup table to the read-only memory.
+            * @note On x86-64 targets, large blocks are processed with the
+            * SSE4.2 @c crc32 instruction for the CRC-32C polynomial and with
+            * PCLMULQDQ folding for any other polynomial. The CPU features are
+            * detected at runtime and the table-driven engine is used when they
+            * are not available. Define @c QLIBS_CRC_NO_HW to disable this
+            * backend.
+            * @tparam mode To select the CRC calculation mode. Only the
+            * following values are supported: ::CRC8, ::CRC16 and ::CRC32.
+            * @tparam poly CRC polynomial value.
+            * @tparam init CRC initial value.
+            * @tparam refIn If @c true, the input data is reflected before processing.
+            * @tparam refOut If @c true, the CRC result is reflected before output.
+            * @tparam xorOut The final XOR value.
+            * @param[in] pData A pointer to the block of data.
+            * @param[in] length The number of bytes in @a data.
+            * @return The CRC value for @a data.
+            */
+            template<crcMode mode, uint32_t poly, uint32_t init = 0U, bool refIn = false, bool refOut = false, uint32_t xorOut = 0U>
+            static inline uint32_t fast( const void * const pData,
+                                         const size_t length ) noexcept
+            {
+                static_assert( ( CRC8 == mode ) || ( CRC16 == mode ) || ( CRC32 == mode ), "Unsupported CRC mode" );
+                return engine( impl::crcTable<impl::crcPoly( poly, impl::crcWidth( mode ), refIn ), refIn>::lut,
+                               impl::crcFold<impl::crcPoly( poly, impl::crcWidth( mode ), false ), refIn>::keys,
+                               poly, impl::crcWidth( mode ), pData, length, init, refIn, refOut, xorOut );
+            }
+
+            /**
+            * @brief Obtain the CRC of the concatenation of two blocks of data
+            * A and B from their individual CRC values, without processing the
+            * data again. This allows to split a large block of data in chunks
+            * that are processed in parallel and then merge the partial results.
+            * @note The partial CRC values should be computed with the same
+            * parameter set supplied here and both blocks must be non-empty.
+            * @param[in] mode To select the CRC calculation mode. Only the following
+            * values are supported: ::CRC8, ::CRC16 and ::CRC32.
+            * @param[in] crcA The CRC value of the block A.
+            * @param[in] crcB The CRC value of the block B.
+            * @param[in] lengthB The number of bytes in the block B.
+            * @param[in] poly CRC polynomial value.
+            * @param[in] init CRC initial value.
+            * @param[in] refOut If @c true, the CRC result is reflected before output.
+            * @param[in] xorOut The final XOR value.
+            * @return The CRC value for the block A followed by the block B.
+            */
+            static uint32_t combine( crcMode mode,
+                                     const uint32_t crcA,
+                                     const uint32_t crcB,
+                                     const size_t lengthB,
+                                     uint32_t poly,
+                                     const uint32_t init = 0U,
+                                     bool refOut = false,
+                                     uint32_t xorOut = 0U ) noexcept;
+
             /**
             * @brief CRC-8 with poly = 0x07 init = 0x00 refIn = false refOut = false
             * xorOut= 0x00
@@ -70,7 +305,7 @@ namespace qlibs {
             */
             static inline uint8_t crc8( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x07U ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x07U>( pData, length ) );
             }
 
             /**
@@ -82,7 +317,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_CDMA2000( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x9BU, 0xFFU ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x9BU, 0xFFU>( pData, length ) );
             }
 
             /**
@@ -94,7 +329,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_DARC( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x39U, 0U, true, true ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x39U, 0U, true, true>( pData, length ) );
             }
 
             /**
@@ -106,7 +341,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_DVS_S2( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0xD5U ) );
+                return static_cast<uint8_t>( preset<CRC8, 0xD5U>( pData, length ) );
             }
 
             /**
@@ -118,7 +353,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_EBU( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x1DU, 0xFFU, true, true ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x1DU, 0xFFU, true, true>( pData, length ) );
             }
 
             /**
@@ -130,7 +365,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_I_CODE( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x1DU, 0xFDU ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x1DU, 0xFDU>( pData, length ) );
             }
 
             /**
@@ -142,7 +377,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_ITU( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x07U, 0U, false, false, 0x55U ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x07U, 0U, false, false, 0x55U>( pData, length ) );
             }
 
             /**
@@ -154,7 +389,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_MAXIM( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x31U, 0U, true, true ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x31U, 0U, true, true>( pData, length ) );
             }
 
             /**
@@ -166,7 +401,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_ROHC( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x07U, 0xFFU, true, true ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x07U, 0xFFU, true, true>( pData, length ) );
             }
 
             /**
@@ -178,7 +413,7 @@ namespace qlibs {
              */
             static inline uint8_t crc8_WCDMA( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint8_t>( generic( CRC8, pData, length, 0x9BU, 0U, true, true ) );
+                return static_cast<uint8_t>( preset<CRC8, 0x9BU, 0U, true, true>( pData, length ) );
             }
 
             /**
@@ -190,7 +425,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_CCITT_FALSE( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0xFFFFU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0xFFFFU>( pData, length ) );
             }
 
             /**
@@ -202,7 +437,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_ARC( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x8005U, 0U, true, true ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x8005U, 0U, true, true>( pData, length ) );
             }
 
             /**
@@ -214,7 +449,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_AUG_CCITT( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0x1D0FU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0x1D0FU>( pData, length ) );
             }
 
             /**
@@ -226,7 +461,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_BUYPASS( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x8005U ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x8005U>( pData, length ) );
             }
 
             /**
@@ -238,7 +473,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_CDMA2000( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0xC867U, 0xFFFFU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0xC867U, 0xFFFFU>( pData, length ) );
             }
 
             /**
@@ -250,7 +485,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_DDS_110( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x8005U, 0x800DU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x8005U, 0x800DU>( pData, length ) );
             }
 
             /**
@@ -262,7 +497,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_DECT_R( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x0589U, 0U, false, false, 0x0001U ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x0589U, 0U, false, false, 0x0001U>( pData, length ) );
             }
 
             /**
@@ -274,7 +509,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_DECT_X( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x0589U ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x0589U>( pData, length ) );
             }
 
             /**
@@ -286,7 +521,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_DNP( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x3D65U, 0U, true, true, 0xFFFFU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x3D65U, 0U, true, true, 0xFFFFU>( pData, length ) );
             }
 
             /**
@@ -298,7 +533,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_EN_13757( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x3D65U, 0U, false, false, 0xFFFFU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x3D65U, 0U, false, false, 0xFFFFU>( pData, length ) );
             }
 
             /**
@@ -310,7 +545,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_GENIBUS( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0xFFFFU, false, false, 0xFFFFU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0xFFFFU, false, false, 0xFFFFU>( pData, length ) );
             }
 
             /**
@@ -322,7 +557,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_MAXIM( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x8005U, 0U, true, true, 0xFFFFU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x8005U, 0U, true, true, 0xFFFFU>( pData, length ) );
             }
 
             /**
@@ -334,7 +569,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_MCRF4XX( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0xFFFFU, true, true ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0xFFFFU, true, true>( pData, length ) );
             }
 
             /**
@@ -346,7 +581,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_RIELLO( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0xB2AAU, true, true ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0xB2AAU, true, true>( pData, length ) );
             }
 
             /**
@@ -358,7 +593,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_T10_DIF( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x8BB7U ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x8BB7U>( pData, length ) );
             }
 
             /**
@@ -370,7 +605,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_TELEDISK( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0xA097U ) );
+                return static_cast<uint16_t>( preset<CRC16, 0xA097U>( pData, length ) );
             }
 
             /**
@@ -382,7 +617,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_TMS37157( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0x89ECU, true, true ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0x89ECU, true, true>( pData, length ) );
             }
 
             /**
@@ -394,7 +629,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_USB( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x8005U, 0xFFFFU, true, true, 0xFFFFU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x8005U, 0xFFFFU, true, true, 0xFFFFU>( pData, length ) );
             }
 
             /**
@@ -406,7 +641,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_A( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0xc6c6U, true, true ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0xc6c6U, true, true>( pData, length ) );
             }
 
             /**
@@ -418,7 +653,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_KERMIT( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0U, true, true ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0U, true, true>( pData, length ) );
             }
 
             /**
@@ -430,7 +665,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_MODBUS( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x8005U, 0xFFFFU, true, true ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x8005U, 0xFFFFU, true, true>( pData, length ) );
             }
 
             /**
@@ -442,7 +677,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_X_25( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U, 0xFFFFU, true, true, 0xFFFFU ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U, 0xFFFFU, true, true, 0xFFFFU>( pData, length ) );
             }
 
             /**
@@ -454,7 +689,7 @@ namespace qlibs {
              */
             static inline uint16_t crc16_XMODEM( const void * const pData, const size_t length ) noexcept
             {
-                return static_cast<uint16_t>( generic( CRC16, pData, length, 0x1021U ) );
+                return static_cast<uint16_t>( preset<CRC16, 0x1021U>( pData, length ) );
             }
 
             /**
@@ -466,7 +701,7 @@ namespace qlibs {
              */
             static inline uint32_t crc32( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0x04C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU  );
+                return preset<CRC32, 0x04C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>( pData, length );
             }
 
             /**
@@ -478,7 +713,7 @@ namespace qlibs {
              */
             static inline uint32_t crc32_BZIP2( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0x04C11DB7U, 0xFFFFFFFFU, false, false, 0xFFFFFFFFU  );
+                return preset<CRC32, 0x04C11DB7U, 0xFFFFFFFFU, false, false, 0xFFFFFFFFU>( pData, length );
             }
 
             /**
@@ -490,7 +725,7 @@ namespace qlibs {
              */
             static inline uint32_t crc32_C( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0x1EDC6F41U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU  );
+                return preset<CRC32, 0x1EDC6F41U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>( pData, length );
             }
 
             /**
@@ -502,7 +737,7 @@ namespace qlibs {
              */
             static inline uint32_t crc32_D( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0xA833982BU, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU  );
+                return preset<CRC32, 0xA833982BU, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>( pData, length );
             }
 
             /**
@@ -514,7 +749,7 @@ namespace qlibs {
              */
             static inline uint32_t crc32_JAMCRC( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0x04C11DB7U, 0xFFFFFFFFU, true, true );
+                return preset<CRC32, 0x04C11DB7U, 0xFFFFFFFFU, true, true>( pData, length );
             }
 
             /**
@@ -526,7 +761,7 @@ namespace qlibs {
              */
             static inline uint32_t crc32_MPEG2( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0x04C11DB7U, 0xFFFFFFFFU );
+                return preset<CRC32, 0x04C11DB7U, 0xFFFFFFFFU>( pData, length );
             }
 
             /**
@@ -538,7 +773,7 @@ namespace qlibs {
              */
             static inline uint32_t crc32_POSIX( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0x04C11DB7U, 0U, false, false, 0xFFFFFFFFU  );
+                return preset<CRC32, 0x04C11DB7U, 0U, false, false, 0xFFFFFFFFU>( pData, length );
             }
 
             /**
@@ -550,7 +785,7 @@ namespace qlibs {
              */
             static inline uint32_t crc32_Q( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0x814141ABU );
+                return preset<CRC32, 0x814141ABU>( pData, length );
             }
 
             /**
@@ -562,10 +797,103 @@ namespace qlibs {
              */
             static inline uint32_t crc32_XFER( const void * const pData, const size_t length ) noexcept
             {
-                return generic( CRC32, pData, length, 0x000000AFU );
+                return preset<CRC32, 0x000000AFU>( pData, length );
+            }
+    };
+
+    /**
+    * @brief A stateful CRC calculator to process a block of data that arrives
+    * in several chunks, using the same table-driven engine of crc::fast().
+    * @tparam mode To select the CRC calculation mode. Only the
+    * following values are supported: ::CRC8, ::CRC16 and ::CRC32.
+    * @tparam poly CRC polynomial value.
+    * @tparam init CRC initial value.
+    * @tparam refIn If @c true, the input data is reflected before processing.
+    * @tparam refOut If @c true, the CRC result is reflected before output.
+    * @tparam xorOut The final XOR value.
+    *
+    * Example :
+    * @code{.c}
+    * crc32Context ctx;
+    * ctx.update( header, sizeof(header) ).update( payload, payloadLength );
+    * uint32_t value = ctx.finalize();
+    * @endcode
+    */
+    template<crcMode mode, uint32_t poly, uint32_t init = 0U, bool refIn = false, bool refOut = false, uint32_t xorOut = 0U>
+    class crcContext {
+        private:
+            uint32_t reg{ init };
+        public:
+            crcContext() = default;
+
+            /**
+            * @brief Restart the calculation, discarding all the data processed
+            * so far.
+            */
+            inline void reset( void ) noexcept
+            {
+                reg = init;
+            }
+
+            /**
+            * @brief Process the next chunk of data.
+            * @param[in] pData A pointer to the chunk of data.
+            * @param[in] length The number of bytes in @a pData.
+            * @return A reference to the context.
+            */
+            crcContext& update( const void * const pData,
+                                const size_t length ) noexcept
+            {
+                if ( ( nullptr != pData ) && ( length > 0U ) ) {
+                    /*keep the register in its non-reflected form between calls*/
+                #if defined( QLIBS_CRC_BITWISE )
+                    reg = crc::generic( mode, pData, length, poly, reg, refIn, false, 0U );
+                #else
+                    reg = crc::engine( impl::crcTable<impl::crcPoly( poly, impl::crcWidth( mode ), refIn ), refIn>::lut,
+                                       impl::crcFold<impl::crcPoly( poly, impl::crcWidth( mode ), false ), refIn>::keys,
+                                       poly, impl::crcWidth( mode ), pData, length, reg, refIn, false, 0U );
+                #endif
+                }
+                return *this;
+            }
+
+            /**
+            * @brief Obtain the CRC value of all the data processed so far. The
+            * context is not modified, so more data can be processed afterwards.
+            * @return The CRC value.
+            */
+            uint32_t finalize( void ) const noexcept
+            {
+                const uint32_t r = ( refOut ) ? crc::reflect( reg, static_cast<uint8_t>( impl::crcWidth( mode ) ) ) : reg;
+                return ( r ^ xorOut ) & ( 0xFFFFFFFFU >> ( 32U - impl::crcWidth( mode ) ) );
+            }
+
+            /**
+            * @brief Obtain the CRC of the concatenation of two blocks of data
+            * A and B from their individual CRC values.
+            * @see crc::combine()
+            * @param[in] crcA The CRC value of the block A.
+            * @param[in] crcB The CRC value of the block B.
+            * @param[in] lengthB The number of bytes in the block B.
+            * @return The CRC value for the block A followed by the block B.
+            */
+            static inline uint32_t combine( const uint32_t crcA,
+                                            const uint32_t crcB,
+                                            const size_t lengthB ) noexcept
+            {
+                return crc::combine( mode, crcA, crcB, lengthB, poly, init, refOut, xorOut );
             }
     };
 
+    /** @brief CRC-8 context (see crc::crc8())*/
+    using crc8Context = crcContext<CRC8, 0x07U>;
+    /** @brief CRC-16/CCITT-FALSE context (see crc::crc16_CCITT_FALSE())*/
+    using crc16Context = crcContext<CRC16, 0x1021U, 0xFFFFU>;
+    /** @brief CRC-32 context (see crc::crc32())*/
+    using crc32Context = crcContext<CRC32, 0x04C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>;
+    /** @brief CRC-32C context (see crc::crc32_C())*/
+    using crc32CContext = crcContext<CRC32, 0x1EDC6F41U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>;
+
     /** @}*/
 }
 
@@ -38,6 +38,107 @@ namespace qlibs {
             FFP_NAN,        /*!< Indicates that the value is not-a-number @c nan (NaN)*/
         };
 
+        /*! @cond  */
+        namespace impl {
+            #if defined( __has_builtin )
+                #if __has_builtin( __builtin_bit_cast )
+                    #define QLIBS_FFMATH_CONSTEXPR_BITCAST
+                #endif
+            #endif
+
+            #if defined( QLIBS_FFMATH_CONSTEXPR_BITCAST )
+                #define QLIBS_FFMATH_CONSTEXPR    constexpr
+                template <typename To, typename From>
+                constexpr To bitCast( const From src ) noexcept
+                {
+                    static_assert( sizeof(To) == sizeof(From), "Types must match sizes" );
+                    return __builtin_bit_cast( To, src );
+                }
+            #else
+                #define QLIBS_FFMATH_CONSTEXPR    inline
+                /*cstat -CERT-EXP33-C_a*/
+                template <typename To, typename From>
+                inline To bitCast( const From src ) noexcept
+                {
+                    static_assert( sizeof(To) == sizeof(From), "Types must match sizes" );
+                    To dst;
+                    (void)memcpy( &dst, &src, sizeof(To) );
+                    return dst;
+                }
+                /*cstat +CERT-EXP33-C_a*/
+            #endif
+
+            /*cstat -MISRAC++2008-5-0-21 -ATH-neg-check-nonneg -ATH-shift-neg -CERT-INT34-C_c*/
+            QLIBS_FFMATH_CONSTEXPR float absolute( const float x ) noexcept
+            {
+                return bitCast<float>( 0x7FFFFFFFU & bitCast<uint32_t>( x ) );
+            }
+            QLIBS_FFMATH_CONSTEXPR classification classifyBits( const uint32_t u ) noexcept
+            {
+                return ( 0U == u ) ? classification::FFP_ZERO :
+                       ( u < 0x00800000U ) ? classification::FFP_SUBNORMAL :
+                       ( u < 0x7F800000U ) ? classification::FFP_NORMAL :
+                       ( 0x7F800000U == u ) ? classification::FFP_INFINITE : classification::FFP_NAN;
+            }
+            QLIBS_FFMATH_CONSTEXPR float sqrtSeed( const float x ) noexcept
+            {
+                return bitCast<float>( ( ( bitCast<uint32_t>( x ) - 0x00800000U ) >> 1U ) + 0x20000000U );
+            }
+            QLIBS_FFMATH_CONSTEXPR float sqrtStep( const float x,
+                                             const float z ) noexcept
+            {
+                return 0.5F*( ( x/z ) + z );
+            }
+            QLIBS_FFMATH_CONSTEXPR float rSqrtStep( const float z,
+                                              const float x ) noexcept
+            {
+                return x*( 1.5F - ( z*x*x ) );
+            }
+            QLIBS_FFMATH_CONSTEXPR float recipStep( const float x,
+                                              const float z ) noexcept
+            {
+                return z*( 2.0F - ( x*z ) );
+            }
+            QLIBS_FFMATH_CONSTEXPR int32_t exponent( const int32_t i0 ) noexcept
+            {
+                return ( ( i0 >> 23 ) & 0xFF ) - 0x7F;
+            }
+            QLIBS_FFMATH_CONSTEXPR int32_t fracMask( const int32_t j0 ) noexcept
+            {
+                return 0x007FFFFF >> j0;
+            }
+            QLIBS_FFMATH_CONSTEXPR float floorBits( const float x,
+                                              const int32_t i0,
+                                              const int32_t j0 ) noexcept
+            {
+                return ( j0 >= 23 ) ? x :
+                       ( j0 < 0 ) ? bitCast<float>( ( i0 >= 0 ) ? 0 :
+                                                    ( 0 != ( i0 & 0x7FFFFFFF ) ) ? static_cast<int32_t>( 0xBF800000U ) : i0 ) :
+                       ( 0 == ( i0 & fracMask( j0 ) ) ) ? x :
+                       bitCast<float>( ( ( i0 < 0 ) ? ( i0 + ( 0x00800000 >> j0 ) ) : i0 ) & ( ~fracMask( j0 ) ) );
+            }
+            QLIBS_FFMATH_CONSTEXPR float ceilBits( const float x,
+                                             const int32_t i0,
+                                             const int32_t j0 ) noexcept
+            {
+                return ( j0 >= 23 ) ? x :
+                       ( j0 < 0 ) ? bitCast<float>( ( i0 < 0 ) ? static_cast<int32_t>( 0x80000000U ) :
+                                                    ( 0 != i0 ) ? static_cast<int32_t>( 0x3F800000 ) : i0 ) :
+                       ( 0 == ( i0 & fracMask( j0 ) ) ) ? x :
+                       bitCast<float>( ( ( i0 > 0 ) ? ( i0 + ( 0x00800000 >> j0 ) ) : i0 ) & ( ~fracMask( j0 ) ) );
+            }
+            QLIBS_FFMATH_CONSTEXPR float truncBits( const float x,
+                                              const int32_t i0,
+                                              const int32_t j0 ) noexcept
+            {
+                return ( j0 >= 23 ) ? x :
+                       bitCast<float>( ( j0 < 0 ) ? ( i0 & static_cast<int32_t>( 0x80000000U ) )
+                                                  : ( ( i0 & static_cast<int32_t>( 0x80000000U ) ) | ( i0 & ~fracMask( j0 ) ) ) );
+            }
+            /*cstat +MISRAC++2008-5-0-21 +ATH-neg-check-nonneg +ATH-shift-neg +CERT-INT34-C_c*/
+        }
+        /*! @endcond  */
+
 
         /**
         * @brief Determines if the parameters given as floating-point values are
@@ -47,21 +148,30 @@ namespace qlibs {
         * @param[in] tol Tolerance
         * @return @c true when both values are approximately equal.
         */
-        bool isEqual( const float a,
-                      const float b,
-                      const float tol = 1.175494351e-38F ) noexcept;
+        QLIBS_FFMATH_CONSTEXPR bool isEqual( const float a,
+                                       const float b,
+                                       const float tol = 1.175494351e-38F ) noexcept
+        {
+            return ( impl::absolute( a - b ) <= impl::absolute( tol ) );
+        }
 
         /**
         * @brief Returns positive @a infinity @c inf as a 32-bit floating point number
         * @return The @c +inf value
         */
-        float getInf( void );
+        QLIBS_FFMATH_CONSTEXPR float getInf( void )
+        {
+            return impl::bitCast<float>( 0x7F800000U );
+        }
 
         /**
         * @brief Returns Not a Number ( @a NaN ) @c nan as a 32-bit floating point number
         * @return The @c nan value
         */
-        float getNan( void );
+        QLIBS_FFMATH_CONSTEXPR float getNan( void )
+        {
+            return impl::bitCast<float>( 0x7FBFFFFFU );
+        }
 
         /**
         * @brief Categorizes the floating-point number @a x. This function
@@ -79,7 +189,10 @@ namespace qlibs {
         * @return One of the items in the ffmath::classification enumeration,
         * specifying the category of @a x.
         */
-        classification classify( const float f );
+        QLIBS_FFMATH_CONSTEXPR classification classify( const float f )
+        {
+            return impl::classifyBits( impl::bitCast<uint32_t>( f ) & 0x7FFFFFFFU );
+        }
 
         /*! @cond  */
         template<typename T>
@@ -131,7 +244,7 @@ namespace qlibs {
         * @return @c true if the value of @a x is @a NaN, otherwise
         * returns @c false.
         */
-        inline bool isNan( const float x )
+        QLIBS_FFMATH_CONSTEXPR bool isNan( const float x )
         {
             return ( classification::FFP_NAN == classify( x ) );
         }
@@ -141,7 +254,7 @@ namespace qlibs {
         * @param[in] x The number you want to test.
         * @return @c true if the value of @a x is ±Infinity, otherwise returns @c false.
         */
-        inline bool isInf( const float x )
+        QLIBS_FFMATH_CONSTEXPR bool isInf( const float x )
         {
             return ( classification::FFP_INFINITE == classify( x ) );
         }
@@ -152,7 +265,7 @@ namespace qlibs {
         * @param[in] x The number you want to test.
         * @return @c true if @a x has a finite value, @c false otherwise
         */
-        inline bool isFinite( const float x )
+        QLIBS_FFMATH_CONSTEXPR bool isFinite( const float x )
         {
             return ( classify( x ) < classification::FFP_INFINITE );
         }
@@ -163,7 +276,7 @@ namespace qlibs {
         * @param[in] x The number you want to test.
         * @return @c true if @a x has a normal value, @c false otherwise
         */
-        inline bool isNormal( const float x )
+        QLIBS_FFMATH_CONSTEXPR bool isNormal( const float x )
         {
             return ( classification::FFP_NORMAL == classify( x ) );
         }
@@ -179,22 +292,34 @@ namespace qlibs {
         * negative if the implementation supports the signed zero consistently
         * in arithmetic operations.
         */
-        float copysign( float mag,
-                        float sgn );
+        QLIBS_FFMATH_CONSTEXPR float copysign( float mag,
+                                         float sgn )
+        {
+            return impl::bitCast<float>( ( impl::bitCast<uint32_t>( mag ) & 0x7FFFFFFFU ) |
+                                         ( impl::bitCast<uint32_t>( sgn ) & 0x80000000U ) );
+        }
 
         /**
         * @brief Computes the sign function ( signum function).
         * @param[in] x The floating point value
         * @return The sign function of @a x
         */
-        float sign( float x );
+        QLIBS_FFMATH_CONSTEXPR float sign( float x )
+        {
+            return ( x > 0.0F ) ? 1.0F :
+                   ( x < 0.0F ) ? -1.0F :
+                   ( classification::FFP_ZERO == classify( x ) ) ? 0.0F : getNan();
+        }
 
         /**
         * @brief Computes the absolute value of a floating point value @a x.
         * @param[in] x The floating point value
         * @return The absolute value of @a x
         */
-        float absf( float x );
+        QLIBS_FFMATH_CONSTEXPR float absf( float x )
+        {
+            return impl::absolute( x );
+        }
 
         /**
         * @brief Computes the multiplicative inverse or reciprocal for the value
@@ -202,7 +327,10 @@ namespace qlibs {
         * @param[in] x The floating point value
         * @return The reciprocal value of @a x
         */
-        float recip( float x );
+        QLIBS_FFMATH_CONSTEXPR float recip( float x )
+        {
+            return impl::recipStep( x, impl::bitCast<float>( 0x7EF311C7U - impl::bitCast<uint32_t>( x ) ) );
+        }
 
         /**
         * @brief Computes the square-root of @a x
@@ -210,7 +338,12 @@ namespace qlibs {
         * @return Upon successful completion, square root of @a x, is returned.
         * If the domain validation fails, @c nan is returned
         */
-        float sqrt( float x );
+        QLIBS_FFMATH_CONSTEXPR float sqrt( float x )
+        {
+            return ( x < 0.0F ) ? getNan() :
+                   ( classification::FFP_ZERO == classify( x ) ) ? 0.0F :
+                   impl::sqrtStep( x, impl::sqrtStep( x, impl::sqrtSeed( x ) ) );
+        }
 
         /**
         * @brief Computes the reciprocal square-root of @a x denoted as
@@ -219,7 +352,12 @@ namespace qlibs {
         * @return Upon successful completion, the reciprocal square root of @a x, is
         * returned. If the domain validation fails @c nan is returned
         */
-        float rSqrt( float x );
+        QLIBS_FFMATH_CONSTEXPR float rSqrt( float x )
+        {
+            return ( x < 0.0F ) ? getNan() :
+                   ( classification::FFP_ZERO == classify( x ) ) ? getInf() :
+                   impl::rSqrtStep( 0.5F*x, impl::bitCast<float>( 0x5F375A86U - ( impl::bitCast<uint32_t>( x ) >> 1U ) ) );
+        }
 
         /**
         * @brief Computes the cubic-root of @a x
@@ -252,14 +390,20 @@ namespace qlibs {
         * @param[in] x The floating point value
         * @return The largest integer value not greater than @a x
         */
-        float floor( float x );
+        QLIBS_FFMATH_CONSTEXPR float floor( float x )
+        {
+            return impl::floorBits( x, impl::bitCast<int32_t>( x ), impl::exponent( impl::bitCast<int32_t>( x ) ) );
+        }
 
         /**
         * @brief Computes the smallest integer value not less than @a x.
         * @param[in] x The floating point value
         * @return The smallest integer value not less than @a x
         */
-        float ceil( float x );
+        QLIBS_FFMATH_CONSTEXPR float ceil( float x )
+        {
+            return impl::ceilBits( x, impl::bitCast<int32_t>( x ), impl::exponent( impl::bitCast<int32_t>( x ) ) );
+        }
 
         /**
         * @brief  Computes the nearest integer not greater in magnitude than @a x.
@@ -267,14 +411,20 @@ namespace qlibs {
         * @return The nearest integer value not greater in magnitude than @a x
         * (in other words, @a x rounded towards zero)
         */
-        float trunc( float x );
+        QLIBS_FFMATH_CONSTEXPR float trunc( float x )
+        {
+            return impl::truncBits( x, impl::bitCast<int32_t>( x ), impl::exponent( impl::bitCast<int32_t>( x ) ) );
+        }
 
         /**
         * @brief Obtain the fractional part of @a x.
         * @param[in] x The floating point value
         * @return The fractional part of @a x
         */
-        float frac( float x );
+        QLIBS_FFMATH_CONSTEXPR float frac( float x )
+        {
+            return x - trunc( x );
+        }
 
         /**
         * @brief Computes the floating point remainder after division of @a x
@@ -610,11 +760,14 @@ namespace qlibs {
         * @param[in] yMax Output maximum value for range
         * @return The scaled value in range @a yMin and @a yMax.
         */
-        float map( const float x,
-                   const float xMin,
-                   const float xMax,
-                   const float yMin,
-                   const float yMax ) noexcept;
+        QLIBS_FFMATH_CONSTEXPR float map( const float x,
+                                    const float xMin,
+                                    const float xMax,
+                                    const float yMin,
+                                    const float yMax ) noexcept
+        {
+            return ( ( yMax - yMin )*( ( x - xMin )/( xMax - xMin ) ) ) + yMin;
+        }
         /**
         * @brief Normalize the given input @a x in value range given by @a xMin and
         * @a xMax to value range between 0 and 1.
@@ -623,9 +776,12 @@ namespace qlibs {
         * @param[in] xMax Input maximum  value for range
         * @return The scaled value in range [0 - 1].
         */
-        real_t normalize( const float x,
-                          const float xMin,
-                          const float xMax ) noexcept;
+        QLIBS_FFMATH_CONSTEXPR real_t normalize( const float x,
+                                           const float xMin,
+                                           const float xMax ) noexcept
+        {
+            return ( x - xMin )/( xMax - xMin );
+        }
         /**
         * @brief Determines if the value pointed by @a x falls within a range
         * specified by the upper limit and lower limit inputs and coerces the value
@@ -636,9 +792,29 @@ namespace qlibs {
         * @return @c true when the value falls within the specified range, otherwise
         * false
         */
-        bool inRangeCoerce( float &x,
-                            const float lowerL,
-                            const float upperL ) noexcept;
+        inline bool inRangeCoerce( float &x,
+                                   const float lowerL,
+                                   const float upperL ) noexcept
+        {
+            bool retVal = false;
+
+            if ( isNan( x ) ) {
+                x = lowerL;
+            }
+            else {
+                if ( x < lowerL ) {
+                    x = lowerL;
+                }
+                else if ( x > upperL ) {
+                    x = upperL;
+                }
+                else {
+                    retVal = true;
+                }
+            }
+
+            return retVal;
+        }
 
         /**
         * @brief Determines if the point at ( @a x, @a y ) is inside the polygon
@@ -1051,6 +1227,869 @@ namespace qlibs {
                             size_t m,
                             float theta );
 
+        /**
+        * @brief Computes the square-root of every element of the array @a in.
+        * @see ffmath::sqrt()
+        * @note This and the other array overloads compute the same result of
+        * its scalar counterpart for every element of the array @a in.
+        * On x86-64 and ARM targets built with GCC or Clang, the arrays
+        * are processed with SIMD kernels (SSE2, AVX2 or AVX-512 on x86-64,
+        * selected at runtime from the CPU features). The kernels perform the
+        * same floating-point operations of the scalar versions, so the results
+        * are the same unless the scalar code is compiled with fused
+        * multiply-add contraction. Other targets use a plain loop.
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored. It can
+        * be the same as @a in.
+        * @param[in] n The number of elements in both arrays
+        */
+        void sqrt( const float * const in,
+                   float * const out,
+                   const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the reciprocal square-root of every element of the array @a in.
+        * @see ffmath::rSqrt()
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in both arrays
+        */
+        void rSqrt( const float * const in,
+                    float * const out,
+                    const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the sine in radians of every element of the array @a in.
+        * @see ffmath::sin()
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in both arrays
+        */
+        void sin( const float * const in,
+                  float * const out,
+                  const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the cosine in radians of every element of the array @a in.
+        * @see ffmath::cos()
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in both arrays
+        */
+        void cos( const float * const in,
+                  float * const out,
+                  const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the base-2 exponential of every element of the array @a in.
+        * @see ffmath::exp2()
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in both arrays
+        */
+        void exp2( const float * const in,
+                   float * const out,
+                   const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the base-2 logarithm of every element of the array @a in.
+        * @see ffmath::log2()
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in both arrays
+        */
+        void log2( const float * const in,
+                   float * const out,
+                   const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the base-e exponential of every element of the array @a in.
+        * @see ffmath::exp()
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in both arrays
+        */
+        void exp( const float * const in,
+                  float * const out,
+                  const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the natural (base-e) logarithm of every element of the array @a in.
+        * @see ffmath::log()
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in both arrays
+        */
+        void log( const float * const in,
+                  float * const out,
+                  const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the hyperbolic tangent of every element of the array @a in.
+        * @see ffmath::tanh()
+        * @param[in] in The array with the floating point values
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in both arrays
+        */
+        void tanh( const float * const in,
+                   float * const out,
+                   const size_t n ) noexcept;
+
+        /**
+        * @brief Computes the value of every element of the array @a b raised
+        * to the power of the same element in the array @a e.
+        * @see ffmath::pow()
+        * @param[in] b The array with the bases
+        * @param[in] e The array with the exponents
+        * @param[out] out The array where the results will be stored
+        * @param[in] n The number of elements in the arrays
+        */
+        void pow( const float * const b,
+                  const float * const e,
+                  float * const out,
+                  const size_t n ) noexcept;
+
+        /**
+        * @brief Fast tier of the library. The functions trade accuracy for
+        * speed with a maximum relative error around @c 1e-4 (about
+        * 10 ULP), using short polynomials and few branches so loops calling
+        * them can be vectorized by the compiler.
+        * @note The special values ( @c nan, @c inf, zeros ) are not handled
+        * in the same way than the default functions. See @ref qffmath_tiers
+        * for the measured error of each function.
+        */
+        namespace fast {
+            /**
+            * @brief Computes 2 raised to the given power @a x, relative error 7.5e-5.
+            * @param[in] x The floating point value
+            * @return The base-2 exponential of @a x. @c 0 for @a x < -126
+            * and @c inf for @a x >= 128.
+            */
+            float exp2( float x );
+            /**
+            * @brief Computes the e (Euler's number) raised to the given power @a x.
+            * @param[in] x The floating point value
+            * @return The base-e exponential of @a x.
+            */
+            float exp( float x );
+            /**
+            * @brief Computes the value of 10 raised to the power of @a x.
+            * @param[in] x The floating point value
+            * @return The base-10 exponential of @a x.
+            */
+            float exp10( float x );
+            /**
+            * @brief Computes the base 2 logarithm of @a x, absolute error 3e-5.
+            * @param[in] x The floating point value
+            * @return The base-2 logarithm of @a x.
+            */
+            float log2( float x );
+            /**
+            * @brief Computes the natural (base e) logarithm of @a x.
+            * @param[in] x The floating point value
+            * @return The natural logarithm of @a x.
+            */
+            float log( float x );
+            /**
+            * @brief Computes the common (base-10) logarithm of @a x.
+            * @param[in] x The floating point value
+            * @return The common logarithm of @a x.
+            */
+            float log10( float x );
+            /**
+            * @brief Computes the value of @a b raised to the power @a e.
+            * @param[in] b Base as floating point value
+            * @param[in] e Exponent as floating point value
+            * @return @a b raised to the power @a e. Negative bases give @c nan.
+            */
+            float pow( float b,
+                       float e );
+            /**
+            * @brief Computes the sine of @a x (measured in radians).
+            * @param[in] x The floating point value
+            * @return The sine of @a x. The error grows with |x| beyond @c 1e4.
+            */
+            float sin( float x );
+            /**
+            * @brief Computes the cosine of @a x (measured in radians).
+            * @param[in] x The floating point value
+            * @return The cosine of @a x. The error grows with |x| beyond @c 1e4.
+            */
+            float cos( float x );
+            /**
+            * @brief Computes the tangent of @a x (measured in radians).
+            * @param[in] x The floating point value
+            * @return The tangent of @a x.
+            */
+            float tan( float x );
+            /**
+            * @brief Computes the principal value of the arc tangent of @a x.
+            * @param[in] x The floating point value
+            * @return The arc tangent of @a x in the range [-pi/2, pi/2].
+            */
+            float atan( float x );
+            /**
+            * @brief Computes the arc tangent of @a y/x using the signs of
+            * arguments to determine the correct quadrant.
+            * @param[in] y The floating point value
+            * @param[in] x The floating point value
+            * @return The arc tangent of @a y/x in the range [-pi, pi].
+            */
+            float atan2( float y,
+                         float x );
+            /**
+            * @brief Computes the hyperbolic tangent of @a x.
+            * @param[in] x The floating point value
+            * @return The hyperbolic tangent of @a x.
+            */
+            float tanh( float x );
+            /**
+            * @brief Computes the error function of @a x.
+            * @param[in] x The floating point value
+            * @return The error function of @a x.
+            */
+            float erf( float x );
+        }
+
+        /**
+        * @brief Precise tier of the library. The functions are evaluated
+        * internally in double precision with table-driven argument reduction,
+        * so the results have an error below 1 ULP (almost always correctly
+        * rounded) for the whole range of the argument, and the special values
+        * follow the C99 Annex F rules.
+        * @note On targets where @c double is not a 64-bit IEEE 754 type (e.g.
+        * AVR), these functions fall back to the default implementations.
+        * See @ref qffmath_tiers for the measured error of each function.
+        */
+        namespace precise {
+            /**
+            * @brief Computes the square-root of @a x.
+            * @param[in] x The floating point value
+            * @return The square-root of @a x. @c nan for negative values.
+            */
+            float sqrt( float x );
+            /**
+            * @brief Computes the reciprocal square-root of @a x.
+            * @param[in] x The floating point value
+            * @return The reciprocal square-root of @a x.
+            */
+            float rSqrt( float x );
+            /**
+            * @brief Computes the cubic-root of @a x.
+            * @param[in] x The floating point value
+            * @return The cubic-root of @a x.
+            */
+            float cbrt( float x );
+            /**
+            * @brief Computes the sine of @a x (measured in radians).
+            * @param[in] x The floating point value
+            * @return The sine of @a x.
+            */
+            float sin( float x );
+            /**
+            * @brief Computes the cosine of @a x (measured in radians).
+            * @param[in] x The floating point value
+            * @return The cosine of @a x.
+            */
+            float cos( float x );
+            /**
+            * @brief Computes the tangent of @a x (measured in radians).
+            * @param[in] x The floating point value
+            * @return The tangent of @a x.
+            */
+            float tan( float x );
+            /**
+            * @brief Computes the principal value of the arc sine of @a x.
+            * @param[in] x The floating point value
+            * @return The arc sine of @a x in the range [-pi/2, pi/2].
+            */
+            float asin( float x );
+            /**
+            * @brief Computes the principal value of the arc cosine of @a x.
+            * @param[in] x The floating point value
+            * @return The arc cosine of @a x in the range [0, pi].
+            */
+            float acos( float x );
+            /**
+            * @brief Computes the principal value of the arc tangent of @a x.
+            * @param[in] x The floating point value
+            * @return The arc tangent of @a x in the range [-pi/2, pi/2].
+            */
+            float atan( float x );
+            /**
+            * @brief Computes the arc tangent of @a y/x using the signs of
+            * arguments to determine the correct quadrant.
+            * @param[in] y The floating point value
+            * @param[in] x The floating point value
+            * @return The arc tangent of @a y/x in the range [-pi, pi].
+            */
+            float atan2( float y,
+                         float x );
+            /**
+            * @brief Computes 2 raised to the given power @a x.
+            * @param[in] x The floating point value
+            * @return The base-2 exponential of @a x.
+            */
+            float exp2( float x );
+            /**
+            * @brief Computes the base 2 logarithm of @a x.
+            * @param[in] x The floating point value
+            * @return The base-2 logarithm of @a x.
+            */
+            float log2( float x );
+            /**
+            * @brief Computes the e (Euler's number) raised to the given power @a x.
+            * @param[in] x The floating point value
+            * @return The base-e exponential of @a x.
+            */
+            float exp( float x );
+            /**
+            * @brief Computes the e (Euler's number) raised to the given power
+            * @a x, minus 1.0.
+            * @param[in] x The floating point value
+            * @return e raised to the power @a x, minus 1.0.
+            */
+            float expm1( float x );
+            /**
+            * @brief Computes the value of 10 raised to the power of @a x.
+            * @param[in] x The floating point value
+            * @return The base-10 exponential of @a x.
+            */
+            float exp10( float x );
+            /**
+            * @brief Computes the natural (base e) logarithm of @a x.
+            * @param[in] x The floating point value
+            * @return The natural logarithm of @a x.
+            */
+            float log( float x );
+            /**
+            * @brief Computes the natural (base e) logarithm of 1 plus @a x.
+            * @param[in] x The floating point value
+            * @return The natural logarithm of 1 plus @a x.
+            */
+            float log1p( float x );
+            /**
+            * @brief Computes the common (base-10) logarithm of @a x.
+            * @param[in] x The floating point value
+            * @return The common logarithm of @a x.
+            */
+            float log10( float x );
+            /**
+            * @brief Computes the value of @a b raised to the power @a e.
+            * @param[in] b Base as floating point value
+            * @param[in] e Exponent as floating point value
+            * @return @a b raised to the power @a e.
+            */
+            float pow( float b,
+                       float e );
+            /**
+            * @brief Computes hyperbolic sine of @a x.
+            * @param[in] x The floating point value
+            * @return The hyperbolic sine of @a x.
+            */
+            float sinh( float x );
+            /**
+            * @brief Computes hyperbolic cosine of @a x.
+            * @param[in] x The floating point value
+            * @return The hyperbolic cosine of @a x.
+            */
+            float cosh( float x );
+            /**
+            * @brief Computes hyperbolic tangent of @a x.
+            * @param[in] x The floating point value
+            * @return The hyperbolic tangent of @a x.
+            */
+            float tanh( float x );
+            /**
+            * @brief Computes the error function of @a x.
+            * @param[in] x The floating point value
+            * @return The error function of @a x.
+            */
+            float erf( float x );
+            /**
+            * @brief Computes the complementary error function of @a x.
+            * @param[in] x The floating point value
+            * @return The complementary error function of @a x.
+            */
+            float erfc( float x );
+        }
+
+        #if ( DBL_MANT_DIG == 53 )
+            /** @brief Defined when the double-precision overloads are available*/
+            #define FFMATH_DOUBLE_SUPPORT
+        #endif
+
+        #if defined( FFMATH_DOUBLE_SUPPORT )
+        /*! @cond  */
+        namespace impl {
+            /*cstat -MISRAC++2008-5-0-21 -ATH-neg-check-nonneg -ATH-shift-neg -CERT-INT34-C_c*/
+            QLIBS_FFMATH_CONSTEXPR double absolute( const double x ) noexcept
+            {
+                return bitCast<double>( 0x7FFFFFFFFFFFFFFFU & bitCast<uint64_t>( x ) );
+            }
+            QLIBS_FFMATH_CONSTEXPR classification classifyBits( const uint64_t u ) noexcept
+            {
+                return ( 0U == u ) ? classification::FFP_ZERO :
+                       ( u < 0x0010000000000000U ) ? classification::FFP_SUBNORMAL :
+                       ( u < 0x7FF0000000000000U ) ? classification::FFP_NORMAL :
+                       ( 0x7FF0000000000000U == u ) ? classification::FFP_INFINITE : classification::FFP_NAN;
+            }
+            QLIBS_FFMATH_CONSTEXPR int64_t exponent( const int64_t i0 ) noexcept
+            {
+                return ( ( i0 >> 52 ) & 0x7FF ) - 0x3FF;
+            }
+            QLIBS_FFMATH_CONSTEXPR int64_t fracMask( const int64_t j0 ) noexcept
+            {
+                return 0x000FFFFFFFFFFFFF >> j0;
+            }
+            QLIBS_FFMATH_CONSTEXPR double floorBits( const double x,
+                                               const int64_t i0,
+                                               const int64_t j0 ) noexcept
+            {
+                return ( j0 >= 52 ) ? x :
+                       ( j0 < 0 ) ? bitCast<double>( ( i0 >= 0 ) ? 0 :
+                                                     ( 0 != ( i0 & 0x7FFFFFFFFFFFFFFF ) ) ? static_cast<int64_t>( 0xBFF0000000000000U ) : i0 ) :
+                       ( 0 == ( i0 & fracMask( j0 ) ) ) ? x :
+                       bitCast<double>( ( ( i0 < 0 ) ? ( i0 + ( 0x0010000000000000 >> j0 ) ) : i0 ) & ( ~fracMask( j0 ) ) );
+            }
+            QLIBS_FFMATH_CONSTEXPR double ceilBits( const double x,
+                                              const int64_t i0,
+                                              const int64_t j0 ) noexcept
+            {
+                return ( j0 >= 52 ) ? x :
+                       ( j0 < 0 ) ? bitCast<double>( ( i0 < 0 ) ? static_cast<int64_t>( 0x8000000000000000U ) :
+                                                     ( 0 != i0 ) ? static_cast<int64_t>( 0x3FF0000000000000 ) : i0 ) :
+                       ( 0 == ( i0 & fracMask( j0 ) ) ) ? x :
+                       bitCast<double>( ( ( i0 > 0 ) ? ( i0 + ( 0x0010000000000000 >> j0 ) ) : i0 ) & ( ~fracMask( j0 ) ) );
+            }
+            QLIBS_FFMATH_CONSTEXPR double truncBits( const double x,
+                                               const int64_t i0,
+                                               const int64_t j0 ) noexcept
+            {
+                return ( j0 >= 52 ) ? x :
+                       bitCast<double>( ( j0 < 0 ) ? ( i0 & static_cast<int64_t>( 0x8000000000000000U ) )
+                                                   : ( ( i0 & static_cast<int64_t>( 0x8000000000000000U ) ) | ( i0 & ~fracMask( j0 ) ) ) );
+            }
+            /*cstat +MISRAC++2008-5-0-21 +ATH-neg-check-nonneg +ATH-shift-neg +CERT-INT34-C_c*/
+        }
+        /*! @endcond  */
+
+        /**
+        * @brief Determines if the parameters given as double-precision values
+        * are approximately equal.
+        * @param[in] a Input to be compared.
+        * @param[in] b Input to be compared.
+        * @param[in] tol Tolerance
+        * @return @c true when both values are approximately equal.
+        */
+        QLIBS_FFMATH_CONSTEXPR bool isEqual( const double a,
+                                       const double b,
+                                       const double tol = 2.2250738585072014e-308 ) noexcept
+        {
+            return ( impl::absolute( a - b ) <= impl::absolute( tol ) );
+        }
+
+        /**
+        * @brief Categorizes the double-precision number @a f.
+        * @see ffmath::classify( const float )
+        * @param[in] f The number you want to test.
+        * @return One of the items in the ffmath::classification enumeration,
+        * specifying the category of @a f.
+        */
+        QLIBS_FFMATH_CONSTEXPR classification classify( const double f )
+        {
+            return impl::classifyBits( impl::bitCast<uint64_t>( f ) & 0x7FFFFFFFFFFFFFFFU );
+        }
+
+        /**
+        * @brief Determine if @a x is Not-A-Number @a NaN
+        * @param[in] x The number you want to test.
+        * @return @c true if the value of @a x is @a NaN, otherwise
+        * returns @c false.
+        */
+        QLIBS_FFMATH_CONSTEXPR bool isNan( const double x )
+        {
+            return ( classification::FFP_NAN == classify( x ) );
+        }
+
+        /**
+        * @brief Determine if @a x is @a Infinity.
+        * @param[in] x The number you want to test.
+        * @return @c true if the value of @a x is ±Infinity, otherwise returns @c false.
+        */
+        QLIBS_FFMATH_CONSTEXPR bool isInf( const double x )
+        {
+            return ( classification::FFP_INFINITE == classify( x ) );
+        }
+
+        /**
+        * @brief Determines if the given double-precision number @a x has
+        * finite value.
+        * @param[in] x The number you want to test.
+        * @return @c true if @a x has a finite value, @c false otherwise
+        */
+        QLIBS_FFMATH_CONSTEXPR bool isFinite( const double x )
+        {
+            return ( classify( x ) < classification::FFP_INFINITE );
+        }
+
+        /**
+        * @brief Determines if the given double-precision number @a x is normal.
+        * @param[in] x The number you want to test.
+        * @return @c true if @a x has a normal value, @c false otherwise
+        */
+        QLIBS_FFMATH_CONSTEXPR bool isNormal( const double x )
+        {
+            return ( classification::FFP_NORMAL == classify( x ) );
+        }
+
+        /**
+        * @brief Composes a double-precision value with the magnitude of @a mag
+        * and the sign of @a sgn
+        * @param[in] mag floating-point value.
+        * @param[in] sgn floating-point value
+        * @return The value with the magnitude of @a mag and the sign of @a sgn.
+        */
+        QLIBS_FFMATH_CONSTEXPR double copysign( double mag,
+                                          double sgn )
+        {
+            return impl::bitCast<double>( ( impl::bitCast<uint64_t>( mag ) & 0x7FFFFFFFFFFFFFFFU ) |
+                                          ( impl::bitCast<uint64_t>( sgn ) & 0x8000000000000000U ) );
+        }
+
+        /**
+        * @brief Computes the sign function ( signum function).
+        * @param[in] x The floating point value
+        * @return The sign function of @a x
+        */
+        QLIBS_FFMATH_CONSTEXPR double sign( double x )
+        {
+            return ( x > 0.0 ) ? 1.0 :
+                   ( x < 0.0 ) ? -1.0 :
+                   ( classification::FFP_ZERO == classify( x ) ) ? 0.0 : x;
+        }
+
+        /**
+        * @brief Computes the absolute value of a double-precision value @a x.
+        * @param[in] x The floating point value
+        * @return The absolute value of @a x
+        */
+        QLIBS_FFMATH_CONSTEXPR double absf( double x )
+        {
+            return impl::absolute( x );
+        }
+
+        /**
+        * @brief Computes the largest integer value not greater than @a x.
+        * @param[in] x The floating point value
+        * @return The largest integer value not greater than @a x
+        */
+        QLIBS_FFMATH_CONSTEXPR double floor( double x )
+        {
+            return impl::floorBits( x, impl::bitCast<int64_t>( x ), impl::exponent( impl::bitCast<int64_t>( x ) ) );
+        }
+
+        /**
+        * @brief Computes the smallest integer value not less than @a x.
+        * @param[in] x The floating point value
+        * @return The smallest integer value not less than @a x
+        */
+        QLIBS_FFMATH_CONSTEXPR double ceil( double x )
+        {
+            return impl::ceilBits( x, impl::bitCast<int64_t>( x ), impl::exponent( impl::bitCast<int64_t>( x ) ) );
+        }
+
+        /**
+        * @brief  Computes the nearest integer not greater in magnitude than @a x.
+        * @param[in] x The floating point value
+        * @return @a x rounded towards zero
+        */
+        QLIBS_FFMATH_CONSTEXPR double trunc( double x )
+        {
+            return impl::truncBits( x, impl::bitCast<int64_t>( x ), impl::exponent( impl::bitCast<int64_t>( x ) ) );
+        }
+
+        /**
+        * @brief Obtain the fractional part of @a x.
+        * @param[in] x The floating point value
+        * @return The fractional part of @a x
+        */
+        QLIBS_FFMATH_CONSTEXPR double frac( double x )
+        {
+            return x - trunc( x );
+        }
+
+        /**
+        * @brief Determines if the value pointed by @a x falls within a range
+        * and coerces the value to fall within the range
+        * @see ffmath::inRangeCoerce( float &, const float, const float )
+        * @param[in,out] x Input
+        * @param[in] lowerL Lower limit.
+        * @param[in] upperL Upper limit.
+        * @return @c true when the value falls within the specified range,
+        * otherwise false
+        */
+        inline bool inRangeCoerce( double &x,
+                                   const double lowerL,
+                                   const double upperL ) noexcept
+        {
+            bool retVal = false;
+
+            if ( isNan( x ) ) {
+                x = lowerL;
+            }
+            else {
+                if ( x < lowerL ) {
+                    x = lowerL;
+                }
+                else if ( x > upperL ) {
+                    x = upperL;
+                }
+                else {
+                    retVal = true;
+                }
+            }
+
+            return retVal;
+        }
+
+        /**
+        * @brief Computes the square-root of @a x
+        * @param[in] x The floating point value
+        * @return The correctly rounded square root of @a x. @c nan for
+        * negative values.
+        */
+        double sqrt( double x );
+
+        /**
+        * @brief Computes the reciprocal square-root of @a x
+        * @param[in] x The floating point value
+        * @return The reciprocal square root of @a x.
+        */
+        double rSqrt( double x );
+
+        /**
+        * @brief Computes the cubic-root of @a x
+        * @param[in] x The floating point value
+        * @return The cubic root of @a x.
+        */
+        double cbrt( double x );
+
+        /**
+        * @brief Computes the nearest integer value to @a x, rounding halfway
+        * cases away from zero.
+        * @param[in] x The floating point value
+        * @return The nearest integer value to @a x
+        */
+        double rounding( double x );
+
+        /**
+        * @brief Computes the floating point remainder after division of @a x
+        * by @a y, with the sign of the dividend.
+        * @see ffmath::rem( float, float )
+        * @param[in] x The floating point value
+        * @param[in] y The floating point value
+        * @return The remainder of the division @c x/y, @c nan when @a y is zero.
+        */
+        double rem( double x,
+                    double y );
+
+        /**
+        * @brief Computes the floating point remainder after division of @a x
+        * by @a y, with the sign of the divisor.
+        * @see ffmath::mod( float, float )
+        * @param[in] x The floating point value
+        * @param[in] y The floating point value
+        * @return The modulo of the division @c x/y, @a x when @a y is zero.
+        */
+        double mod( double x,
+                    double y );
+
+        /**
+        * @brief Computes the sine of @a x (measured in radians).
+        * @param[in] x The floating point value
+        * @return The sine of @a x.
+        */
+        double sin( double x );
+
+        /**
+        * @brief Computes the cosine of @a x (measured in radians).
+        * @param[in] x The floating point value
+        * @return The cosine of @a x.
+        */
+        double cos( double x );
+
+        /**
+        * @brief Computes the tangent of @a x (measured in radians).
+        * @param[in] x The floating point value
+        * @return The tangent of @a x.
+        */
+        double tan( double x );
+
+        /**
+        * @brief Computes the principal value of the arc sine of @a x.
+        * @param[in] x The floating point value
+        * @return The arc sine of @a x in the range [-pi/2, pi/2].
+        */
+        double asin( double x );
+
+        /**
+        * @brief Computes the principal value of the arc cosine of @a x.
+        * @param[in] x The floating point value
+        * @return The arc cosine of @a x in the range [0, pi].
+        */
+        double acos( double x );
+
+        /**
+        * @brief Computes the principal value of the arc tangent of @a x.
+        * @param[in] x The floating point value
+        * @return The arc tangent of @a x in the range [-pi/2, pi/2].
+        */
+        double atan( double x );
+
+        /**
+        * @brief Computes the arc tangent of @a y/x using the signs of
+        * arguments to determine the correct quadrant.
+        * @param[in] y The floating point value
+        * @param[in] x The floating point value
+        * @return The arc tangent of @a y/x in the range [-pi, pi].
+        */
+        double atan2( double y,
+                      double x );
+
+        /**
+        * @brief Computes 2 raised to the given power @a x.
+        * @param[in] x The floating point value
+        * @return The base-2 exponential of @a x.
+        */
+        double exp2( double x );
+
+        /**
+        * @brief Computes the base 2 logarithm of @a x.
+        * @param[in] x The floating point value
+        * @return The base-2 logarithm of @a x.
+        */
+        double log2( double x );
+
+        /**
+        * @brief Computes the e (Euler's number) raised to the given power @a x.
+        * @param[in] x The floating point value
+        * @return The base-e exponential of @a x.
+        */
+        double exp( double x );
+
+        /**
+        * @brief Computes the e (Euler's number) raised to the given power
+        * @a x, minus 1.0.
+        * @param[in] x The floating point value
+        * @return e raised to the power @a x, minus 1.0.
+        */
+        double expm1( double x );
+
+        /**
+        * @brief Computes the value of 10 raised to the power of @a x.
+        * @param[in] x The floating point value
+        * @return The base-10 exponential of @a x.
+        */
+        double exp10( double x );
+
+        /**
+        * @brief Computes the natural (base e) logarithm of @a x.
+        * @param[in] x The floating point value
+        * @return The natural logarithm of @a x.
+        */
+        double log( double x );
+
+        /**
+        * @brief Computes the natural (base e) logarithm of 1 plus @a x.
+        * @param[in] x The floating point value
+        * @return The natural logarithm of 1 plus @a x.
+        */
+        double log1p( double x );
+
+        /**
+        * @brief Computes the common (base-10) logarithm of @a x.
+        * @param[in] x The floating point value
+        * @return The common logarithm of @a x.
+        */
+        double log10( double x );
+
+        /**
+        * @brief Computes the value of @a x raised to the power @a y.
+        * @param[in] x Base as floating point value
+        * @param[in] y Exponent as floating point value
+        * @return @a x raised to the power @a y.
+        */
+        double pow( double x,
+                    double y );
+
+        /**
+        * @brief Computes hyperbolic sine of @a x.
+        * @param[in] x The floating point value
+        * @return The hyperbolic sine of @a x.
+        */
+        double sinh( double x );
+
+        /**
+        * @brief Computes hyperbolic cosine of @a x.
+        * @param[in] x The floating point value
+        * @return The hyperbolic cosine of @a x.
+        */
+        double cosh( double x );
+
+        /**
+        * @brief Computes hyperbolic tangent of @a x.
+        * @param[in] x The floating point value
+        * @return The hyperbolic tangent of @a x.
+        */
+        double tanh( double x );
+
+        /**
+        * @brief Computes the inverse hyperbolic sine of @a x.
+        * @param[in] x The floating point value
+        * @return The inverse hyperbolic sine of @a x.
+        */
+        double asinh( double x );
+
+        /**
+        * @brief Computes the inverse hyperbolic cosine of @a x.
+        * @param[in] x The floating point value
+        * @return The inverse hyperbolic cosine of @a x. @c nan for @a x < 1.
+        */
+        double acosh( double x );
+
+        /**
+        * @brief Computes the inverse hyperbolic tangent of @a x.
+        * @param[in] x The floating point value
+        * @return The inverse hyperbolic tangent of @a x.
+        */
+        double atanh( double x );
+
+        /**
+        * @brief Computes the error function of @a x.
+        * @param[in] x The floating point value
+        * @return The error function of @a x.
+        */
+        double erf( double x );
+
+        /**
+        * @brief Computes the complementary error function of @a x.
+        * @param[in] x The floating point value
+        * @return The complementary error function of @a x.
+        */
+        double erfc( double x );
+
+        /**
+        * @brief Computes the square root of the sum of the squares of @a x
+        * and @a y, without undue overflow or underflow.
+        * @param[in] x The floating point value
+        * @param[in] y The floating point value
+        * @return The hypotenuse of a right-angled triangle with sides @a x and @a y.
+        */
+        double hypot( double x,
+                      double y );
+        #endif
+
         /*cstat -MISRAC++2008-0-1-4_b*/
 
         /** @brief The base of natural logarithms ( e ) given as a single-precision floating-point number*/
@@ -1151,5 +2190,7 @@ namespace qlibs {
     }
 }
 
+/*the specifier is only meant for the declarations above*/
+#undef QLIBS_FFMATH_CONSTEXPR
 
 #endif /*QLIBS_FFMATH*/
\ No newline at end of file
@@ -227,6 +227,18 @@ namespace qlibs {
                                       const real_t b );
                 static real_t Sum( const real_t a,
                                    const real_t b );
+                static inline void setIOValue( ioBase &io,
+                                               const real_t v ) noexcept
+                {
+                    io.value = v;
+                }
+                static inline void setIORange( ioBase &io,
+                                               const real_t Min,
+                                               const real_t Max ) noexcept
+                {
+                    io.min = Min;
+                    io.max = Max;
+                }
 
                 static real_t TriMF( const ioBase * const in,
                                      const real_t *p,
@@ -336,6 +348,8 @@ namespace qlibs {
             private:
                 mfFunction shape{ nullptr };
                 const real_t *points{ nullptr };
+                const real_t *table{ nullptr };
+                size_t nTable{ 0U };
                 real_t fx{ 0.0_re };
                 real_t h{ 0.0_re };
                 size_t index{ 0U };
@@ -489,6 +503,231 @@ namespace qlibs {
         /** @brief Rule statement to end a rule sentence */
         #define END                     Q_FIS_END_STATEMENT
 
+        /**
+        * @brief An item of a compiled rule set. Each item holds one premise or
+        * one consequent of a rule.
+        * @details An array of this type should be given to
+        * instance::compileRules(). It needs one item for every #IS and
+        * #IS_NOT statement of the rule set.
+        */
+        class ruleTerm {
+            private:
+                size_t rule{ 0U };
+                rules io{ 0 };
+                rules set{ 0 };
+                rules connector{ -1 };
+            public:
+                ruleTerm() = default;
+            friend class instance;
+        };
+
+        /**
+        * @brief The evaluation state of a FIS instance.
+        * @details A context holds the crisp inputs and outputs, the
+        * membership values of the input sets and the rule strengths, so an
+        * instance can be evaluated with instance::evaluate() without being
+        * modified. Several threads can share one instance, as long as each
+        * one uses its own context. Larger arrays for the membership values
+        * and the rule strengths let instance::evaluateBatch() take several
+        * vectors per block. The context should be initialized using the
+        * context::setup() method.
+        */
+        class context {
+            private:
+                input *xInput{ nullptr };
+                output *xOutput{ nullptr };
+                real_t *fx{ nullptr };
+                real_t *wi{ nullptr };
+                size_t nInputs{ 0U };
+                size_t nOutputs{ 0U };
+                size_t nMFInputs{ 0U };
+                size_t nRules{ 0U };
+                real_t *acc{ nullptr };
+                size_t nAcc{ 0U };
+            public:
+                context() = default;
+
+                /**
+                * @brief Setup the context with the arrays that will hold the
+                * evaluation state.
+                * @param[in] inputs An array with one fis::input object per
+                * input of the instance.
+                * @param[in] ni The number of elements in the @a inputs array.
+                * @param[in] outputs An array with one fis::output object per
+                * output of the instance.
+                * @param[in] no The number of elements in the @a outputs array.
+                * @param[in] mfValues An array with one element per input
+                * membership function of the instance.
+                * @param[in] nmi The number of elements in the @a mfValues array.
+                * @param[in] rWeights An array with one element per rule of the
+                * instance, where the rule strengths will be stored.
+                * @param[in] n The number of elements in the @a rWeights array.
+                * @return @c true on success, otherwise return @c false.
+                */
+                bool setup( input * const inputs,
+                            const size_t ni,
+                            output * const outputs,
+                            const size_t no,
+                            real_t * const mfValues,
+                            const size_t nmi,
+                            real_t * const rWeights,
+                            const size_t n ) noexcept;
+
+                /**
+                * @brief Setup the context with the arrays that will hold the
+                * evaluation state.
+                * @param[in] inputs An array with one fis::input object per
+                * input of the instance.
+                * @param[in] outputs An array with one fis::output object per
+                * output of the instance.
+                * @param[in] mfValues An array with one element per input
+                * membership function of the instance.
+                * @param[in] rWeights An array with one element per rule of the
+                * instance, where the rule strengths will be stored.
+                * @return @c true on success, otherwise return @c false.
+                */
+                template <size_t ni, size_t no, size_t nmi, size_t n>
+                bool setup( input (&inputs)[ ni ],
+                            output (&outputs)[ no ],
+                            real_t (&mfValues)[ nmi ],
+                            real_t (&rWeights)[ n ] ) noexcept
+                {
+                    return setup( inputs, ni, outputs, no, mfValues, nmi, rWeights, n );
+                }
+
+                /**
+                * @brief Setup the array where the context accumulates the
+                * training sums of instance::trainAccumulate(). The array is
+                * cleared.
+                * @param[in] area An array with at least
+                * instance::getAccumulatorSize() elements.
+                * @param[in] nArea The number of elements in @a area.
+                * @return @c true on success, otherwise return @c false.
+                */
+                bool setupTraining( real_t * const area,
+                                    const size_t nArea ) noexcept;
+
+                /**
+                * @brief Setup the array where the context accumulates the
+                * training sums of instance::trainAccumulate(). The array is
+                * cleared.
+                * @param[in] area An array with at least
+                * instance::getAccumulatorSize() elements.
+                * @return @c true on success, otherwise return @c false.
+                */
+                template <size_t nArea>
+                bool setupTraining( real_t (&area)[ nArea ] ) noexcept
+                {
+                    return setupTraining( area, nArea );
+                }
+            friend class instance;
+        };
+
+        /**
+        * @brief The state of a FIS training.
+        * @details A trainer holds the parameters being fitted by
+        * instance::train() in a user array, together with the information
+        * matrix of the least-squares estimate, a scratch area and the last
+        * gradient. The instance is not modified by the training: the fitted
+        * parameters can be read back with trainer::getParameters() and
+        * given to the instance with instance::applyTraining(). The trainer
+        * should be initialized using the trainer::setup() method.
+        */
+        class trainer {
+            private:
+                const instance *owner{ nullptr };
+                real_t *buffer{ nullptr };
+                size_t n{ 0U };
+                size_t nPremise{ 0U };
+                size_t nConsequent{ 0U };
+                size_t nCovariance{ 0U };
+                size_t nBlock{ 0U };
+                real_t rate{ 0.01_re };
+                real_t error{ 0.0_re };
+            public:
+                trainer() = default;
+
+                /**
+                * @brief Setup the trainer with the array that will hold the
+                * training state.
+                * @param[in] area An array with at least
+                * instance::getTrainingSize() elements.
+                * @param[in] nArea The number of elements in @a area.
+                * @param[in] learningRate The step of the gradient descent
+                * applied to the points of the input sets.
+                * @note The trainer is released from its instance. If the
+                * instance took the parameters with instance::applyTraining(),
+                * its sets still point to @a area, so give another array before
+                * training a different instance.
+                * @return @c true on success, otherwise return @c false.
+                */
+                bool setup( real_t * const area,
+                            const size_t nArea,
+                            const real_t learningRate = 0.01_re ) noexcept;
+
+                /**
+                * @brief Setup the trainer with the array that will hold the
+                * training state.
+                * @param[in] area An array with at least
+                * instance::getTrainingSize() elements.
+                * @param[in] learningRate The step of the gradient descent
+                * applied to the points of the input sets.
+                * @return @c true on success, otherwise return @c false.
+                */
+                template <size_t nArea>
+                bool setup( real_t (&area)[ nArea ],
+                            const real_t learningRate = 0.01_re ) noexcept
+                {
+                    return setup( area, nArea, learningRate );
+                }
+
+                /**
+                * @brief Get the fitted parameters. The points of the input
+                * sets come first, in the order of their tags, followed by the
+                * coefficients of the output sets of ::Sugeno systems, grouped by
+                * output.
+                * @return A pointer to the parameters or @c nullptr if the
+                * trainer has not been used.
+                */
+                const real_t* getParameters( void ) const noexcept
+                {
+                    return ( nullptr != owner ) ? buffer : nullptr;
+                }
+
+                /**
+                * @brief Get the number of fitted parameters.
+                * @return The number of parameters.
+                */
+                size_t getNumberOfParameters( void ) const noexcept
+                {
+                    return nPremise + nConsequent;
+                }
+
+                /**
+                * @brief Get the mean squared error of the last mini-batch,
+                * measured with the parameters before the step.
+                * @return The mean squared error.
+                */
+                real_t getError( void ) const noexcept
+                {
+                    return error;
+                }
+
+                /**
+                * @brief Get the gradient of the last step, taken on the points
+                * of the input sets in the order of trainer::getParameters().
+                * It is the derivative of the squared error of the outputs,
+                * averaged over the samples of the mini-batch.
+                * @return A pointer to the gradient or @c nullptr if the
+                * trainer has not been used.
+                */
+                const real_t* getGradient( void ) const noexcept
+                {
+                    return ( nullptr != owner ) ? &buffer[ nPremise + nConsequent + nCovariance + ( 2U*nBlock ) ] : nullptr;
+                }
+            friend class instance;
+        };
+
 
     using deFuzzFunction = real_t (*)( output * const o, const deFuzzState stage );
     using fuzzyOperator = real_t (*)( const real_t a, const real_t b );
@@ -518,6 +757,14 @@ namespace qlibs {
             real_t *ruleWeight{ nullptr };
             real_t *wi{ nullptr };
             const rules *xRules{ nullptr };
+            ruleTerm *program{ nullptr };
+            size_t nPremises{ 0U };
+            size_t nConsequents{ 0U };
+            size_t *ruleFirst{ nullptr };
+            size_t *mfFirst{ nullptr };
+            size_t *mfRules{ nullptr };
+            size_t *ruleMark{ nullptr };
+            size_t epoch{ 0U };
             size_t rules_cols{ 0U};
             size_t nInputs{ 0 };
             size_t nOutputs{ 0 };
@@ -529,6 +776,21 @@ namespace qlibs {
             real_t rStrength{ 0.0_re };
             rules lastConnector;
             type xType{ Mamdani };
+            bool analytic{ false };
+            /*! @cond  */
+            struct region {
+                real_t area;
+                real_t moment;
+                real_t yMax;
+                real_t xSmallest;
+                real_t xLargest;
+                real_t target;
+                real_t x;
+                size_t pass;
+                bool started;
+                bool found;
+            };
+            /*! @endcond  */
             bool setMF( mf *m,
                         const tag io,
                         const tag mf,
@@ -543,7 +805,97 @@ namespace qlibs {
             size_t inferenceReachEnd( size_t i ) noexcept;
             size_t aggregationFindConsequent( size_t i ) noexcept;
             size_t inferenceConsequent( size_t i ) noexcept;
+            void setRuleStrength( const size_t r ) noexcept;
+            void aggregateConsequent( const size_t r,
+                                      const rules outIndex,
+                                      rules MFOutIndex ) noexcept;
+            bool parseRules( ruleTerm * const premises,
+                             ruleTerm * const consequents,
+                             size_t &np,
+                             size_t &nc ) const noexcept;
+            static real_t fuzzValue( const real_t * const fx,
+                                     rules index,
+                                     const size_t w,
+                                     const size_t s ) noexcept;
+            void batchPremises( const real_t * const inputs,
+                                const size_t w,
+                                real_t * const fx,
+                                real_t * const ws ) const noexcept;
+            void contextDeFuzzify( context &ctx,
+                                   const real_t * const ws ) const noexcept;
+            static size_t shapePoints( const mfFunction s ) noexcept;
+            static void shapeGradient( const mfFunction s,
+                                       const real_t x,
+                                       const real_t * const p,
+                                       real_t * const g ) noexcept;
+            static void operatorGradient( const methods_fcn op,
+                                          const real_t a,
+                                          const real_t b,
+                                          real_t &ga,
+                                          real_t &gb ) noexcept;
+            size_t coefficients( const mf &m ) const noexcept;
+            void trainingSizes( size_t &q,
+                                size_t &c,
+                                size_t &cov,
+                                size_t &co ) const noexcept;
+            bool bindTrainer( trainer &t ) const noexcept;
+            void trainSample( const real_t * const theta,
+                              context &ctx,
+                              const real_t * const in,
+                              const real_t * const target,
+                              const size_t q,
+                              const size_t cov,
+                              const size_t c ) const noexcept;
+            void trainOutputs( const real_t * const theta,
+                               context &ctx,
+                               const real_t * const target,
+                               const size_t q,
+                               const size_t cov,
+                               const size_t c ) const noexcept;
+            size_t compiledRule( size_t k ) noexcept;
+            void compiledInference( void ) noexcept;
+            void sparseInference( void ) noexcept;
+            bool analyticReady( const output * const outs ) const noexcept;
+            real_t nextKink( const real_t * const ws,
+                             const ruleTerm &c,
+                             const real_t x,
+                             real_t k ) const noexcept;
+            void termLine( const real_t * const ws,
+                           const ruleTerm &c,
+                           const real_t x0,
+                           const real_t xm,
+                           real_t &y0,
+                           real_t &s ) const noexcept;
+            static void addPiece( region &r,
+                                  const real_t u0,
+                                  const real_t u1,
+                                  const real_t y0,
+                                  const real_t y1 ) noexcept;
+            void envelope( const real_t * const ws,
+                           const size_t out,
+                           const real_t x0,
+                           const real_t x1,
+                           region &r ) const noexcept;
+            void analyticSweep( const real_t * const ws,
+                                const output &o,
+                                const size_t out,
+                                region &r ) const noexcept;
+            real_t analyticDeFuzz( const real_t * const ws,
+                                   const output &o,
+                                   const size_t out ) const noexcept;
             void fuzzyAggregate( void ) noexcept;
+            void gridBlock( const real_t * const ws,
+                            output &o,
+                            const size_t out,
+                            const size_t k0,
+                            real_t * const x,
+                            real_t * const y ) const noexcept;
+            void aggregateGrid( const real_t * const ws,
+                                output &o,
+                                const size_t out ) const noexcept;
+            real_t gridBisector( const real_t * const ws,
+                                 output &o,
+                                 const size_t out ) const noexcept;
             static const size_t INFERENCE_ERROR;
             tag lastTag{ -1 };
         public:
@@ -814,6 +1166,334 @@ namespace qlibs {
             */
             bool setRuleWeights( real_t *rWeights ) noexcept;
 
+            /**
+            * @brief Compile the rule set into the array @a buffer, so
+            * instance::inference() and instance::deFuzzify() do not parse the
+            * rule statements on every evaluation. The premises of all the rules
+            * are stored first, followed by the consequents of all the rules.
+            * The results are the same as the ones of the rule statements.
+            * On ::Mamdani systems, the output sets are also evaluated over
+            * blocks of points of the output universe, so the #trimf and
+            * #trapmf sets and the min/prod/max/sum operators run as plain
+            * loops that the compiler can vectorize.
+            * @pre The instance should have already been initialized with
+            * instance::setup().
+            * @note The rules are compiled only once. Call this method again if
+            * the instance is set up with another rule set.
+            * @param[in] buffer An array to hold the compiled rules. It needs one
+            * item for every #IS and #IS_NOT statement of the rule set.
+            * @param[in] n The number of elements in @a buffer.
+            * @return @c true on success, otherwise return @c false. On failure
+            * the rule statements are still used.
+            */
+            bool compileRules( ruleTerm * const buffer,
+                               const size_t n ) noexcept;
+
+            /**
+            * @brief Compile the rule set into the array @a buffer, so
+            * instance::inference() and instance::deFuzzify() do not parse the
+            * rule statements on every evaluation.
+            * @pre The instance should have already been initialized with
+            * instance::setup().
+            * @param[in] buffer An array to hold the compiled rules. It needs one
+            * item for every #IS and #IS_NOT statement of the rule set.
+            * @return @c true on success, otherwise return @c false.
+            */
+            template <size_t n>
+            bool compileRules( ruleTerm (&buffer)[ n ] ) noexcept
+            {
+                return compileRules( buffer, n );
+            }
+
+            /**
+            * @brief Build an index from the input sets to the rules that use
+            * them in the array @a buffer, so instance::inference() only
+            * evaluates the rules that have a premise with a nonzero membership
+            * or a negated premise. The strength of the other rules is zero.
+            * The results are the same as the ones of the full inference.
+            * @pre The rules should have already been compiled with
+            * instance::compileRules().
+            * @note The index is dropped when the rules are compiled again.
+            * @param[in] buffer An array to hold the index. It needs at least
+            * ( 3*r + m + p + 2 ) items, where @c r is the number of rules,
+            * @c m the number of input sets and @c p the number of premises
+            * of the rule set.
+            * @param[in] n The number of elements in @a buffer.
+            * @return @c true on success, otherwise return @c false. On failure
+            * all the compiled rules are evaluated.
+            */
+            bool setActiveSet( size_t * const buffer,
+                               const size_t n ) noexcept;
+
+            /**
+            * @brief Build an index from the input sets to the rules that use
+            * them in the array @a buffer. See instance::setActiveSet().
+            * @param[in] buffer An array to hold the index.
+            * @return @c true on success, otherwise return @c false.
+            */
+            template <size_t n>
+            bool setActiveSet( size_t (&buffer)[ n ] ) noexcept
+            {
+                return setActiveSet( buffer, n );
+            }
+
+            /**
+            * @brief Enable or disable the analytic de-Fuzzification of
+            * ::Mamdani systems. When enabled, the aggregated output sets are
+            * integrated in closed form instead of being sampled at
+            * instance::getNumberOfPoints() points, so the result does not depend
+            * on the number of points.
+            * @note It applies when the rules are compiled with
+            * instance::compileRules(), all the output sets used by the rules
+            * are ::trimf or ::trapmf, the implication is ::FIS_MIN or
+            * ::FIS_PROD, the aggregation is ::FIS_MAX or ::FIS_SUM and no
+            * output stores its aggregated region. Otherwise the sampled
+            * de-Fuzzification is used.
+            * @param[in] enable @c true to enable, @c false to disable.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setAnalyticDeFuzz( const bool enable ) noexcept;
+
+            /**
+            * @brief Sample the input membership function with the specified
+            * tag into the array @a buffer, so instance::fuzzify() evaluates it
+            * by linear interpolation over the table instead of calling the
+            * shape function. The samples are uniformly spaced over the range
+            * of the related input.
+            * @pre The input and the membership function must be previously
+            * initialized by instance::setupInput() and instance::setupInputMF().
+            * @note The table is dropped if the membership function is set up
+            * again. If the range of the input changes, call this method again.
+            * @param[in] mf The tag of the input membership function.
+            * @param[in] buffer An array to hold the samples.
+            * @param[in] n The number of elements in @a buffer. [ n >= 2 ]
+            * @param[in] tol The maximum allowed interpolation error. It is
+            * checked at the middle of every pair of samples and at the points
+            * of the membership function that lie in the range of the input.
+            * @return @c true when the table is used, otherwise return @c false.
+            * On failure, the membership function keeps its exact evaluation.
+            * The table is also rejected when the step between samples is wider
+            * than the support of a bounded set, such as ::trimf or ::trapmf.
+            */
+            bool tabulateInputMF( const tag mf,
+                                  real_t *buffer,
+                                  const size_t n,
+                                  const real_t tol ) noexcept;
+
+            /**
+            * @brief Sample the input membership function with the specified
+            * tag into the array @a buffer. See instance::tabulateInputMF().
+            * @param[in] mf The tag of the input membership function.
+            * @param[in] buffer An array to hold the samples.
+            * @param[in] tol The maximum allowed interpolation error.
+            * @return @c true when the table is used, otherwise return @c false.
+            */
+            template <size_t n>
+            bool tabulateInputMF( const tag mf,
+                                  real_t (&buffer)[ n ],
+                                  const real_t tol ) noexcept
+            {
+                return tabulateInputMF( mf, buffer, n, tol );
+            }
+
+            /**
+            * @brief Evaluate the FIS over a batch of input vectors. For every
+            * vector, the fuzzification, inference and de-Fuzzification are
+            * performed and the crisp outputs are written to @a outputs.
+            * @pre I/Os and fuzzy sets must be previously initialized by instance::setupInput(),
+            * instance::setupOutput(), instance::setupInputMF(), instance::setupOutputMF and instance::setup() respectively.
+            * @note Compile the rules with instance::compileRules() so the rule
+            * statements are parsed only once for the whole batch.
+            * @note With compiled rules the vectors are taken in blocks: each
+            * input set is evaluated over the whole block (from its table when
+            * it was tabulated with instance::tabulateInputMF()), then each
+            * rule over the whole block, and only the aggregation and the
+            * de-Fuzzification are done vector by vector. The results are the
+            * same of evaluating the vectors one at a time.
+            * @param[in] inputs An array with @a count input vectors, one after
+            * the other. Each vector holds one value per input, in tag order.
+            * @param[out] outputs An array with room for @a count output vectors.
+            * Each vector holds one value per output, in tag order.
+            * @param[in] count The number of input vectors.
+            * @return @c true on success, otherwise return @c false. The
+            * evaluation stops at the first vector that fails.
+            */
+            bool evaluateBatch( const real_t *inputs,
+                                real_t *outputs,
+                                const size_t count ) noexcept;
+
+            /**
+            * @brief Evaluate the FIS over a batch of input vectors using the
+            * evaluation state of @a ctx. The instance is not modified, so
+            * several threads can evaluate the same instance at the same time,
+            * each one with its own context.
+            * @pre The instance should be fully set up and its rules compiled
+            * with instance::compileRules(). The context should have already
+            * been initialized with context::setup() with the dimensions of
+            * the instance.
+            * @note The index of instance::setActiveSet() is not used here, all
+            * the compiled rules are evaluated.
+            * @note The vectors are taken in blocks as in
+            * instance::evaluateBatch( const real_t*, real_t*, const size_t ).
+            * The block holds as many vectors as the arrays of the context
+            * allow, so a context set up with @c w times the number of input
+            * sets and @c w times the number of rules evaluates @c w vectors
+            * per block.
+            * @param[in] ctx The evaluation context.
+            * @param[in] inputs An array with @a count input vectors, one after
+            * the other. Each vector holds one value per input, in tag order.
+            * @param[out] outputs An array with room for @a count output vectors.
+            * Each vector holds one value per output, in tag order.
+            * @param[in] count The number of input vectors.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool evaluateBatch( context &ctx,
+                                const real_t *inputs,
+                                real_t *outputs,
+                                const size_t count ) const noexcept;
+
+            /**
+            * @brief Evaluate one part of a batch of input vectors using the
+            * evaluation state of @a ctx. The batch is split in @a nParts
+            * consecutive ranges of about the same size and only the range
+            * @a part is evaluated, so @a nParts threads, each one with its
+            * own context, can share the batch of the same instance.
+            * @param[in] ctx The evaluation context.
+            * @param[in] inputs The array with the @a count input vectors of
+            * the whole batch.
+            * @param[out] outputs The array with room for the @a count output
+            * vectors of the whole batch. Only the vectors of the range are
+            * written.
+            * @param[in] count The number of input vectors of the whole batch.
+            * @param[in] part The index of the range, from 0 to @a nParts - 1.
+            * @param[in] nParts The number of ranges.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool evaluateBatch( context &ctx,
+                                const real_t *inputs,
+                                real_t *outputs,
+                                const size_t count,
+                                const size_t part,
+                                const size_t nParts ) const noexcept;
+
+            /**
+            * @brief Evaluate the FIS for one input vector using the evaluation
+            * state of @a ctx. See instance::evaluateBatch( context&, const real_t*, real_t*, const size_t ).
+            * @param[in] ctx The evaluation context.
+            * @param[in] inputs An array with one value per input, in tag order.
+            * @param[out] outputs An array with room for one value per output,
+            * in tag order.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool evaluate( context &ctx,
+                           const real_t *inputs,
+                           real_t *outputs ) const noexcept
+            {
+                return evaluateBatch( ctx, inputs, outputs, 1U );
+            }
+
+            /**
+            * @brief Get the number of elements needed by the array of a
+            * fis::trainer for this instance.
+            * @return The number of elements.
+            */
+            size_t getTrainingSize( void ) const noexcept;
+
+            /**
+            * @brief Get the number of elements needed by the training array
+            * of a fis::context for this instance. See context::setupTraining().
+            * @return The number of elements.
+            */
+            size_t getAccumulatorSize( void ) const noexcept;
+
+            /**
+            * @brief Accumulate the training sums of a mini-batch of recorded
+            * samples on @a ctx. Each sample is evaluated with the parameters
+            * of @a t, the gradient of the squared error is taken analytically
+            * on the points of the input sets and the normal equations of the
+            * least-squares fit of the ::Sugeno coefficients are added up. The
+            * instance and the trainer are not modified, so several threads can
+            * accumulate parts of a mini-batch at the same time, each one with
+            * its own context. The sums are applied by instance::trainReduce().
+            * @pre The rules should have already been compiled with
+            * instance::compileRules() and the training array of @a ctx given
+            * with context::setupTraining().
+            * @note The derivatives of the membership values are exact for the
+            * built-in shapes, and are chained through the fuzzy operators and
+            * the normalized strengths of the rules. The de-Fuzzification of a
+            * ::Mamdani system is differentiated numerically on the rule
+            * strengths. Sets with a custom shape are not trained.
+            * @param[in] t The trainer. A trainer not used yet takes the
+            * parameters of the instance.
+            * @param[in] ctx The context where the sums are accumulated.
+            * @param[in] inputs The input samples, one row of values per
+            * sample, in tag order.
+            * @param[in] outputs The expected outputs, one row of values per
+            * sample, in tag order.
+            * @param[in] count The number of samples.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool trainAccumulate( const trainer &t,
+                                  context &ctx,
+                                  const real_t *inputs,
+                                  const real_t *outputs,
+                                  const size_t count ) const noexcept;
+
+            /**
+            * @brief Run one hybrid training step with the sums accumulated on
+            * the contexts in @a ctx, and clear them. For ::Sugeno systems,
+            * the coefficients of the ::constantmf and ::linearmf output sets
+            * take the least-squares update of the summed normal equations and
+            * the points of the input sets take one gradient descent step.
+            * Both are computed with the parameters before the step.
+            * @note On its first step, the trainer copies the parameters of the
+            * instance into its own array and is tied to the instance from
+            * then on. A trainer already tied to another instance is refused.
+            * The points of the ::trimf, ::trapmf and ::pimf sets are kept in
+            * ascending order after every step. With the ::wtsum method, the
+            * strengths of the rules are not normalized when fitting the
+            * coefficients.
+            * @param[in] t The trainer.
+            * @param[in] ctx An array of contexts with accumulated sums.
+            * @param[in] nCtx The number of contexts in @a ctx.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool trainReduce( trainer &t,
+                              context * const ctx,
+                              const size_t nCtx ) const noexcept;
+
+            /**
+            * @brief Run one hybrid training step over a mini-batch of
+            * recorded samples, using @a ctx for the training sums. It is the
+            * same of instance::trainAccumulate() followed by
+            * instance::trainReduce() with only one context.
+            * @param[in] t The trainer.
+            * @param[in] ctx The context where the sums are accumulated.
+            * @param[in] inputs The input samples, one row of values per
+            * sample, in tag order.
+            * @param[in] outputs The expected outputs, one row of values per
+            * sample, in tag order.
+            * @param[in] count The number of samples in the mini-batch.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool train( trainer &t,
+                        context &ctx,
+                        const real_t *inputs,
+                        const real_t *outputs,
+                        const size_t count ) const noexcept
+            {
+                return trainAccumulate( t, ctx, inputs, outputs, count ) && trainReduce( t, &ctx, 1U );
+            }
+
+            /**
+            * @brief Point the trained sets of the instance to the parameters
+            * of @a t, so the instance is evaluated with them. The lookup
+            * tables of those input sets are dropped.
+            * @param[in] t A trainer tied to this instance.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool applyTraining( const trainer &t ) noexcept;
+
             /**
             * @brief Check if the FIS instance has been initialized.
             * @return @c true if instance has been initialized
@@ -1165,6 +1845,229 @@ namespace qlibs {
                 return sys.setRuleWeights( rWeights );
             }
 
+            /**
+            * @brief Compile the rule set into the array @a buffer, so the
+            * rule statements are not parsed on every evaluation. See
+            * instance::compileRules().
+            * @pre The instance should have already been initialized with
+            * system::setup().
+            * @param[in] buffer An array to hold the compiled rules. It needs one
+            * item for every #IS and #IS_NOT statement of the rule set.
+            * @return @c true on success, otherwise return @c false.
+            */
+            template <size_t n>
+            inline bool compileRules( ruleTerm (&buffer)[ n ] ) noexcept
+            {
+                return sys.compileRules( buffer, n );
+            }
+
+            /**
+            * @brief Build an index from the input sets to the rules that use
+            * them, so only the rules that can fire are evaluated. See
+            * instance::setActiveSet().
+            * @pre The rules should have already been compiled with
+            * system::compileRules().
+            * @param[in] buffer An array to hold the index.
+            * @return @c true on success, otherwise return @c false.
+            */
+            template <size_t n>
+            inline bool setActiveSet( size_t (&buffer)[ n ] ) noexcept
+            {
+                return sys.setActiveSet( buffer, n );
+            }
+
+            /**
+            * @brief Enable or disable the analytic de-Fuzzification of
+            * ::Mamdani systems. See instance::setAnalyticDeFuzz().
+            * @param[in] enable @c true to enable, @c false to disable.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool setAnalyticDeFuzz( const bool enable ) noexcept
+            {
+                return sys.setAnalyticDeFuzz( enable );
+            }
+
+            /**
+            * @brief Sample the input membership function with the specified
+            * tag into the array @a buffer. See instance::tabulateInputMF().
+            * @param[in] mf The tag of the input membership function.
+            * @param[in] buffer An array to hold the samples.
+            * @param[in] tol The maximum allowed interpolation error.
+            * @return @c true when the table is used, otherwise return @c false.
+            */
+            template <size_t n>
+            inline bool tabulateInputMF( const tag mf,
+                                         real_t (&buffer)[ n ],
+                                         const real_t tol ) noexcept
+            {
+                return sys.tabulateInputMF( mf, buffer, n, tol );
+            }
+
+            /**
+            * @brief Evaluate the FIS over a batch of input vectors. See
+            * instance::evaluateBatch().
+            * @param[in] xIn An array with @a count input vectors of
+            * @a numberOfInputs values each.
+            * @param[out] xOut An array with room for @a count output vectors
+            * of @a numberOfOutputs values each.
+            * @param[in] count The number of input vectors.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool evaluateBatch( const real_t *xIn,
+                                       real_t *xOut,
+                                       const size_t count ) noexcept
+            {
+                return sys.evaluateBatch( xIn, xOut, count );
+            }
+
+            /**
+            * @brief Evaluate the FIS over a batch of input vectors using the
+            * evaluation state of @a ctx. The system is not modified. See
+            * instance::evaluateBatch( context&, const real_t*, real_t*, const size_t ).
+            * @param[in] ctx The evaluation context.
+            * @param[in] xIn An array with @a count input vectors of
+            * @a numberOfInputs values each.
+            * @param[out] xOut An array with room for @a count output vectors
+            * of @a numberOfOutputs values each.
+            * @param[in] count The number of input vectors.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool evaluateBatch( context &ctx,
+                                       const real_t *xIn,
+                                       real_t *xOut,
+                                       const size_t count ) const noexcept
+            {
+                return sys.evaluateBatch( ctx, xIn, xOut, count );
+            }
+
+            /**
+            * @brief Evaluate one part of a batch of input vectors using the
+            * evaluation state of @a ctx. The system is not modified. See
+            * instance::evaluateBatch( context&, const real_t*, real_t*, const size_t, const size_t, const size_t ).
+            * @param[in] ctx The evaluation context.
+            * @param[in] xIn The array with the @a count input vectors of the
+            * whole batch.
+            * @param[out] xOut The array with room for the @a count output
+            * vectors of the whole batch.
+            * @param[in] count The number of input vectors of the whole batch.
+            * @param[in] part The index of the range, from 0 to @a nParts - 1.
+            * @param[in] nParts The number of ranges.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool evaluateBatch( context &ctx,
+                                       const real_t *xIn,
+                                       real_t *xOut,
+                                       const size_t count,
+                                       const size_t part,
+                                       const size_t nParts ) const noexcept
+            {
+                return sys.evaluateBatch( ctx, xIn, xOut, count, part, nParts );
+            }
+
+            /**
+            * @brief Get the number of elements needed by the array of a
+            * fis::trainer for this system. See instance::getTrainingSize().
+            * @return The number of elements.
+            */
+            inline size_t getTrainingSize( void ) const noexcept
+            {
+                return sys.getTrainingSize();
+            }
+
+            /**
+            * @brief Get the number of elements needed by the training array
+            * of a fis::context for this system. See
+            * instance::getAccumulatorSize().
+            * @return The number of elements.
+            */
+            inline size_t getAccumulatorSize( void ) const noexcept
+            {
+                return sys.getAccumulatorSize();
+            }
+
+            /**
+            * @brief Accumulate the training sums of a mini-batch of recorded
+            * samples on @a ctx. The system is not modified. See
+            * instance::trainAccumulate().
+            * @param[in] t The trainer.
+            * @param[in] ctx The context where the sums are accumulated.
+            * @param[in] xIn The input samples, one row of values per sample.
+            * @param[in] xOut The expected outputs, one row of values per
+            * sample.
+            * @param[in] count The number of samples.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool trainAccumulate( const trainer &t,
+                                         context &ctx,
+                                         const real_t *xIn,
+                                         const real_t *xOut,
+                                         const size_t count ) const noexcept
+            {
+                return sys.trainAccumulate( t, ctx, xIn, xOut, count );
+            }
+
+            /**
+            * @brief Run one hybrid training step with the sums accumulated on
+            * the contexts in @a ctx. See instance::trainReduce().
+            * @param[in] t The trainer.
+            * @param[in] ctx An array of contexts with accumulated sums.
+            * @param[in] nCtx The number of contexts in @a ctx.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool trainReduce( trainer &t,
+                                     context * const ctx,
+                                     const size_t nCtx ) const noexcept
+            {
+                return sys.trainReduce( t, ctx, nCtx );
+            }
+
+            /**
+            * @brief Run one hybrid training step over a mini-batch of
+            * recorded samples. The system is not modified. See
+            * instance::train().
+            * @param[in] t The trainer.
+            * @param[in] ctx The context where the sums are accumulated.
+            * @param[in] xIn The input samples, one row of values per sample.
+            * @param[in] xOut The expected outputs, one row of values per
+            * sample.
+            * @param[in] count The number of samples in the mini-batch.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool train( trainer &t,
+                               context &ctx,
+                               const real_t *xIn,
+                               const real_t *xOut,
+                               const size_t count ) const noexcept
+            {
+                return sys.train( t, ctx, xIn, xOut, count );
+            }
+
+            /**
+            * @brief Point the trained sets of the system to the parameters of
+            * @a t. See instance::applyTraining().
+            * @param[in] t A trainer tied to this system.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool applyTraining( const trainer &t ) noexcept
+            {
+                return sys.applyTraining( t );
+            }
+
+            /**
+            * @brief Evaluate the FIS for one input vector using the evaluation
+            * state of @a ctx. The system is not modified.
+            * @param[in] ctx The evaluation context.
+            * @param[in] xIn An array with @a numberOfInputs values.
+            * @param[out] xOut An array with room for @a numberOfOutputs values.
+            * @return @c true on success, otherwise return @c false.
+            */
+            inline bool evaluate( context &ctx,
+                                  const real_t *xIn,
+                                  real_t *xOut ) const noexcept
+            {
+                return sys.evaluate( ctx, xIn, xOut );
+            }
+
             /**
             * @brief Get the number of points used on Mamdani to perform the
             * de-fuzzification proccess
@@ -1241,6 +2144,614 @@ namespace qlibs {
             }
 
     };
+
+    /*! @cond  */
+    namespace impl {
+        /*cstat -MISRAC++2008-5-0-8 -MISRAC++2008-5-0-10 -CERT-INT30-C_a -CERT-INT32-C_a*/
+        /*single-statement walkers of a rule set, so the rule structure can be
+        resolved at compile time. They follow the same parsing of the
+        instance inference states*/
+        constexpr size_t fisSet( const rules s )
+        {
+            return static_cast<size_t>( ( s < 0 ) ? -s : s ) - 1U;
+        }
+        /*position of the first consequent of the rule that starts at p*/
+        constexpr size_t fisThen( const rules * const r,
+                                  const size_t p )
+        {
+            return ( Q_FIS_THEN == r[ p + 2U ] ) ? ( p + 3U ) : fisThen( r, p + 3U );
+        }
+        /*position of the rule that follows the consequent at q*/
+        constexpr size_t fisNext( const rules * const r,
+                                  const size_t q )
+        {
+            return ( Q_FIS_AND == r[ q + 2U ] ) ? fisNext( r, q + 3U ) : ( q + 2U );
+        }
+        constexpr size_t fisCount( const rules * const r,
+                                   const size_t p,
+                                   const size_t n )
+        {
+            return ( Q_FIS_RULES_END == r[ p ] ) ? n : fisCount( r, fisNext( r, fisThen( r, p ) ), n + 1U );
+        }
+        /*cstat +MISRAC++2008-5-0-8 +MISRAC++2008-5-0-10 +CERT-INT30-C_a +CERT-INT32-C_a*/
+        template <size_t I, shapeMF s, shapeMF... rest>
+        struct fisShapeAt {
+            static constexpr shapeMF value = fisShapeAt<I - 1U, rest...>::value;
+        };
+        template <shapeMF s, shapeMF... rest>
+        struct fisShapeAt<0U, s, rest...> {
+            static constexpr shapeMF value = s;
+        };
+        template <size_t... I>
+        struct fisSeq {};
+        template <size_t N, size_t... I>
+        struct fisMakeSeq : fisMakeSeq<N - 1U, N - 1U, I...> {};
+        template <size_t... I>
+        struct fisMakeSeq<0U, I...> {
+            using type = fisSeq<I...>;
+        };
+    }
+    /*! @endcond  */
+
+    /**
+    * @brief The shapes of the sets of a fis::fixedSystem, in the same order
+    * of their tags.
+    */
+    template <shapeMF... s>
+    struct sets {};
+
+    /**
+    * @brief The fuzzy operators of a fis::fixedSystem.
+    * @tparam andOp The AND operator. ::FIS_MIN or ::FIS_PROD
+    * @tparam orOp The OR operator. ::FIS_MAX or ::FIS_PROBOR
+    * @tparam implication The implication method. ::FIS_MIN or ::FIS_PROD
+    * @tparam aggregation The aggregation method. ::FIS_MAX, ::FIS_PROBOR or
+    * ::FIS_SUM
+    */
+    template <paramValue andOp = FIS_MIN, paramValue orOp = FIS_MAX, paramValue implication = FIS_MIN, paramValue aggregation = FIS_MAX>
+    struct operators {};
+
+    /**
+    * @brief A FIS whose whole specification is known at compile time.
+    * @details The membership shapes, the operators and the rules are template
+    * parameters, so the evaluation has no shape, operator or state dispatch
+    * at runtime: the rule set is walked by the compiler and every premise
+    * and consequent is emitted as straight-line code. Only the I/O ranges and
+    * the set points are given at runtime.
+    * @tparam fType Type of inference ::Mamdani, ::Sugeno or ::Tsukamoto.
+    * @tparam numberOfInputs The number of inputs of the FIS system.
+    * @tparam numberOfOutputs The number of outputs of the FIS system.
+    * @tparam R The rule set. A @c constexpr array of fis::rules.
+    * @tparam inputSets The shapes of the input sets as a fis::sets<>.
+    * @tparam outputSets The shapes of the output sets as a fis::sets<>.
+    * @tparam ops The fuzzy operators as a fis::operators<>.
+    * @tparam method The de-fuzzification method. ::centroid, ::bisector,
+    * ::mom, ::lom or ::som for ::Mamdani, ::wtaver or ::wtsum for ::Sugeno
+    * and ::wtaver for ::Tsukamoto. Other methods are rejected at compile
+    * time.
+    * @tparam numberOfPoints The number of points for de-fuzzification.
+    * @note The results are the same of a fis::instance configured with the
+    * same specification, including the de-fuzzification method and the rule
+    * weights set with fixedSystem::setRuleWeights().
+    * @note The rule set is unrolled through template recursion, so very large
+    * rule sets can reach the template instantiation depth of the compiler.
+    * Example:
+    * @code{.c}
+    * constexpr fis::rules rules[] = {
+    *     FIS_RULES_BEGIN
+    *         IF service IS poor OR food IS rancid THEN tip IS cheap END
+    *         IF service IS good THEN tip IS average END
+    *     FIS_RULES_END
+    * };
+    * fis::fixedSystem<fis::Mamdani, 2, 1, rules,
+    *                  fis::sets<fis::gaussmf, fis::gaussmf, fis::trapmf>,
+    *                  fis::sets<fis::trimf, fis::trimf>> tipper;
+    * @endcode
+    */
+    template <type fType, size_t numberOfInputs, size_t numberOfOutputs, const rules *R,
+              typename inputSets, typename outputSets, typename ops = operators<>,
+              deFuzzMethod method = ( Mamdani == fType ) ? centroid : wtaver,
+              size_t numberOfPoints = 100U>
+    class fixedSystem;
+
+    template <type fType, size_t numberOfInputs, size_t numberOfOutputs, const rules *R,
+              shapeMF... inShapes, shapeMF... outShapes,
+              paramValue andOp, paramValue orOp, paramValue implication, paramValue aggregation,
+              deFuzzMethod method, size_t numberOfPoints>
+    class fixedSystem<fType, numberOfInputs, numberOfOutputs, R, sets<inShapes...>, sets<outShapes...>,
+                      operators<andOp, orOp, implication, aggregation>, method, numberOfPoints>
+    : public core, private nonCopyable {
+        static_assert( ( Mamdani != fType ) || ( method <= som ), "Only the centroid, bisector, mom, lom and som methods are available for a Mamdani fixedSystem" );
+        static_assert( ( Sugeno != fType ) || ( wtaver == method ) || ( wtsum == method ), "Only the wtaver and wtsum methods are available for a Sugeno fixedSystem" );
+        static_assert( ( Tsukamoto != fType ) || ( wtaver == method ), "Only the wtaver method is available for a Tsukamoto fixedSystem" );
+        static_assert( ( numberOfInputs > 0U ) && ( numberOfOutputs > 0U ) && ( numberOfPoints > 0U ), "Empty fixedSystem" );
+        static_assert( impl::fisCount( R, 1U, 0U ) > 0U, "The rule set of a fixedSystem needs at least one rule" );
+        private:
+            static constexpr size_t nInputSets = sizeof...( inShapes );
+            static constexpr size_t nOutputSets = sizeof...( outShapes );
+            static constexpr size_t nRules = impl::fisCount( R, 1U, 0U );
+            input xInput[ numberOfInputs ];
+            ioBase xOutput[ numberOfOutputs ];
+            real_t inMin[ numberOfInputs ] = {};
+            real_t inMax[ numberOfInputs ] = {};
+            real_t outMin[ numberOfOutputs ] = {};
+            real_t outMax[ numberOfOutputs ] = {};
+            real_t res[ numberOfOutputs ] = {};
+            const real_t *inPoints[ nInputSets ] = {};
+            size_t inIndex[ nInputSets ] = {};
+            real_t inH[ nInputSets ] = {};
+            real_t fx[ nInputSets ] = {};
+            const real_t *outPoints[ nOutputSets ] = {};
+            real_t outH[ nOutputSets ] = {};
+            real_t wi[ nRules ] = {};
+            const real_t *ruleWeight{ nullptr };
+            /*running values of the sampled de-fuzzification of an output*/
+            struct sampledOutput {
+                real_t sxy{ 0.0_re };
+                real_t sy{ 0.0_re };
+                real_t yMax{ -1.0_re };
+                real_t xFirst{ 0.0_re };
+                real_t xLast{ 0.0_re };
+                bool plateau{ false };
+            };
+
+            static inline real_t shape( const shapeMF s,
+                                        const ioBase * const in,
+                                        const real_t *p,
+                                        const size_t n ) noexcept
+            {
+                real_t y;
+                /*s is a constant on every call, so only one case remains*/
+                switch ( s ) {
+                    case trimf: y = TriMF( in, p, n ); break;
+                    case trapmf: y = TrapMF( in, p, n ); break;
+                    case gbellmf: y = GBellMF( in, p, n ); break;
+                    case gaussmf: y = GaussMF( in, p, n ); break;
+                    case gauss2mf: y = Gauss2MF( in, p, n ); break;
+                    case sigmf: y = SigMF( in, p, n ); break;
+                    case dsigmf: y = DSigMF( in, p, n ); break;
+                    case psigmf: y = PSigMF( in, p, n ); break;
+                    case pimf: y = PiMF( in, p, n ); break;
+                    case smf: y = SMF( in, p, n ); break;
+                    case zmf: y = ZMF( in, p, n ); break;
+                    case singletonmf: y = SingletonMF( in, p, n ); break;
+                    case concavemf: y = ConcaveMF( in, p, n ); break;
+                    case spikemf: y = SpikeMF( in, p, n ); break;
+                    case linsmf: y = LinSMF( in, p, n ); break;
+                    case linzmf: y = LinZMF( in, p, n ); break;
+                    case rectmf: y = RectangleMF( in, p, n ); break;
+                    case cosmf: y = CosineMF( in, p, n ); break;
+                    case linearmf: y = LinearMF( in, p, n ); break;
+                    case tlinsmf: y = TLinSMF( in, p, n ); break;
+                    case tlinzmf: y = TLinZMF( in, p, n ); break;
+                    case tconcavemf: y = TConcaveMF( in, p, n ); break;
+                    case tsigmf: y = TSigMF( in, p, n ); break;
+                    case tsmf: y = TSMF( in, p, n ); break;
+                    case tzmf: y = TZMF( in, p, n ); break;
+                    case trampmf: y = TRampMF( in, p, n ); break;
+                    default: y = ConstantMF( in, p, n ); break;
+                }
+
+                return y;
+            }
+            static inline real_t op( const paramValue p,
+                                     const real_t a,
+                                     const real_t b ) noexcept
+            {
+                real_t y;
+                /*p is a constant on every call, so only one case remains*/
+                switch ( p ) {
+                    case FIS_MIN: y = Min( a, b ); break;
+                    case FIS_PROD: y = Prod( a, b ); break;
+                    case FIS_MAX: y = Max( a, b ); break;
+                    case FIS_PROBOR: y = ProbOr( a, b ); break;
+                    default: y = Sum( a, b ); break;
+                }
+
+                return y;
+            }
+            /*strength of the premises from the position P of the rule set,
+            C is the connector that joins them with the previous premises*/
+            template <size_t P, rules C, bool single = ( Q_FIS_THEN == R[ P + 2U ] )>
+            struct premise {
+                static inline real_t strength( const fixedSystem &f,
+                                               const real_t s ) noexcept
+                {
+                    return premise<P + 3U, R[ P + 2U ]>::strength( f, premise<P, C, true>::strength( f, s ) );
+                }
+            };
+            template <size_t P, rules C>
+            struct premise<P, C, true> {
+                static inline real_t strength( const fixedSystem &f,
+                                               const real_t s ) noexcept
+                {
+                    constexpr rules set = R[ P + 1U ];
+                    constexpr paramValue p = ( Q_FIS_AND == C ) ? andOp : ( ( Q_FIS_OR == C ) ? orOp : FIS_SUM );
+                    const real_t v = bound( f.fx[ impl::fisSet( set ) ] );
+
+                    return op( p, s, ( set < 0 ) ? ( 1.0_re - v ) : v );
+                }
+            };
+            /*consequents from the position Q of the rule set*/
+            template <size_t Q, bool single = ( Q_FIS_AND != R[ Q + 2U ] )>
+            struct consequent {
+                static inline void implicate( fixedSystem &f,
+                                              const real_t w,
+                                              real_t * const y ) noexcept
+                {
+                    consequent<Q, true>::implicate( f, w, y );
+                    consequent<Q + 3U>::implicate( f, w, y );
+                }
+                static inline void weigh( fixedSystem &f,
+                                          const real_t w,
+                                          real_t * const wz,
+                                          real_t * const sw ) noexcept
+                {
+                    consequent<Q, true>::weigh( f, w, wz, sw );
+                    consequent<Q + 3U>::weigh( f, w, wz, sw );
+                }
+            };
+            template <size_t Q>
+            struct consequent<Q, true> {
+                static inline void implicate( fixedSystem &f,
+                                              const real_t w,
+                                              real_t * const y ) noexcept
+                {
+                    constexpr size_t o = static_cast<size_t>( R[ Q ] );
+                    constexpr rules set = R[ Q + 1U ];
+                    constexpr size_t s = impl::fisSet( set );
+                    real_t v = f.outH[ s ]*shape( impl::fisShapeAt<s, outShapes...>::value, &f.xOutput[ o ], f.outPoints[ s ], 1U );
+
+                    v = ( set < 0 ) ? ( 1.0_re - v ) : v;
+                    y[ o ] = op( aggregation, y[ o ], op( implication, w, v ) );
+                }
+                static inline void weigh( fixedSystem &f,
+                                          const real_t w,
+                                          real_t * const wz,
+                                          real_t * const sw ) noexcept
+                {
+                    constexpr size_t o = static_cast<size_t>( R[ Q ] );
+                    constexpr size_t s = impl::fisSet( R[ Q + 1U ] );
+                    const real_t zi = f.outH[ s ]*shape( impl::fisShapeAt<s, outShapes...>::value, f.xInput, f.outPoints[ s ], numberOfInputs );
+
+                    wz[ o ] += zi*w;
+                    sw[ o ] += w;
+                }
+            };
+            /*the rule that starts at the position P of the rule set*/
+            template <size_t P, size_t r, bool end = ( Q_FIS_RULES_END == R[ P ] )>
+            struct rule {
+                static inline void infer( fixedSystem &f ) noexcept
+                {
+                    f.wi[ r ] = premise<P, Q_FIS_RULES_BEGIN>::strength( f, 0.0_re );
+                    if ( nullptr != f.ruleWeight ) {
+                        f.wi[ r ] *= bound( f.ruleWeight[ r ] );
+                    }
+                    rule<impl::fisNext( R, impl::fisThen( R, P ) ), r + 1U>::infer( f );
+                }
+                static inline void implicate( fixedSystem &f,
+                                              real_t * const y ) noexcept
+                {
+                    if ( f.wi[ r ] > 0.0_re ) {
+                        consequent<impl::fisThen( R, P )>::implicate( f, f.wi[ r ], y );
+                    }
+                    rule<impl::fisNext( R, impl::fisThen( R, P ) ), r + 1U>::implicate( f, y );
+                }
+                static inline void weigh( fixedSystem &f,
+                                          real_t * const wz,
+                                          real_t * const sw ) noexcept
+                {
+                    if ( f.wi[ r ] > 0.0_re ) {
+                        consequent<impl::fisThen( R, P )>::weigh( f, f.wi[ r ], wz, sw );
+                    }
+                    rule<impl::fisNext( R, impl::fisThen( R, P ) ), r + 1U>::weigh( f, wz, sw );
+                }
+            };
+            template <size_t P, size_t r>
+            struct rule<P, r, true> {
+                static inline void infer( fixedSystem &f ) noexcept
+                {
+                    (void)f;
+                }
+                static inline void implicate( fixedSystem &f,
+                                              real_t * const y ) noexcept
+                {
+                    (void)f;
+                    (void)y;
+                }
+                static inline void weigh( fixedSystem &f,
+                                          real_t * const wz,
+                                          real_t * const sw ) noexcept
+                {
+                    (void)f;
+                    (void)wz;
+                    (void)sw;
+                }
+            };
+            template <size_t... I>
+            inline void fuzzify( impl::fisSeq<I...> ) noexcept
+            {
+                const int unrolled[] = { 0, ( fx[ I ] = inH[ I ]*shape( inShapes, &xInput[ inIndex[ I ] ], inPoints[ I ], 1U ), 0 )... };
+                (void)unrolled;
+            }
+            /*the same steps of the de-fuzzification functions of fis::core*/
+            static inline void accumulate( sampledOutput &d,
+                                           const real_t x,
+                                           const real_t y ) noexcept
+            {
+                /*method is a constant, so only one case remains*/
+                switch ( method ) {
+                    case centroid:
+                        d.sxy += x*y;
+                        d.sy += y;
+                        break;
+                    case bisector:
+                        d.sy += y;
+                        break;
+                    case lom:
+                        if ( y >= d.yMax ) {
+                            d.yMax = y;
+                            d.xLast = x;
+                        }
+                        break;
+                    case som:
+                        if ( y > d.yMax ) {
+                            d.yMax = y;
+                            d.xFirst = x;
+                        }
+                        break;
+                    default: /*mom*/
+                        if ( y > d.yMax ) {
+                            d.yMax = y;
+                            d.xFirst = x;
+                            d.xLast = x;
+                            d.plateau = true;
+                        }
+                        else if ( ( ( d.yMax - y ) <= static_cast<real_t>( ( sizeof( real_t ) > sizeof( float ) ) ? DBL_MIN : FLT_MIN ) ) && d.plateau ) {
+                            d.xLast = x;
+                        }
+                        else if ( y < d.yMax ) {
+                            d.plateau = false;
+                        }
+                        else {
+                            /*nothing to do*/
+                        }
+                        break;
+                }
+            }
+            void sampleOutputs( const size_t k,
+                                real_t * const x,
+                                real_t * const y ) noexcept
+            {
+                for ( size_t i = 0U ; i < numberOfOutputs ; ++i ) {
+                    x[ i ] = outMin[ i ] + ( ( static_cast<real_t>( k ) + 0.5_re )*res[ i ] );
+                    y[ i ] = 0.0_re;
+                    setIOValue( xOutput[ i ], x[ i ] );
+                }
+                rule<1U, 0U>::implicate( *this, y );
+            }
+            void deFuzzSampled( real_t * const out ) noexcept
+            {
+                real_t x[ numberOfOutputs ], y[ numberOfOutputs ];
+                sampledOutput d[ numberOfOutputs ];
+
+                for ( size_t i = 0U ; i < numberOfOutputs ; ++i ) {
+                    d[ i ].xFirst = outMin[ i ];
+                    d[ i ].xLast = outMax[ i ];
+                }
+                for ( size_t k = 0U ; k < numberOfPoints ; ++k ) {
+                    sampleOutputs( k, x, y );
+                    for ( size_t i = 0U ; i < numberOfOutputs ; ++i ) {
+                        accumulate( d[ i ], x[ i ], y[ i ] );
+                    }
+                }
+                if ( bisector == method ) {
+                    /*second scan up to the point that halves the area*/
+                    real_t area[ numberOfOutputs ] = {};
+                    bool found[ numberOfOutputs ] = {};
+                    size_t pending = numberOfOutputs;
+
+                    for ( size_t k = 0U ; ( pending > 0U ) && ( k < numberOfPoints ) ; ++k ) {
+                        sampleOutputs( k, x, y );
+                        for ( size_t i = 0U ; i < numberOfOutputs ; ++i ) {
+                            if ( !found[ i ] ) {
+                                d[ i ].xFirst = x[ i ];
+                                area[ i ] += y[ i ];
+                                if ( area[ i ] >= ( 0.5_re*d[ i ].sy ) ) {
+                                    found[ i ] = true;
+                                    --pending;
+                                }
+                            }
+                        }
+                    }
+                }
+                for ( size_t i = 0U ; i < numberOfOutputs ; ++i ) {
+                    real_t v;
+
+                    switch ( method ) {
+                        case centroid: v = d[ i ].sxy/d[ i ].sy; break;
+                        case lom: v = d[ i ].xLast; break;
+                        case mom: v = 0.5_re*( d[ i ].xFirst + d[ i ].xLast ); break;
+                        default: v = d[ i ].xFirst; break; /*bisector and som*/
+                    }
+                    out[ i ] = bound( v, outMin[ i ], outMax[ i ] );
+                }
+            }
+            void deFuzzWeighted( real_t * const out ) noexcept
+            {
+                real_t wz[ numberOfOutputs ] = {}, sw[ numberOfOutputs ] = {};
+
+                rule<1U, 0U>::weigh( *this, wz, sw );
+                for ( size_t i = 0U ; i < numberOfOutputs ; ++i ) {
+                    const real_t d = ( wtsum == method ) ? wz[ i ] : ( wz[ i ]/sw[ i ] );
+
+                    out[ i ] = bound( d, outMin[ i ], outMax[ i ] );
+                }
+            }
+        public:
+            fixedSystem() = default;
+            virtual ~fixedSystem() {}
+
+            /**
+            * @brief Setup the input with the specified tag and set limits for it
+            * @param[in] t The input tag
+            * @param[in] Min Minimum allowed value for this input
+            * @param[in] Max Max allowed value for this input
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setupInput( const tag t,
+                             const real_t Min,
+                             const real_t Max ) noexcept
+            {
+                bool retValue = false;
+
+                if ( ( t >= 0 ) && ( static_cast<size_t>( t ) < numberOfInputs ) ) {
+                    inMin[ t ] = Min;
+                    inMax[ t ] = Max;
+                    setIORange( xInput[ t ], Min, Max );
+                    retValue = true;
+                }
+
+                return retValue;
+            }
+
+            /**
+            * @brief Setup the output with the specified tag and set limits for it
+            * @param[in] t The output tag
+            * @param[in] Min Minimum allowed value for this output
+            * @param[in] Max Max allowed value for this output
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setupOutput( const tag t,
+                              const real_t Min,
+                              const real_t Max ) noexcept
+            {
+                bool retValue = false;
+
+                if ( ( t >= 0 ) && ( static_cast<size_t>( t ) < numberOfOutputs ) ) {
+                    outMin[ t ] = Min;
+                    outMax[ t ] = Max;
+                    setIORange( xOutput[ t ], Min, Max );
+                    /*cstat -CERT-FLP36-C*/
+                    res[ t ] = ( Max - Min )/static_cast<real_t>( numberOfPoints );
+                    /*cstat +CERT-FLP36-C*/
+                    retValue = true;
+                }
+
+                return retValue;
+            }
+
+            /**
+            * @brief Setup the input tag and points for the specified membership
+            * function. The shape is the one given for @a mf in the template
+            * parameters.
+            * @param[in] io The input tag related with this membership function
+            * @param[in] mf The user-defined tag for this membership function
+            * @param[in] cp Points or coefficients of the membership function.
+            * @param[in] h Height of the membership function.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setupInputMF( const tag io,
+                               const tag mf,
+                               const real_t *cp,
+                               const real_t h = 1.0_re ) noexcept
+            {
+                bool retValue = false;
+
+                if ( ( io >= 0 ) && ( static_cast<size_t>( io ) < numberOfInputs ) &&
+                     ( mf >= 0 ) && ( static_cast<size_t>( mf ) < nInputSets ) ) {
+                    inIndex[ mf ] = static_cast<size_t>( io );
+                    inPoints[ mf ] = cp;
+                    inH[ mf ] = bound( h );
+                    retValue = true;
+                }
+
+                return retValue;
+            }
+
+            /**
+            * @brief Setup the points for the specified output membership
+            * function. The shape is the one given for @a mf in the template
+            * parameters and the output is the one given by the rules.
+            * @param[in] mf The user-defined tag for this membership function
+            * @param[in] cp Points or coefficients of the membership function.
+            * @param[in] h Height of the membership function.
+            * @note Height parameter @a h does not apply for output membership functions
+            * on ::Sugeno and ::Tsukamoto inference systems. [ 0 <= h <= 1]
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setupOutputMF( const tag mf,
+                                const real_t *cp,
+                                const real_t h = 1.0_re ) noexcept
+            {
+                bool retValue = false;
+
+                if ( ( mf >= 0 ) && ( static_cast<size_t>( mf ) < nOutputSets ) ) {
+                    outPoints[ mf ] = cp;
+                    outH[ mf ] = bound( h );
+                    retValue = true;
+                }
+
+                return retValue;
+            }
+
+            /**
+            * @brief Set weights to the rules of the system, as in
+            * instance::setRuleWeights(). The strength of every rule is
+            * multiplied by its weight, bounded to [ 0, 1 ].
+            * @param[in] rWeights An array with the values of every rule
+            * weight, in the order of the rules.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setRuleWeights( const real_t *rWeights ) noexcept
+            {
+                bool retValue = false;
+
+                if ( nullptr != rWeights ) {
+                    ruleWeight = rWeights;
+                    retValue = true;
+                }
+
+                return retValue;
+            }
+
+            /**
+            * @brief Evaluate the whole FIS for the given inputs.
+            * @param[in] in An array with @a numberOfInputs input values.
+            * @param[out] out An array where the @a numberOfOutputs output values
+            * will be written.
+            * @return @c true on success or @c false if a membership function
+            * has not been set.
+            */
+            bool evaluate( const real_t * const in,
+                           real_t * const out ) noexcept
+            {
+                bool retValue = ( nullptr != in ) && ( nullptr != out );
+
+                for ( size_t i = 0U ; retValue && ( i < nInputSets ) ; ++i ) {
+                    retValue = ( nullptr != inPoints[ i ] );
+                }
+                for ( size_t i = 0U ; retValue && ( i < nOutputSets ) ; ++i ) {
+                    retValue = ( nullptr != outPoints[ i ] );
+                }
+                if ( retValue ) {
+                    for ( size_t i = 0U ; i < numberOfInputs ; ++i ) {
+                        setIOValue( xInput[ i ], bound( in[ i ], inMin[ i ], inMax[ i ] ) );
+                    }
+                    fuzzify( typename impl::fisMakeSeq<nInputSets>::type() );
+                    rule<1U, 0U>::infer( *this );
+                    if ( Mamdani == fType ) {
+                        deFuzzSampled( out );
+                    }
+                    else {
+                        deFuzzWeighted( out );
+                    }
+                }
+
+                return retValue;
+            }
+    };
+
         /** @}*/
     }
 
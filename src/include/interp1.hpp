@@ -10,6 +10,7 @@
 #define QLIBS_INTERP1
 
 #include <include/qlibs_types.hpp>
+#include <include/ffmath.hpp>
 
 /**
 * @brief The qLibs++ library namespace.
@@ -38,19 +39,64 @@ namespace qlibs {
         /*! @endcond  */
     };
 
+    /**
+    * @brief An enum with the available methods to find the segment of the
+    * table that holds the input point.
+    */
+    enum interp1Search {
+        INTERP1_SEARCH_AUTO = 0,        /*!< Uniform when the x points are evenly spaced, binary otherwise.*/
+        INTERP1_SEARCH_SEQUENTIAL,      /*!< Scan the table from the first point, O(n).*/
+        INTERP1_SEARCH_BINARY,          /*!< Binary search, O(log n).*/
+        INTERP1_SEARCH_UNIFORM,         /*!< Direct index for evenly spaced x points, O(1).*/
+        INTERP1_SEARCH_HUNT,            /*!< Hunt from the segment of the previous input, O(1) for slowly changing inputs.*/
+        /*! @cond  */
+        INTERP1_SEARCH_MAX,
+        /*! @endcond  */
+    };
+
+    /**
+    * @brief Variable that allocates the coefficients of a table with
+    * @a sizeTable points for interp1::prepare().
+    * @tparam [in] sizeTable The number of points of the table.
+    */
+    template <size_t sizeTable>
+    using interp1Coefficients = real_t[ 4U*( sizeTable - 1U ) ];
+
+    /*! @cond */
+    template <size_t D>
+    class interpN;
+    /*! @endcond */
+
     /**
     * @brief A 1D interpolation object.
     */
     class interp1 {
+        template <size_t D>
+        friend class interpN;
         private:
-            using interp1Fcn_t = real_t (*)( const real_t x,
-                                             const real_t * const tx,
-                                             const real_t * const ty,
-                                             const size_t tableSize );
+            using interp1Fcn_t = real_t (interp1::*)( const real_t x );
             const real_t *xData{ nullptr };
             const real_t *yData{ nullptr };
             size_t dataSize{ 0U };
-            interp1Fcn_t method{ &linear };
+            interp1Fcn_t method{ &interp1::linear };
+            interp1Search search{ INTERP1_SEARCH_AUTO };
+            bool uniform{ false };
+            real_t invStep{ 0.0_re };
+            size_t cursor{ 0U };
+            interp1Method current{ INTERP1_LINEAR };
+            real_t *coeff{ nullptr };
+            size_t coeffSize{ 0U };
+            void updateGrid( void ) noexcept;
+            size_t segment( const real_t x ) noexcept;
+            size_t locate( const real_t x,
+                           const bool lower ) noexcept;
+            size_t nextIndex( const real_t x ) noexcept;
+            size_t previousIndex( const real_t x ) noexcept;
+            size_t nearestIndex( const real_t x ) noexcept;
+            size_t weights( const real_t x,
+                            size_t &first,
+                            real_t * const w ) noexcept;
+            interp1() = default;
             static real_t slope( const real_t * const tx,
                                  const real_t * const ty,
                                  const size_t i );
@@ -66,42 +112,18 @@ namespace qlibs {
                                                const real_t * const ty,
                                                const size_t n,
                                                const size_t i );
-            static real_t next( const real_t x,
-                                const real_t * const tx,
-                                const real_t * const ty,
-                                const size_t tableSize );
-            static real_t previous( const real_t x,
-                                    const real_t * const tx,
-                                    const real_t * const ty,
-                                    const size_t tableSize );
-            static real_t nearest( const real_t x,
-                                   const real_t * const tx,
-                                   const real_t * const ty,
-                                   const size_t tableSize );
-            static real_t linear( const real_t x,
-                                  const real_t * const tx,
-                                  const real_t * const ty,
-                                  const size_t tableSize );
-            static real_t sine( const real_t x,
-                                const real_t * const tx,
-                                const real_t * const ty,
-                                const size_t tableSize );
-            static real_t cubic( const real_t x,
-                                 const real_t * const tx,
-                                 const real_t * const ty,
-                                 const size_t tableSize );
-            static real_t hermite( const real_t x,
-                                   const real_t * const tx,
-                                   const real_t * const ty,
-                                   const size_t tableSize );
-            static real_t spline( const real_t x,
-                                  const real_t * const tx,
-                                  const real_t * const ty,
-                                  const size_t tableSize );
-            static real_t cSpline( const real_t x,
-                                   const real_t * const tx,
-                                   const real_t * const ty,
-                                   const size_t tableSize );
+            real_t next( const real_t x ) noexcept;
+            real_t previous( const real_t x ) noexcept;
+            real_t nearest( const real_t x ) noexcept;
+            real_t linear( const real_t x ) noexcept;
+            real_t sine( const real_t x ) noexcept;
+            real_t cubic( const real_t x ) noexcept;
+            real_t hermite( const real_t x ) noexcept;
+            real_t spline( const real_t x ) noexcept;
+            real_t cSpline( const real_t x ) noexcept;
+            real_t preparedHermite( const real_t x ) noexcept;
+            real_t preparedSpline( const real_t x ) noexcept;
+            real_t preparedCSpline( const real_t x ) noexcept;
         public:
             virtual ~interp1() = default;
             /**
@@ -112,7 +134,10 @@ namespace qlibs {
             */
             interp1( const real_t * const xTable,
                      const real_t * const yTable,
-                     const size_t sizeTable ) : xData( xTable ), yData( yTable ), dataSize( sizeTable ) {}
+                     const size_t sizeTable ) : xData( xTable ), yData( yTable ), dataSize( sizeTable )
+            {
+                updateGrid();
+            }
 
             /**
             * @brief Constructor for the 1D interpolation instance.
@@ -139,6 +164,10 @@ namespace qlibs {
                     xData = xTable;
                     yData = yTable;
                     dataSize = sizeTable;
+                    updateGrid();
+                    if ( nullptr != coeff ) {
+                        (void)prepare( coeff, coeffSize );
+                    }
                     retValue = true;
                 }
                 return retValue;
@@ -158,11 +187,73 @@ namespace qlibs {
 
             /**
             * @brief Specify the interpolation method to use.
+            * @note Any previous preparation of coefficients is discarded, see
+            * interp1::prepare().
             * @param[in] m The interpolation method.
             * @return @c true on success otherwise @c false.
             */
             bool setMethod( const interp1Method m ) noexcept;
 
+            /**
+            * @brief Precompute the coefficients of the current method for the
+            * whole table, so each call to interp1::get() only takes the
+            * segment search and the evaluation of a cubic polynomial.
+            * Applies to ::INTERP1_SPLINE and ::INTERP1_CONSTRAINED_SPLINE.
+            * For ::INTERP1_HERMITE the barycentric weights of the polynomial
+            * are stored instead, and the evaluation takes O(n) instead of
+            * O(n^2). The other methods do not need coefficients and they are
+            * not affected.
+            * @note Call it again after interp1::setMethod(). If the data is
+            * changed with interp1::setData(), the coefficients are computed
+            * again in the same buffer.
+            * @note For ::INTERP1_SPLINE and ::INTERP1_HERMITE the result can
+            * differ from the one without preparation in the rounding.
+            * @param[in] buffer An array with at least 4*(n-1) elements to hold
+            * the coefficients, where n is the number of points of the table.
+            * Its lifetime should be at least the same as the interp1 instance.
+            * @param[in] bufferSize The number of elements in @a buffer.
+            * @return @c true on success otherwise @c false.
+            */
+            bool prepare( real_t * const buffer,
+                          const size_t bufferSize ) noexcept;
+
+            /**
+            * @brief Precompute the coefficients of the current method for the
+            * whole table. See interp1::prepare().
+            * @param[in] buffer An array to hold the coefficients, see
+            * ::interp1Coefficients.
+            * @return @c true on success otherwise @c false.
+            */
+            template <size_t bufferSize>
+            bool prepare( real_t (&buffer)[ bufferSize ] ) noexcept
+            {
+                return prepare( buffer, bufferSize );
+            }
+
+            /**
+            * @brief Specify the method used to find the segment of the table
+            * that holds the input point. The result of the interpolation does
+            * not depend on it. By default, ::INTERP1_SEARCH_AUTO is used.
+            * @note ::INTERP1_SEARCH_UNIFORM can be used with any table, but it
+            * only takes O(1) when the x points are evenly spaced.
+            * @note ::INTERP1_SEARCH_HUNT starts from the segment found for the
+            * previous input and gallops away from it, so it takes O(1) when the
+            * input changes slowly between calls and O(log n) in the worst case.
+            * @param[in] s The search method.
+            * @return @c true on success otherwise @c false.
+            */
+            bool setSearch( const interp1Search s ) noexcept;
+
+            /**
+            * @brief Check if the x points of the table are evenly spaced.
+            * @return @c true if the x points are evenly spaced, otherwise
+            * return @c false.
+            */
+            bool isUniform( void ) const noexcept
+            {
+                return uniform;
+            }
+
             /**
             * @brief Interpolate input point @a x to determine the value of @a y
             * at the points @a xi using the current method. If value is beyond
@@ -173,10 +264,499 @@ namespace qlibs {
             template <typename T>
             inline real_t get( const T x ) noexcept
             {
-                return method( static_cast<real_t>( x ), xData, yData, dataSize );
+                return ( this->*method )( static_cast<real_t>( x ) );
+            }
+
+            /**
+            * @brief Interpolate the input points @a xq using the current
+            * method. The result of each point is the same as the one of
+            * interp1::get( x ).
+            * @note When @a xq is sorted in ascending order, the table is swept
+            * once along with the input points, hunting each segment from the
+            * previous one, so the whole batch takes O(n+m). Otherwise, the
+            * linear, previous, next and nearest methods locate the segments of
+            * several points at once with SIMD instructions when available.
+            * @param[in] xq An array of size @a m with the input points.
+            * @param[out] yq An array of size @a m to hold the interpolated
+            * values. It can be the same array as @a xq.
+            * @param[in] m The number of points in @a xq and @a yq.
+            */
+            void get( const real_t * const xq,
+                      real_t * const yq,
+                      const size_t m ) noexcept;
+
+            /**
+            * @brief Interpolate the input points @a xq using the current
+            * method. See interp1::get( xq, yq, m ).
+            * @param[in] xq An array with the input points.
+            * @param[out] yq An array to hold the interpolated values.
+            */
+            template <size_t m>
+            void get( const real_t (&xq)[ m ],
+                      real_t (&yq)[ m ] ) noexcept
+            {
+                get( xq, yq, m );
             }
     };
 
+    /*! @cond */
+    namespace impl {
+        /*cstat -MISRAC++2008-5-0-8 -MISRAC++2008-5-0-10 -CERT-INT30-C_a*/
+        /*single-statement kernels of interp1, so they can be evaluated at
+        compile time. They follow the same arithmetic of the interp1 methods*/
+        constexpr real_t interp1Abs( const real_t v )
+        {
+            return ( v < 0.0_re ) ? -v : v;
+        }
+        constexpr bool interp1IsEqual( const real_t a,
+                                       const real_t b )
+        {
+            return ( interp1Abs( a - b ) <= REAL_MIN );
+        }
+        constexpr bool interp1IsBefore( const real_t v,
+                                        const real_t x,
+                                        const bool lower )
+        {
+            return ( lower ) ? ( v < x ) : ( v <= x );
+        }
+        constexpr size_t interp1Bisect( const real_t * const tx,
+                                        const real_t x,
+                                        const bool lower,
+                                        const size_t lo,
+                                        const size_t hi );
+        constexpr size_t interp1BisectAt( const real_t * const tx,
+                                          const real_t x,
+                                          const bool lower,
+                                          const size_t lo,
+                                          const size_t hi,
+                                          const size_t mid )
+        {
+            return ( interp1IsBefore( tx[ mid ], x, lower ) ) ? interp1Bisect( tx, x, lower, mid + 1U, hi )
+                                                              : interp1Bisect( tx, x, lower, lo, mid );
+        }
+        /*the number of table points before x, see interp1::locate()*/
+        constexpr size_t interp1Bisect( const real_t * const tx,
+                                        const real_t x,
+                                        const bool lower,
+                                        const size_t lo,
+                                        const size_t hi )
+        {
+            return ( lo < hi ) ? interp1BisectAt( tx, x, lower, lo, hi, lo + ( ( hi - lo )/2U ) ) : lo;
+        }
+        /*the segment of the smooth methods, see interp1::segment()*/
+        constexpr size_t interp1Segment( const real_t * const tx,
+                                         const size_t n,
+                                         const real_t x )
+        {
+            return ( x <= tx[ 0 ] ) ? 0U
+                   : ( ( x >= tx[ n - 1U ] ) ? ( n - 2U ) : ( interp1Bisect( tx, x, false, 0U, n ) - 1U ) );
+        }
+        constexpr real_t interp1NextAt( const real_t * const ty,
+                                        const size_t i )
+        {
+            return ty[ ( i > 1U ) ? i : 1U ];
+        }
+        constexpr real_t interp1Next( const real_t * const tx,
+                                      const real_t * const ty,
+                                      const size_t n,
+                                      const real_t x )
+        {
+            return ( x >= tx[ n - 1U ] ) ? ty[ n - 1U ] : interp1NextAt( ty, interp1Bisect( tx, x, false, 0U, n ) );
+        }
+        constexpr real_t interp1Previous( const real_t * const tx,
+                                          const real_t * const ty,
+                                          const size_t n,
+                                          const real_t x )
+        {
+            return ( x <= tx[ 0 ] ) ? ty[ 0 ] : ty[ interp1Bisect( tx, x, false, 0U, n ) - 1U ];
+        }
+        constexpr size_t interp1LastRepeated( const real_t * const tx,
+                                              const size_t n,
+                                              const size_t i )
+        {
+            return ( ( ( i + 1U ) < n ) && !( tx[ i + 1U ] > tx[ i ] ) ) ? interp1LastRepeated( tx, n, i + 1U ) : i;
+        }
+        constexpr real_t interp1NearestAt( const real_t * const tx,
+                                           const real_t * const ty,
+                                           const size_t n,
+                                           const real_t x,
+                                           const size_t i )
+        {
+            return ( n == i ) ? ty[ n - 1U ]
+                   : ( ( ( i > 0U ) && ( interp1Abs( x - tx[ i ] ) > interp1Abs( x - tx[ i - 1U ] ) ) ) ? ty[ i - 1U ]
+                                                                                                        : ty[ interp1LastRepeated( tx, n, i ) ] );
+        }
+        constexpr real_t interp1Nearest( const real_t * const tx,
+                                         const real_t * const ty,
+                                         const size_t n,
+                                         const real_t x )
+        {
+            return interp1NearestAt( tx, ty, n, x, interp1Bisect( tx, x, false, 0U, n ) );
+        }
+        /*the line from point a to point b*/
+        constexpr real_t interp1LinearOn( const real_t xa,
+                                          const real_t xb,
+                                          const real_t ya,
+                                          const real_t yb,
+                                          const real_t x )
+        {
+            return ya + ( ( yb - ya )/( xb - xa ) )*( x - xa );
+        }
+        constexpr real_t interp1LinearAt( const real_t * const tx,
+                                          const real_t * const ty,
+                                          const size_t i,
+                                          const real_t x )
+        {
+            return interp1LinearOn( tx[ i ], tx[ i + 1U ], ty[ i ], ty[ i + 1U ], x );
+        }
+        constexpr real_t interp1LinearIn( const real_t * const tx,
+                                          const real_t * const ty,
+                                          const size_t j,
+                                          const real_t x )
+        {
+            return interp1LinearAt( tx, ty, ( j > 0U ) ? ( j - 1U ) : 0U, x );
+        }
+        constexpr real_t interp1Linear( const real_t * const tx,
+                                        const real_t * const ty,
+                                        const size_t n,
+                                        const real_t x )
+        {
+            return ( x < tx[ 0 ] ) ? interp1LinearAt( tx, ty, 0U, x )
+                   : ( ( x > tx[ n - 1U ] ) ? interp1LinearOn( tx[ n - 1U ], tx[ n - 2U ], ty[ n - 1U ], ty[ n - 2U ], x )
+                                            : interp1LinearIn( tx, ty, interp1Bisect( tx, x, true, 0U, n ), x ) );
+        }
+        /*sine needs ffmath::cos(), so it can only be evaluated at run time*/
+        inline real_t interp1SineOn( const real_t xa,
+                                     const real_t xb,
+                                     const real_t ya,
+                                     const real_t yb,
+                                     const real_t x )
+        {
+            return ya + ( 0.5_re - 0.5_re*ffmath::cos( ffmath::FFP_PI*( x - xa )/( xb - xa ) ) )*( yb - ya );
+        }
+        inline real_t interp1Sine( const real_t * const tx,
+                                   const real_t * const ty,
+                                   const size_t n,
+                                   const real_t x )
+        {
+            const size_t j = interp1Bisect( tx, x, true, 0U, n );
+            const size_t i = ( j > 1U ) ? j : 1U;
+
+            return ( x < tx[ 0 ] ) ? interp1SineOn( tx[ 0 ], tx[ 1 ], ty[ 0 ], ty[ 1 ], x )
+                   : ( ( x > tx[ n - 1U ] ) ? interp1SineOn( tx[ n - 1U ], tx[ n - 2U ], ty[ n - 1U ], ty[ n - 2U ], x )
+                                            : interp1SineOn( tx[ i - 1U ], tx[ i ], ty[ i - 1U ], ty[ i ], x ) );
+        }
+        /*the cubic Hermite basis, da and db are the differences for the slopes*/
+        constexpr real_t interp1CubicBasis( const real_t ya,
+                                            const real_t da,
+                                            const real_t yb,
+                                            const real_t db,
+                                            const real_t h,
+                                            const real_t t,
+                                            const real_t t2,
+                                            const real_t t3 )
+        {
+            return ( 2.0_re*t3 - 3.0_re*t2 + 1.0_re )*ya +
+                   ( t3 - 2.0_re*t2 + t )*h*da +
+                   ( -2.0_re*t3 + 3.0_re*t2 )*yb +
+                   ( t3 - t2 )*h*db;
+        }
+        constexpr real_t interp1CubicT( const real_t ya,
+                                        const real_t da,
+                                        const real_t yb,
+                                        const real_t db,
+                                        const real_t h,
+                                        const real_t t,
+                                        const real_t t2 )
+        {
+            return interp1CubicBasis( ya, da, yb, db, h, t, t2, t2*t );
+        }
+        constexpr real_t interp1CubicOn( const real_t ya,
+                                         const real_t da,
+                                         const real_t yb,
+                                         const real_t db,
+                                         const real_t h,
+                                         const real_t t )
+        {
+            return interp1CubicT( ya, da, yb, db, h, t, t*t );
+        }
+        constexpr real_t interp1CubicIn( const real_t * const tx,
+                                         const real_t * const ty,
+                                         const size_t i,
+                                         const real_t x )
+        {
+            return interp1CubicOn( ty[ i - 1U ], ty[ i - 1U ] - ( ( i > 1U ) ? ty[ i - 2U ] : ty[ i - 1U ] ),
+                                   ty[ i ], ty[ i ] - ty[ i - 1U ],
+                                   tx[ i ] - tx[ i - 1U ], ( x - tx[ i - 1U ] )/( tx[ i ] - tx[ i - 1U ] ) );
+        }
+        constexpr real_t interp1CubicAt( const real_t * const tx,
+                                         const real_t * const ty,
+                                         const size_t j,
+                                         const real_t x )
+        {
+            return interp1CubicIn( tx, ty, ( j > 1U ) ? j : 1U, x );
+        }
+        constexpr real_t interp1Cubic( const real_t * const tx,
+                                       const real_t * const ty,
+                                       const size_t n,
+                                       const real_t x )
+        {
+            return ( x < tx[ 0 ] ) ? interp1CubicOn( ty[ 0 ], ty[ 0 ] - ty[ 1 ], ty[ 1 ], ty[ 1 ] - ty[ 0 ],
+                                                     tx[ 1 ] - tx[ 0 ], ( x - tx[ 0 ] )/( tx[ 1 ] - tx[ 0 ] ) )
+                   : ( ( x > tx[ n - 1U ] ) ? interp1CubicOn( ty[ n - 1U ], ty[ n - 2U ] - ty[ n - 3U ], ty[ n - 2U ], ty[ n - 1U ] - ty[ n - 2U ],
+                                                              tx[ n - 1U ] - tx[ n - 2U ], ( x - tx[ n - 1U ] )/( tx[ n - 1U ] - tx[ n - 2U ] ) )
+                                            : interp1CubicAt( tx, ty, interp1Bisect( tx, x, true, 0U, n ), x ) );
+        }
+        /*the global polynomial of the hermite method, term by term*/
+        constexpr real_t interp1LagrangeTerm( const real_t * const tx,
+                                              const size_t n,
+                                              const real_t x,
+                                              const size_t i,
+                                              const size_t j,
+                                              const real_t term )
+        {
+            return ( j < n ) ? interp1LagrangeTerm( tx, n, x, i, j + 1U, ( i != j ) ? ( term*( ( x - tx[ j ] )/( tx[ i ] - tx[ j ] ) ) ) : term )
+                             : term;
+        }
+        constexpr real_t interp1LagrangeSum( const real_t * const tx,
+                                             const real_t * const ty,
+                                             const size_t n,
+                                             const real_t x,
+                                             const size_t i,
+                                             const real_t y )
+        {
+            return ( i < n ) ? interp1LagrangeSum( tx, ty, n, x, i + 1U, y + interp1LagrangeTerm( tx, n, x, i, 0U, ty[ i ] ) ) : y;
+        }
+        constexpr real_t interp1Hermite( const real_t * const tx,
+                                         const real_t * const ty,
+                                         const size_t n,
+                                         const real_t x )
+        {
+            return ( x < tx[ 0 ] ) ? interp1LinearAt( tx, ty, 0U, x )
+                   : ( ( x > tx[ n - 1U ] ) ? interp1LinearOn( tx[ n - 1U ], tx[ n - 2U ], ty[ n - 1U ], ty[ n - 2U ], x )
+                                            : interp1LagrangeSum( tx, ty, n, x, 0U, 0.0_re ) );
+        }
+        constexpr real_t interp1Slope( const real_t * const tx,
+                                       const real_t * const ty,
+                                       const size_t i )
+        {
+            return ( interp1IsEqual( tx[ i + 1U ], tx[ i - 1U ] ) ) ? 0.0_re
+                   : ( ty[ i + 1U ] - ty[ i - 1U ] )/( tx[ i + 1U ] - tx[ i - 1U ] );
+        }
+        constexpr real_t interp1SplineM0( const real_t * const tx,
+                                          const real_t * const ty,
+                                          const size_t n,
+                                          const size_t i )
+        {
+            return ( 0U == i ) ? ( ty[ 1 ] - ty[ 0 ] )/( tx[ 1 ] - tx[ 0 ] )
+                   : ( ( ( n - 2U ) == i ) ? ( ty[ n - 1U ] - ty[ n - 3U ] )/( tx[ n - 1U ] - tx[ n - 3U ] )
+                                           : interp1Slope( tx, ty, i ) );
+        }
+        constexpr real_t interp1SplineM1( const real_t * const tx,
+                                          const real_t * const ty,
+                                          const size_t n,
+                                          const size_t i )
+        {
+            return ( 0U == i ) ? ( ty[ 2 ] - ty[ 0 ] )/( tx[ 2 ] - tx[ 0 ] )
+                   : ( ( ( n - 2U ) == i ) ? ( ty[ n - 1U ] - ty[ n - 2U ] )/( tx[ n - 1U ] - tx[ n - 2U ] )
+                                           : interp1Slope( tx, ty, i + 1U ) );
+        }
+        constexpr real_t interp1SplineBasis( const real_t y0,
+                                             const real_t y1,
+                                             const real_t x1_x0,
+                                             const real_t m0,
+                                             const real_t m1,
+                                             const real_t t,
+                                             const real_t t_2,
+                                             const real_t t_3 )
+        {
+            return ( ( 1.0_re - ( ( 3.0_re*t_2 ) - ( 2.0_re*t_3 ) ) )*y0 ) +
+                   ( ( ( 3.0_re*t_2 ) - ( 2.0_re*t_3 ) )*y1 ) +
+                   ( ( t_3 - 2.0_re*t_2 + t )*x1_x0*m0 ) +
+                   ( ( t_3 - t_2 )*x1_x0*m1 );
+        }
+        constexpr real_t interp1SplineT( const real_t * const tx,
+                                         const real_t * const ty,
+                                         const size_t n,
+                                         const size_t i,
+                                         const real_t t,
+                                         const real_t t_2 )
+        {
+            return interp1SplineBasis( ty[ i ], ty[ i + 1U ], tx[ i + 1U ] - tx[ i ],
+                                       interp1SplineM0( tx, ty, n, i ), interp1SplineM1( tx, ty, n, i ),
+                                       t, t_2, t_2*t );
+        }
+        constexpr real_t interp1SplineAt( const real_t * const tx,
+                                          const real_t * const ty,
+                                          const size_t n,
+                                          const size_t i,
+                                          const real_t t )
+        {
+            return interp1SplineT( tx, ty, n, i, t, t*t );
+        }
+        constexpr real_t interp1SplineOn( const real_t * const tx,
+                                          const real_t * const ty,
+                                          const size_t n,
+                                          const real_t x,
+                                          const size_t i )
+        {
+            return ( interp1IsEqual( x, tx[ i + 1U ] ) ) ? ty[ i + 1U ]
+                   : interp1SplineAt( tx, ty, n, i, ( x - tx[ i ] )/( tx[ i + 1U ] - tx[ i ] ) );
+        }
+        constexpr real_t interp1Spline( const real_t * const tx,
+                                        const real_t * const ty,
+                                        const size_t n,
+                                        const real_t x )
+        {
+            return interp1SplineOn( tx, ty, n, x, interp1Segment( tx, n, x ) );
+        }
+        /*see interp1::firstDerivate(), n is the last index*/
+        constexpr real_t interp1EdgeDerivate( const real_t dx,
+                                              const real_t dy,
+                                              const real_t dx2,
+                                              const real_t dy2 )
+        {
+            return ( 1.5_re*( dy/dx ) ) - ( 1.0_re/( dx2/dy2 + ( dx/dy ) ) );
+        }
+        constexpr real_t interp1InnerDerivate( const real_t tmp1,
+                                               const real_t tmp2 )
+        {
+            return ( ( tmp1*tmp2 ) < 0.0_re ) ? 0.0_re : ( 2.0_re/( tmp1 + tmp2 ) );
+        }
+        constexpr real_t interp1FirstDerivate( const real_t * const tx,
+                                               const real_t * const ty,
+                                               const size_t n,
+                                               const size_t i )
+        {
+            return ( 0U == i ) ? interp1EdgeDerivate( tx[ 1 ] - tx[ 0 ], ty[ 1 ] - ty[ 0 ], tx[ 2 ] - tx[ 0 ], ty[ 2 ] - ty[ 0 ] )
+                   : ( ( n == i ) ? interp1EdgeDerivate( tx[ n ] - tx[ n - 1U ], ty[ n ] - ty[ n - 1U ], tx[ n ] - tx[ n - 2U ], ty[ n ] - ty[ n - 2U ] )
+                                  : interp1InnerDerivate( ( tx[ i + 1U ] - tx[ i ] )/( ty[ i + 1U ] - ty[ i ] ),
+                                                          ( tx[ i ] - tx[ i - 1U ] )/( ty[ i ] - ty[ i - 1U ] ) ) );
+        }
+        constexpr real_t interp1LeftSecondDerivate( const real_t * const tx,
+                                                    const real_t * const ty,
+                                                    const size_t n,
+                                                    const size_t i,
+                                                    const real_t xi_delta )
+        {
+            return ( -2.0_re*( interp1FirstDerivate( tx, ty, n, i ) + ( 2.0_re*interp1FirstDerivate( tx, ty, n, i - 1U ) ) )/xi_delta ) +
+                   ( 6.0_re*( ty[ i ] - ty[ i - 1U ] )/( xi_delta*xi_delta ) );
+        }
+        constexpr real_t interp1RightSecondDerivate( const real_t * const tx,
+                                                     const real_t * const ty,
+                                                     const size_t n,
+                                                     const size_t i,
+                                                     const real_t xi_delta )
+        {
+            return ( 2.0_re*( ( 2.0_re*interp1FirstDerivate( tx, ty, n, i ) ) + interp1FirstDerivate( tx, ty, n, i - 1U ) )/xi_delta ) -
+                   ( 6.0_re*( ty[ i ] - ty[ i - 1U ] )/( xi_delta*xi_delta ) );
+        }
+        constexpr real_t interp1CSplineCubic( const real_t x,
+                                              const real_t x1,
+                                              const real_t y1,
+                                              const real_t b,
+                                              const real_t c,
+                                              const real_t d )
+        {
+            return ( y1 - ( b*x1 ) - ( c*( x1*x1 ) ) - ( d*( ( x1*x1 )*x1 ) ) ) + x*( b + x*( c + ( x*d ) ) );
+        }
+        constexpr real_t interp1CSplineCD( const real_t x,
+                                           const real_t x0,
+                                           const real_t x1,
+                                           const real_t y0,
+                                           const real_t y1,
+                                           const real_t inv_x0_x1,
+                                           const real_t c,
+                                           const real_t d )
+        {
+            return interp1CSplineCubic( x, x1, y1,
+                                        ( y0 - y1 - c*( ( x0*x0 ) - ( x1*x1 ) ) - d*( ( ( x0*x0 )*x0 ) - ( ( x1*x1 )*x1 ) ) )*inv_x0_x1,
+                                        c, d );
+        }
+        constexpr real_t interp1CSplineInv( const real_t x,
+                                            const real_t x0,
+                                            const real_t x1,
+                                            const real_t y0,
+                                            const real_t y1,
+                                            const real_t fd2i_xl1,
+                                            const real_t fd2i_x,
+                                            const real_t inv_x0_x1 )
+        {
+            return interp1CSplineCD( x, x0, x1, y0, y1, inv_x0_x1,
+                                     ( ( x0*fd2i_xl1 ) - ( x1*fd2i_x ) )*( 0.5_re*inv_x0_x1 ),
+                                     ( fd2i_x - fd2i_xl1 )*( 0.166666667_re*inv_x0_x1 ) );
+        }
+        constexpr real_t interp1CSplineOn( const real_t * const tx,
+                                           const real_t * const ty,
+                                           const size_t n,
+                                           const real_t x,
+                                           const size_t i )
+        {
+            return ( interp1IsEqual( x, tx[ i + 1U ] ) ) ? ty[ i + 1U ]
+                   : interp1CSplineInv( x, tx[ i ], tx[ i + 1U ], ty[ i ], ty[ i + 1U ],
+                                        interp1LeftSecondDerivate( tx, ty, n - 1U, i + 1U, tx[ i + 1U ] - tx[ i ] ),
+                                        interp1RightSecondDerivate( tx, ty, n - 1U, i + 1U, tx[ i + 1U ] - tx[ i ] ),
+                                        1.0_re/( tx[ i ] - tx[ i + 1U ] ) );
+        }
+        constexpr real_t interp1CSpline( const real_t * const tx,
+                                         const real_t * const ty,
+                                         const size_t n,
+                                         const real_t x )
+        {
+            return interp1CSplineOn( tx, ty, n, x, interp1Segment( tx, n, x ) );
+        }
+
+        template <interp1Method M>
+        constexpr real_t interp1Eval( const real_t * const tx,
+                                      const real_t * const ty,
+                                      const size_t n,
+                                      const real_t x )
+        {
+            return ( INTERP1_NEXT == M ) ? interp1Next( tx, ty, n, x ) :
+                   ( INTERP1_PREVIOUS == M ) ? interp1Previous( tx, ty, n, x ) :
+                   ( INTERP1_NEAREST == M ) ? interp1Nearest( tx, ty, n, x ) :
+                   ( INTERP1_LINEAR == M ) ? interp1Linear( tx, ty, n, x ) :
+                   ( INTERP1_SINE == M ) ? interp1Sine( tx, ty, n, x ) :
+                   ( INTERP1_CUBIC == M ) ? interp1Cubic( tx, ty, n, x ) :
+                   ( INTERP1_HERMITE == M ) ? interp1Hermite( tx, ty, n, x ) :
+                   ( INTERP1_SPLINE == M ) ? interp1Spline( tx, ty, n, x ) :
+                   interp1CSpline( tx, ty, n, x );
+        }
+        /*cstat +MISRAC++2008-5-0-8 +MISRAC++2008-5-0-10 +CERT-INT30-C_a*/
+    }
+    /*! @endcond */
+
+    /**
+    * @brief A 1D interpolation table that holds its own points, with the
+    * method fixed at compile time. It is an aggregate, so the points can be
+    * given with a brace initializer and, when the object is @c constexpr, the
+    * interpolation can be evaluated at compile time, except for
+    * ::INTERP1_SINE. The results are the same as the ones of an interp1
+    * instance with the same table and method.
+    * @tparam N The number of points of the table. At least 4.
+    * @tparam M The interpolation method, see ::interp1Method.
+    */
+    template <size_t N, interp1Method M = INTERP1_LINEAR>
+    struct interp1Table {
+        static_assert( N >= 4U, "The table needs at least 4 points" );
+        static_assert( M < INTERP1_MAX, "Invalid interpolation method" );
+        real_t x[ N ];  /*!< The x points sorted in ascending order.*/
+        real_t y[ N ];  /*!< The y points.*/
+
+        /**
+        * @brief Interpolate input point @a v to determine the value of @a y
+        * at the points @a x using the method @a M. If value is beyond the
+        * endpoints, extrapolation is performed using the same method.
+        * @param[in] v The input point.
+        * @return @c The interpolated or extrapolated @a y value.
+        */
+        template <typename T>
+        constexpr real_t get( const T v ) const noexcept
+        {
+            return impl::interp1Eval<M>( x, y, N, static_cast<real_t>( v ) );
+        }
+    };
+
     /** @}*/
 }
 
@@ -0,0 +1,369 @@
+/*!
+ * @file interpN.hpp
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs-cpp distribution.
+ * @brief 2D and N-D table interpolation classes
+ **/
+
+#ifndef QLIBS_INTERPN
+#define QLIBS_INTERPN
+
+#include <include/qlibs_types.hpp>
+#include <include/interp1.hpp>
+#include <include/ffmath.hpp>
+
+/**
+* @brief The qLibs++ library namespace.
+*/
+namespace qlibs {
+    /** @addtogroup  qinterpn N-D Interpolation
+    * @brief Interpolation on tables of two or more dimensions.
+    *  @{
+    */
+
+    /**
+    * @brief An interpolation object for a table of @a D dimensions. Each axis
+    * is interpolated with the same method of interp1 and the results are
+    * combined as a tensor product, so only the table points next to the
+    * input point are visited.
+    * @note The breakpoints of each axis must be strictly increasing.
+    * @tparam D The number of dimensions of the table.
+    */
+    template <size_t D>
+    class interpN {
+        static_assert( D >= 1U, "The table needs at least one dimension" );
+        private:
+            /*! @cond  */
+            struct axisCache {
+                real_t x;
+                size_t first;
+                size_t count;
+                real_t w[ 4 ];
+            };
+            interp1 axis[ D ];
+            axisCache cache[ D ];
+            size_t stride[ D ];
+            interp1Search saved[ D ];
+            const real_t *table{ nullptr };
+            /*! @endcond  */
+
+            void invalidate( void ) noexcept
+            {
+                for ( size_t d = 0U ; d < D ; ++d ) {
+                    cache[ d ].count = 0U;
+                }
+            }
+        protected:
+            /*! @cond  */
+            interpN()
+            {
+                invalidate();
+            }
+            /*hunt the segments from the previous point during a batch*/
+            void batch( const bool start ) noexcept
+            {
+                for ( size_t d = 0U ; d < D ; ++d ) {
+                    if ( start ) {
+                        saved[ d ] = axis[ d ].search;
+                        if ( !axis[ d ].uniform ) {
+                            axis[ d ].search = INTERP1_SEARCH_HUNT;
+                        }
+                    }
+                    else {
+                        axis[ d ].search = saved[ d ];
+                    }
+                }
+            }
+            /*! @endcond  */
+        public:
+            virtual ~interpN() = default;
+
+            /**
+            * @brief Constructor for the N-D interpolation instance.
+            * @param[in] axes An array with the breakpoints of each axis, sorted
+            * in ascending order.
+            * @param[in] sizes An array with the number of breakpoints of each
+            * axis.
+            * @param[in] zTable The table values, with the first axis varying
+            * fastest: the value at the breakpoints ( i0, i1, ... ) is at
+            * zTable[ i0 + sizes[ 0 ]*( i1 + sizes[ 1 ]*( ... ) ) ].
+            */
+            interpN( const real_t * const axes[ D ],
+                     const size_t sizes[ D ],
+                     const real_t * const zTable )
+            {
+                (void)setData( axes, sizes, zTable );
+            }
+
+            /**
+            * @brief Set the data table for the N-D interpolation instance.
+            * @param[in] axes An array with the breakpoints of each axis, sorted
+            * in ascending order.
+            * @param[in] sizes An array with the number of breakpoints of each
+            * axis, at least 2.
+            * @param[in] zTable The table values, with the first axis varying
+            * fastest.
+            * @return @c true on success otherwise @c false.
+            */
+            bool setData( const real_t * const axes[ D ],
+                          const size_t sizes[ D ],
+                          const real_t * const zTable ) noexcept
+            {
+                bool retValue = ( nullptr != zTable );
+                size_t s = 1U;
+
+                for ( size_t d = 0U ; ( d < D ) && retValue ; ++d ) {
+                    retValue = ( nullptr != axes[ d ] ) && ( sizes[ d ] >= 2U );
+                }
+                if ( retValue ) {
+                    for ( size_t d = 0U ; d < D ; ++d ) {
+                        axis[ d ].xData = axes[ d ];
+                        axis[ d ].dataSize = sizes[ d ];
+                        axis[ d ].updateGrid();
+                        stride[ d ] = s;
+                        s *= sizes[ d ];
+                    }
+                    table = zTable;
+                    invalidate();
+                }
+
+                return retValue;
+            }
+
+            /**
+            * @brief Specify the interpolation method to use on every axis.
+            * ::INTERP1_HERMITE and ::INTERP1_CONSTRAINED_SPLINE are not
+            * supported, because their result along one axis does not come
+            * from the points next to the input point.
+            * @note ::INTERP1_CUBIC and ::INTERP1_SPLINE need at least 4
+            * breakpoints on each axis.
+            * @param[in] m The interpolation method.
+            * @return @c true on success otherwise @c false.
+            */
+            bool setMethod( const interp1Method m ) noexcept
+            {
+                bool retValue = ( INTERP1_HERMITE != m ) && ( INTERP1_CONSTRAINED_SPLINE != m );
+
+                for ( size_t d = 0U ; ( d < D ) && retValue ; ++d ) {
+                    retValue = axis[ d ].setMethod( m );
+                }
+                invalidate();
+
+                return retValue;
+            }
+
+            /**
+            * @brief Specify the method used to find the segment of each axis
+            * that holds the input point. See interp1::setSearch().
+            * @param[in] s The search method.
+            * @return @c true on success otherwise @c false.
+            */
+            bool setSearch( const interp1Search s ) noexcept
+            {
+                bool retValue = true;
+
+                for ( size_t d = 0U ; ( d < D ) && retValue ; ++d ) {
+                    retValue = axis[ d ].setSearch( s );
+                }
+
+                return retValue;
+            }
+
+            /**
+            * @brief Interpolate the input point @a x using the current method.
+            * If the point is beyond the endpoints of an axis, extrapolation is
+            * performed on that axis using the current method.
+            * @note The weights of each axis are kept along with its last input,
+            * so when only some coordinates change between calls, the other
+            * axes are not searched again.
+            * @param[in] x An array with the @a D coordinates of the point.
+            * @return @c The interpolated or extrapolated value.
+            */
+            real_t get( const real_t * const x ) noexcept
+            {
+                real_t y = ffmath::getNan();
+                bool valid = ( nullptr != table ) && ( nullptr != x );
+
+                for ( size_t d = 0U ; ( d < D ) && valid ; ++d ) {
+                    axisCache &c = cache[ d ];
+
+                    /*a NaN fails both comparisons, so it never counts as a hit*/
+                    if ( ( 0U == c.count ) || ffmath::isNan( x[ d ] ) || ffmath::isNan( c.x ) || ( x[ d ] < c.x ) || ( x[ d ] > c.x ) ) {
+                        c.x = x[ d ];
+                        c.count = axis[ d ].weights( x[ d ], c.first, c.w );
+                    }
+                    valid = ( c.count > 0U );
+                }
+                if ( valid ) {
+                    size_t k[ D ] = { 0U };
+                    size_t base = 0U;
+
+                    for ( size_t d = 0U ; d < D ; ++d ) {
+                        base += cache[ d ].first*stride[ d ];
+                    }
+                    y = 0.0_re;
+                    /*sum over all the combinations of the weights, the first
+                    axis runs in the inner loop*/
+                    for ( ;; ) {
+                        const real_t * const z = &table[ base ];
+                        const axisCache &c0 = cache[ 0 ];
+                        real_t w = 1.0_re;
+                        real_t s = 0.0_re;
+                        size_t d = 1U;
+                        size_t offset = 0U;
+
+                        for ( ; d < D ; ++d ) {
+                            w *= cache[ d ].w[ k[ d ] ];
+                            offset += k[ d ]*stride[ d ];
+                        }
+                        for ( size_t i = 0U ; i < c0.count ; ++i ) {
+                            s += c0.w[ i ]*z[ offset + i ];
+                        }
+                        y += w*s;
+                        for ( d = 1U ; d < D ; ++d ) {
+                            if ( ++k[ d ] < cache[ d ].count ) {
+                                break;
+                            }
+                            k[ d ] = 0U;
+                        }
+                        if ( d >= D ) {
+                            break;
+                        }
+                    }
+                }
+
+                return y;
+            }
+
+            /**
+            * @brief Interpolate the input points @a xq using the current
+            * method. The result of each point is the same as the one of
+            * interpN::get( x ).
+            * @note The segment of each axis is hunted from the one of the
+            * previous point, so consecutive points that are close to each
+            * other are found in O(1).
+            * @param[in] xq An array of @a m points, with the @a D coordinates
+            * of each point stored together.
+            * @param[out] yq An array of size @a m to hold the interpolated
+            * values.
+            * @param[in] m The number of points.
+            */
+            void get( const real_t * const xq,
+                      real_t * const yq,
+                      const size_t m ) noexcept
+            {
+                if ( ( nullptr != xq ) && ( nullptr != yq ) ) {
+                    batch( true );
+                    for ( size_t i = 0U ; i < m ; ++i ) {
+                        yq[ i ] = get( &xq[ i*D ] );
+                    }
+                    batch( false );
+                }
+            }
+    };
+
+    /**
+    * @brief A 2D interpolation object for a table of @a sizeY rows and
+    * @a sizeX columns.
+    */
+    class interp2 : public interpN<2U> {
+        public:
+            using interpN<2U>::get;
+
+            /**
+            * @brief Constructor for the 2D interpolation instance.
+            * @param[in] xTable An array of size @a sizeX with the x breakpoints sorted in ascending order.
+            * @param[in] sizeX The number of points in @a xTable.
+            * @param[in] yTable An array of size @a sizeY with the y breakpoints sorted in ascending order.
+            * @param[in] sizeY The number of points in @a yTable.
+            * @param[in] zTable An array of @a sizeY rows and @a sizeX columns,
+            * the value at ( xTable[ i ], yTable[ j ] ) is at zTable[ j*sizeX + i ].
+            */
+            interp2( const real_t * const xTable,
+                     const size_t sizeX,
+                     const real_t * const yTable,
+                     const size_t sizeY,
+                     const real_t * const zTable )
+            {
+                (void)setData( xTable, sizeX, yTable, sizeY, zTable );
+            }
+
+            /**
+            * @brief Constructor for the 2D interpolation instance.
+            * @param[in] xTable An array with the x breakpoints sorted in ascending order.
+            * @param[in] yTable An array with the y breakpoints sorted in ascending order.
+            * @param[in] zTable A matrix with one row for each y breakpoint.
+            */
+            template <size_t sizeX, size_t sizeY>
+            interp2( real_t (&xTable)[ sizeX ],
+                     real_t (&yTable)[ sizeY ],
+                     real_t (&zTable)[ sizeY ][ sizeX ] ) : interp2( xTable, sizeX, yTable, sizeY, &zTable[ 0 ][ 0 ] ) {}
+
+            /**
+            * @brief Set the data table for the 2D interpolation instance.
+            * @param[in] xTable An array of size @a sizeX with the x breakpoints sorted in ascending order.
+            * @param[in] sizeX The number of points in @a xTable, at least 2.
+            * @param[in] yTable An array of size @a sizeY with the y breakpoints sorted in ascending order.
+            * @param[in] sizeY The number of points in @a yTable, at least 2.
+            * @param[in] zTable An array of @a sizeY rows and @a sizeX columns.
+            * @return @c true on success otherwise @c false.
+            */
+            bool setData( const real_t * const xTable,
+                          const size_t sizeX,
+                          const real_t * const yTable,
+                          const size_t sizeY,
+                          const real_t * const zTable ) noexcept
+            {
+                const real_t * const axes[ 2 ] = { xTable, yTable };
+                const size_t sizes[ 2 ] = { sizeX, sizeY };
+
+                return interpN<2U>::setData( axes, sizes, zTable );
+            }
+
+            /**
+            * @brief Interpolate the input point ( @a x, @a y ) using the
+            * current method.
+            * @param[in] x The x coordinate of the point.
+            * @param[in] y The y coordinate of the point.
+            * @return @c The interpolated or extrapolated value.
+            */
+            template <typename T>
+            inline real_t get( const T x,
+                               const T y ) noexcept
+            {
+                const real_t p[ 2 ] = { static_cast<real_t>( x ), static_cast<real_t>( y ) };
+
+                return get( p );
+            }
+
+            /**
+            * @brief Interpolate the input points ( @a xq, @a yq ) using the
+            * current method. See interpN::get( xq, yq, m ).
+            * @param[in] xq An array of size @a m with the x coordinates.
+            * @param[in] yq An array of size @a m with the y coordinates.
+            * @param[out] zq An array of size @a m to hold the interpolated values.
+            * @param[in] m The number of points.
+            */
+            void get( const real_t * const xq,
+                      const real_t * const yq,
+                      real_t * const zq,
+                      const size_t m ) noexcept
+            {
+                if ( ( nullptr != xq ) && ( nullptr != yq ) && ( nullptr != zq ) ) {
+                    batch( true );
+                    for ( size_t i = 0U ; i < m ; ++i ) {
+                        const real_t p[ 2 ] = { xq[ i ], yq[ i ] };
+
+                        zq[ i ] = get( p );
+                    }
+                    batch( false );
+                }
+            }
+    };
+
+    /** @}*/
+}
+
+
+#endif /*QLIBS_INTERPN*/
@@ -433,6 +433,8 @@ namespace qlibs {
     class discreteSystem : public ltisys {
         private:
             real_t *xd{ nullptr };
+            real_t *xr{ nullptr };
+            size_t xHead{ 0U };
             real_t update( const real_t u ) override;
         public:
             virtual ~discreteSystem() {}
@@ -606,6 +608,23 @@ namespace qlibs {
             */
             bool setInitStates( const real_t *xi = nullptr ) override;
 
+            /**
+            * @brief Keep the states of the system in a mirrored circular buffer.
+            * A new state is then stored in O(1) instead of shifting all the
+            * states on every invocation of discreteSystem::excite(). The output
+            * of the system is the same.
+            * @pre System should be previously initialized by using the
+            * discreteSystem::setup() method
+            * @param[in] buffer An array of 2*max(na,nb) elements. It can be the
+            * same array of the states @a x given to setup() if it has that size.
+            * The current states are moved to the buffer. To go back to the
+            * states array @a x pass @c nullptr.
+            * @note While the buffer is in use, the states array @a x is not
+            * updated.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setRingBuffer( real_t *buffer ) noexcept;
+
             /**
             * @brief Evaluate the discrete FIR filter by updating the delay lines of
             * @a x inside the window @a w of size @a wsize with the coefficients given
@@ -625,6 +644,30 @@ namespace qlibs {
                                      const size_t wsize,
                                      const real_t x,
                                      const real_t * const c = nullptr );
+
+            /**
+            * @brief Evaluate the discrete FIR filter keeping the delay lines of
+            * @a x in a mirrored circular buffer. The window is stored twice in
+            * @a w, so the new sample is inserted in O(1) and the window with the
+            * newest sample first is always the contiguous array starting at
+            * @c w[head]. The result is the same of the shifting version.
+            * @param[in,out] w An array of 2*@a wsize elements that holds the
+            * mirrored window with the delay lines of @a x.
+            * @param[in] wsize The number of elements of the window.
+            * @param[in,out] head The position of the newest sample in @a w. It
+            * should be set to zero along with the initial window.
+            * @param[in] x A sample of the input signal.
+            * @param[in] c An array of @a wsize elements with the coefficients of the
+            * FIR filter. Coefficients should be given in descending powers of the
+            * nth-degree polynomial. To ignore pass @c nullptr.
+            * @return If @a c is provided, returns the evaluation of the FIR filter.
+            * otherwise return the sum of the updated window.
+            */
+            static real_t updateFIR( real_t *w,
+                                     const size_t wsize,
+                                     size_t &head,
+                                     const real_t x,
+                                     const real_t * const c = nullptr );
     };
 
     /**
@@ -37,10 +37,19 @@
 * @brief The qLibs++ library namespace.
 */
 namespace qlibs {
+#if defined( QLIBS_USE_DOUBLE )
     /**
     * @brief A type to instantiate a real variable double-precision of 64-bits IEEE 754.
+    * @note Selected by defining the @c QLIBS_USE_DOUBLE macro.
+    */
+    using real_t = double;
+#else
+    /**
+    * @brief A type to instantiate a real variable single-precision of 32-bits IEEE 754.
+    * @note Define the @c QLIBS_USE_DOUBLE macro to use double-precision instead.
     */
     using real_t = float;
+#endif
 
     /*! @cond */
     /*cstat -CERT-FLP36-C -CERT-FLP34-C*/
@@ -55,8 +64,13 @@ namespace qlibs {
     /*cstat +CERT-FLP36-C +CERT-FLP34-C*/
 
     /*cstat -MISRAC++2008-0-1-4_b*/
+#if defined( QLIBS_USE_DOUBLE )
+    constexpr real_t REAL_MAX = DBL_MAX;        // max value
+    constexpr real_t REAL_MIN = DBL_MIN;        // min normalized positive value
+#else
     constexpr real_t REAL_MAX = FLT_MAX;        // max value
     constexpr real_t REAL_MIN = FLT_MIN;        // min normalized positive value
+#endif
     /*cstat +MISRAC++2008-0-1-4_b*/
 
     class nonCopyable {
@@ -64,6 +64,22 @@ namespace qlibs {
             */
             virtual real_t smooth( const real_t x ) = 0;
 
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            * @note The outputs are the same of calling smooth() for every
+            * sample of the block.
+            */
+            virtual void smooth( const real_t * const in,
+                                 real_t * const out,
+                                 const size_t n );
+
             /**
             * @brief Reset the smoother filter.
             * @return @c true on success, otherwise return false.
@@ -102,6 +118,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -137,6 +167,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -147,7 +191,9 @@ namespace qlibs {
         protected:
             /*! @cond  */
             real_t *w{ nullptr };
+            real_t *wr{ nullptr };
             size_t wsize{ 0U };
+            size_t head{ 0U };
             /*! @endcond  */
         public:
             virtual ~smootherMWM1() {}
@@ -172,6 +218,20 @@ namespace qlibs {
                 return setup( window, windowSize );
             }
 
+            /**
+            * @brief Keep the samples of the window in a mirrored circular
+            * buffer. Every new sample is then stored in O(1) instead of shifting
+            * the whole window, which pays off for long windows. The outputs
+            * are the same.
+            * @pre Instance must be previously initialized
+            * @param[in] buffer An array of 2*@a w_size elements. It can be the same
+            * @a window given to setup() if it has that size. To go back to
+            * shifting the window pass @c nullptr.
+            * @note Calling setup() again also goes back to shifting the window.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setRingBuffer( real_t *buffer );
+
             /**
             * @brief Perform the smooth operation recursively for the input signal @a x.
             * @pre Instance must be previously initialized
@@ -179,6 +239,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -220,6 +294,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -230,9 +318,11 @@ namespace qlibs {
         protected:
             /*! @cond  */
             real_t *w{ nullptr };
+            real_t *wr{ nullptr };
             real_t m{ 0.0_re };
             real_t alpha{ 0.8_re };
             size_t wsize{ 0U };
+            size_t head{ 0U };
             /*! @endcond  */
         public:
             virtual ~smootherMOR1() {}
@@ -261,6 +351,20 @@ namespace qlibs {
                 return setup( window, windowSize, a );
             }
 
+            /**
+            * @brief Keep the samples of the window in a mirrored circular
+            * buffer. Every new sample is then stored in O(1) instead of shifting
+            * the whole window, which pays off for long windows. The outputs
+            * are the same.
+            * @pre Instance must be previously initialized
+            * @param[in] buffer An array of 2*@a w_size elements. It can be the same
+            * @a window given to setup() if it has that size. To go back to
+            * shifting the window pass @c nullptr.
+            * @note Calling setup() again also goes back to shifting the window.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setRingBuffer( real_t *buffer );
+
             /**
             * @brief Perform the smooth operation recursively for the input signal @a x.
             * @pre Instance must be previously initialized
@@ -268,6 +372,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -315,6 +433,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -324,8 +456,10 @@ namespace qlibs {
         protected:
             /*! @cond  */
             real_t *w{ nullptr };
+            real_t *wr{ nullptr };
             real_t *k{ nullptr };
             size_t wsize;
+            size_t head{ 0U };
             /*! @endcond  */
         public:
             virtual ~smootherGMWF() {}
@@ -364,6 +498,20 @@ namespace qlibs {
                 return setup( sg, c, window, kernel, windowAndKernelSize );
             }
 
+            /**
+            * @brief Keep the samples of the window in a mirrored circular
+            * buffer. Every new sample is then stored in O(1) instead of shifting
+            * the whole window, which pays off for long windows. The outputs
+            * are the same.
+            * @pre Instance must be previously initialized
+            * @param[in] buffer An array of 2*@a wk_size elements. It can be the same
+            * @a window given to setup() if it has that size. To go back to
+            * shifting the window pass @c nullptr.
+            * @note Calling setup() again also goes back to shifting the window.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setRingBuffer( real_t *buffer );
+
             /**
             * @brief Perform the smooth operation recursively for the input signal @a x.
             * @pre Instance must be previously initialized
@@ -371,6 +519,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -400,6 +562,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -437,6 +613,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a n samples of the input signal.
+            * @param[out] out An array where the @a n smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] n The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t n ) override;
     };
 
     /**
@@ -472,6 +662,20 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            /**
+            * @brief Perform the smooth operation over a block of samples of the
+            * input signal.
+            * @pre Instance must be previously initialized
+            * @param[in] in An array with @a len samples of the input signal.
+            * @param[out] out An array where the @a len smoothed outputs will be
+            * stored. It can be the same as @a in, otherwise both arrays should
+            * not overlap.
+            * @param[in] len The number of samples in the block.
+            */
+            void smooth( const real_t * const in,
+                         real_t * const out,
+                         const size_t len ) override;
     };
 
     /**
@@ -485,7 +689,9 @@ namespace qlibs {
             real_t *w{ nullptr };
             real_t *w_1{ nullptr };
             real_t *xx{ nullptr };
+            real_t *xr{ nullptr };
             size_t n{ 0U };
+            size_t head{ 0U };
             /*! @endcond  */
         public:
             virtual ~smootherALNF() {}
@@ -542,6 +748,20 @@ namespace qlibs {
                 return setup( a, 0.0F, windowSize, window, weights, nullptr);
             }
 
+            /**
+            * @brief Keep the samples of the window in a mirrored circular
+            * buffer. Every new sample is then stored in O(1) instead of shifting
+            * the whole window, which pays off for long windows. The outputs
+            * are the same.
+            * @pre Instance must be previously initialized
+            * @param[in] buffer An array of 2*@a wsize elements. It can be the same
+            * @a window given to setup() if it has that size. To go back to
+            * shifting the window pass @c nullptr.
+            * @note Calling setup() again also goes back to shifting the window.
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setRingBuffer( real_t *buffer );
+
             /**
             * @brief Perform the smooth operation recursively for the input signal @a x.
             * @pre Instance must be previously initialized
@@ -549,6 +769,373 @@ namespace qlibs {
             * @return The smoothed output.
             */
             real_t smooth( const real_t x ) override;
+
+            using smoother::smooth;
+    };
+
+    /**
+    * @brief The base abstract class for the banks of smoothing filters.
+    * @details A bank runs the same filter over many independent channels. The
+    * state of every channel is kept in structure-of-arrays form inside a
+    * user supplied area, so one call to smooth() updates all the channels
+    * using SIMD instructions when available. The output of every channel is
+    * the same of its scalar counterpart.
+    */
+    class smootherBank : private nonCopyable {
+        protected:
+            /*! @cond  */
+            bool init{ true };
+            bool isSetup{ false };
+            size_t nChannels{ 0U };
+            /*! @endcond  */
+        public:
+            virtual ~smootherBank() {}
+
+            /**
+            * @brief Check if the bank has been initialized using setup().
+            * @return @c true if the bank has been initialized, otherwise
+            * return @c false.
+            */
+            bool isInitialized( void ) const
+            {
+                return isSetup;
+            }
+
+            /**
+            * @brief Check if the bank has been initialized using setup().
+            * @return @c true if the bank has been initialized, otherwise
+            * return @c false.
+            */
+            explicit operator bool() const noexcept
+            {
+                return isInitialized();
+            }
+
+            /**
+            * @brief Get the number of channels of the bank.
+            * @return The number of channels.
+            */
+            size_t getNumberOfChannels( void ) const
+            {
+                return nChannels;
+            }
+
+            /**
+            * @brief Perform the smooth operation for one sample of every channel.
+            * @pre Instance must be previously initialized
+            * @param[in] x An array with one sample of the input signal for
+            * every channel.
+            * @param[out] y An array where the smoothed output of every channel
+            * will be stored. It can be the same as @a x.
+            */
+            virtual void smooth( const real_t * const x,
+                                 real_t * const y ) = 0;
+
+            /**
+            * @brief Reset all the channels of the bank.
+            * @return @c true on success, otherwise return false.
+            */
+            inline bool reset( void )
+            {
+                init = true;
+                return true;
+            }
+    };
+
+    /**
+    * @brief The area to hold the state of a bank of smoothing filters.
+    * @tparam bank The bank type, e.g. smootherLPF1Bank.
+    * @tparam nChannels The number of channels.
+    */
+    template <class bank, size_t nChannels>
+    using smootherBankArea = real_t[ bank::AREA_PER_CHANNEL*nChannels ];
+
+    /**
+    * @brief A bank of 1st order Low-Pass Filters
+    * @see smootherLPF1
+    */
+    class smootherLPF1Bank : public smootherBank {
+        protected:
+            /*! @cond  */
+            real_t *alpha{ nullptr };
+            real_t *y1{ nullptr };
+            /*! @endcond  */
+        public:
+            /** @brief Number of values of the area used by every channel*/
+            static constexpr size_t AREA_PER_CHANNEL = 2U;
+            virtual ~smootherLPF1Bank() {}
+
+            /**
+            * @brief Setup an initialize the bank of 1st order Low-Pass Filters.
+            * @param[in] area An array of @c AREA_PER_CHANNEL*n elements to hold
+            * the state of the channels.
+            * @param[in] n The number of channels.
+            * @param[in] a The filter adjustment parameter for all the channels.
+            * A value between  [ 0 < @a alpha < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setup( real_t *area,
+                        const size_t n,
+                        const real_t a = 0.9_re );
+
+            /**
+            * @brief Setup an initialize the bank of 1st order Low-Pass Filters.
+            * @param[in] area The area to hold the state of the channels.
+            * See smootherBankArea.
+            * @param[in] a The filter adjustment parameter for all the channels.
+            * A value between  [ 0 < @a alpha < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            template <size_t areaSize>
+            bool setup( real_t (&area)[ areaSize ],
+                        const real_t a = 0.9_re )
+            {
+                static_assert( 0U == ( areaSize % AREA_PER_CHANNEL ), "Wrong area size" );
+                return setup( area, areaSize/AREA_PER_CHANNEL, a );
+            }
+
+            /**
+            * @brief Change the parameter of a single channel.
+            * @pre Instance must be previously initialized
+            * @param[in] channel The channel index.
+            * @param[in] a The filter adjustment parameter.
+            * A value between  [ 0 < @a alpha < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setChannel( const size_t channel,
+                             const real_t a );
+
+            /**
+            * @brief Perform the smooth operation for one sample of every channel.
+            * @pre Instance must be previously initialized
+            * @param[in] x An array with one sample of the input signal for
+            * every channel.
+            * @param[out] y An array where the smoothed output of every channel
+            * will be stored. It can be the same as @a x.
+            */
+            void smooth( const real_t * const x,
+                         real_t * const y ) override;
+    };
+
+    /**
+    * @brief A bank of 2nd order Low-Pass Filters
+    * @see smootherLPF2
+    */
+    class smootherLPF2Bank : public smootherBank {
+        protected:
+            /*! @cond  */
+            real_t *k{ nullptr };
+            real_t *a1{ nullptr };
+            real_t *a2{ nullptr };
+            real_t *b1{ nullptr };
+            real_t *x1{ nullptr };
+            real_t *x2{ nullptr };
+            real_t *y1{ nullptr };
+            real_t *y2{ nullptr };
+            /*! @endcond  */
+        public:
+            /** @brief Number of values of the area used by every channel*/
+            static constexpr size_t AREA_PER_CHANNEL = 8U;
+            virtual ~smootherLPF2Bank() {}
+
+            /**
+            * @brief Setup an initialize the bank of 2nd order Low-Pass Filters.
+            * @param[in] area An array of @c AREA_PER_CHANNEL*n elements to hold
+            * the state of the channels.
+            * @param[in] n The number of channels.
+            * @param[in] a The filter adjustment parameter for all the channels.
+            * A value between  [ 0 < @a a < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setup( real_t *area,
+                        const size_t n,
+                        const real_t a = 0.9_re );
+
+            /**
+            * @brief Setup an initialize the bank of 2nd order Low-Pass Filters.
+            * @param[in] area The area to hold the state of the channels.
+            * See smootherBankArea.
+            * @param[in] a The filter adjustment parameter for all the channels.
+            * A value between  [ 0 < @a a < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            template <size_t areaSize>
+            bool setup( real_t (&area)[ areaSize ],
+                        const real_t a = 0.9_re )
+            {
+                static_assert( 0U == ( areaSize % AREA_PER_CHANNEL ), "Wrong area size" );
+                return setup( area, areaSize/AREA_PER_CHANNEL, a );
+            }
+
+            /**
+            * @brief Change the parameter of a single channel.
+            * @pre Instance must be previously initialized
+            * @param[in] channel The channel index.
+            * @param[in] a The filter adjustment parameter.
+            * A value between  [ 0 < @a a < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setChannel( const size_t channel,
+                             const real_t a );
+
+            /**
+            * @brief Perform the smooth operation for one sample of every channel.
+            * @pre Instance must be previously initialized
+            * @param[in] x An array with one sample of the input signal for
+            * every channel.
+            * @param[out] y An array where the smoothed output of every channel
+            * will be stored. It can be the same as @a x.
+            */
+            void smooth( const real_t * const x,
+                         real_t * const y ) override;
+    };
+
+    /**
+    * @brief A bank of Exponential weighting filters
+    * @see smootherEXPW
+    */
+    class smootherEXPWBank : public smootherBank {
+        protected:
+            /*! @cond  */
+            real_t *lambda{ nullptr };
+            real_t *m{ nullptr };
+            real_t *w{ nullptr };
+            /*! @endcond  */
+        public:
+            /** @brief Number of values of the area used by every channel*/
+            static constexpr size_t AREA_PER_CHANNEL = 3U;
+            virtual ~smootherEXPWBank() {}
+
+            /**
+            * @brief Setup an initialize the bank of Exponential weighting filters.
+            * @param[in] area An array of @c AREA_PER_CHANNEL*n elements to hold
+            * the state of the channels.
+            * @param[in] n The number of channels.
+            * @param[in] lam Forgetting factor for all the channels, a value
+            * between [ 0 < @a lam < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setup( real_t *area,
+                        const size_t n,
+                        const real_t lam = 0.8_re );
+
+            /**
+            * @brief Setup an initialize the bank of Exponential weighting filters.
+            * @param[in] area The area to hold the state of the channels.
+            * See smootherBankArea.
+            * @param[in] lam Forgetting factor for all the channels, a value
+            * between [ 0 < @a lam < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            template <size_t areaSize>
+            bool setup( real_t (&area)[ areaSize ],
+                        const real_t lam = 0.8_re )
+            {
+                static_assert( 0U == ( areaSize % AREA_PER_CHANNEL ), "Wrong area size" );
+                return setup( area, areaSize/AREA_PER_CHANNEL, lam );
+            }
+
+            /**
+            * @brief Change the parameter of a single channel.
+            * @pre Instance must be previously initialized
+            * @param[in] channel The channel index.
+            * @param[in] lam Forgetting factor, a value between [ 0 < @a lam < 1 ]
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setChannel( const size_t channel,
+                             const real_t lam );
+
+            /**
+            * @brief Perform the smooth operation for one sample of every channel.
+            * @pre Instance must be previously initialized
+            * @param[in] x An array with one sample of the input signal for
+            * every channel.
+            * @param[out] y An array where the smoothed output of every channel
+            * will be stored. It can be the same as @a x.
+            */
+            void smooth( const real_t * const x,
+                         real_t * const y ) override;
+    };
+
+    /**
+    * @brief A bank of Double exponential smoothing filters (Holt’s Method)
+    * @see smootherDESF
+    */
+    class smootherDESFBank : public smootherBank {
+        protected:
+            /*! @cond  */
+            real_t *alpha{ nullptr };
+            real_t *beta{ nullptr };
+            real_t *n{ nullptr };
+            real_t *lt{ nullptr };
+            real_t *bt{ nullptr };
+            /*! @endcond  */
+        public:
+            /** @brief Number of values of the area used by every channel*/
+            static constexpr size_t AREA_PER_CHANNEL = 5U;
+            virtual ~smootherDESFBank() {}
+
+            /**
+            * @brief Setup an initialize the bank of Double exponential smoothing
+            * filters.
+            * @param[in] area An array of @c AREA_PER_CHANNEL*nCh elements to hold
+            * the state of the channels.
+            * @param[in] nCh The number of channels.
+            * @param[in] a Weight for the level [ 0 < @a a < 1 ]
+            * @param[in] b Weight for the trend [ 0 < @a b < 1 ]
+            * @param[in] nS Number of steps for the forecast
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setup( real_t *area,
+                        const size_t nCh,
+                        const real_t a,
+                        const real_t b,
+                        const size_t nS );
+
+            /**
+            * @brief Setup an initialize the bank of Double exponential smoothing
+            * filters.
+            * @param[in] area The area to hold the state of the channels.
+            * See smootherBankArea.
+            * @param[in] a Weight for the level [ 0 < @a a < 1 ]
+            * @param[in] b Weight for the trend [ 0 < @a b < 1 ]
+            * @param[in] nS Number of steps for the forecast
+            * @return @c true on success, otherwise return @c false.
+            */
+            template <size_t areaSize>
+            bool setup( real_t (&area)[ areaSize ],
+                        const real_t a,
+                        const real_t b,
+                        const size_t nS )
+            {
+                static_assert( 0U == ( areaSize % AREA_PER_CHANNEL ), "Wrong area size" );
+                return setup( area, areaSize/AREA_PER_CHANNEL, a, b, nS );
+            }
+
+            /**
+            * @brief Change the parameters of a single channel.
+            * @pre Instance must be previously initialized
+            * @param[in] channel The channel index.
+            * @param[in] a Weight for the level [ 0 < @a a < 1 ]
+            * @param[in] b Weight for the trend [ 0 < @a b < 1 ]
+            * @param[in] nS Number of steps for the forecast
+            * @return @c true on success, otherwise return @c false.
+            */
+            bool setChannel( const size_t channel,
+                             const real_t a,
+                             const real_t b,
+                             const size_t nS );
+
+            /**
+            * @brief Perform the smooth operation for one sample of every channel.
+            * @pre Instance must be previously initialized
+            * @param[in] x An array with one sample of the input signal for
+            * every channel.
+            * @param[out] y An array where the smoothed output of every channel
+            * will be stored. It can be the same as @a x.
+            */
+            void smooth( const real_t * const x,
+                         real_t * const y ) override;
     };
 
     /** @}*/
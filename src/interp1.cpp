@@ -3,6 +3,316 @@
 
 using namespace qlibs;
 
+namespace {
+    /*the table point v comes before x, the repeated points are before x
+    only when lower is false*/
+    inline bool isBefore( const real_t v,
+                          const real_t x,
+                          const bool lower )
+    {
+        return ( lower ) ? ( v < x ) : ( v <= x );
+    }
+}
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __aarch64__ ) || defined( __ARM_NEON ) )
+    #define INTERP1_GATHER_SIMD
+#endif
+
+/*! @cond  */
+namespace {
+    #if defined( INTERP1_GATHER_SIMD )
+        /*Each lane locates its own segment with a branchless binary search,
+        so all the lanes take the same number of steps, and then gathers the
+        points of the segment. The values are computed with the same
+        expressions of the scalar methods, so the results are bitwise
+        identical*/
+        #define INTERP1_INLINE   inline __attribute__( ( always_inline ) )
+        /*keep the same rounding of the scalar methods on targets with FMA*/
+        #if defined( __clang__ )
+            #define INTERP1_KERNEL( isa )    __attribute__( ( target( isa ) ) )
+            #define INTERP1_KERNEL_BASE      /*EMPTY MACRO*/
+        #else
+            #define INTERP1_KERNEL( isa )    __attribute__( ( target( isa ), optimize( "fp-contract=off" ) ) )
+            #define INTERP1_KERNEL_BASE      __attribute__( ( optimize( "fp-contract=off" ) ) )
+        #endif
+
+        /*the integer type with the size of real_t, for the indexes and masks*/
+        template<size_t S>
+        struct laneIndex;
+        template<>
+        struct laneIndex<4U> {
+            typedef int32_t type;
+        };
+        template<>
+        struct laneIndex<8U> {
+            typedef int64_t type;
+        };
+        typedef laneIndex<sizeof(real_t)>::type index_t;
+
+        template<typename T, typename I>
+        INTERP1_INLINE void vSelect( T &r, const I &mask, const T &a, const T &b )
+        {
+            r = reinterpret_cast<T>( ( reinterpret_cast<I>( a ) & mask ) | ( reinterpret_cast<I>( b ) & ~mask ) );
+        }
+        template<typename V, typename I>
+        INTERP1_INLINE void vGather( V &r, const real_t * const t, const I &j )
+        {
+            V v = V{};
+
+            for ( size_t k = 0U ; k < ( sizeof(V)/sizeof(real_t) ) ; ++k ) {
+                v[ k ] = t[ j[ k ] ];
+            }
+            r = v;
+        }
+        /*same index of locate(): the first point that is not before x*/
+        template<typename V, typename I>
+        INTERP1_INLINE void vLocate( I &j,
+                                     const real_t * const tx,
+                                     const size_t n,
+                                     const V &x,
+                                     const bool lower )
+        {
+            I base = I{};
+            size_t len = n;
+            V t;
+
+            while ( len > 1U ) {
+                const size_t half = len/2U;
+
+                vGather<V, I>( t, tx, base + static_cast<index_t>( half ) );
+                base += ( ( lower ) ? ( t < x ) : ( t <= x ) ) & static_cast<index_t>( half );
+                len -= half;
+            }
+            vGather<V, I>( t, tx, base );
+            /*the masks are -1 in the lanes where the comparison holds*/
+            j = base - ( ( lower ) ? ( t < x ) : ( t <= x ) );
+        }
+
+        struct linearGather {
+            template<typename V, typename I>
+            static INTERP1_INLINE void apply( V &y, const V &x, const real_t * const tx, const real_t * const ty, const size_t n )
+            {
+                const index_t last = static_cast<index_t>( n - 1U );
+                const I above = ( x > tx[ n - 1U ] );
+                I j, i;
+                V x0, x1, y0, y1;
+
+                vLocate<V, I>( j, tx, n, x, true );
+                i = j + ( j > 0 );
+                vSelect<I, I>( i, ( x < tx[ 0 ] ), I{}, i );
+                vSelect<I, I>( i, above, I{} + ( last - 1 ), i );
+                vGather<V, I>( x0, tx, i );
+                vGather<V, I>( x1, tx, i + 1 );
+                vGather<V, I>( y0, ty, i );
+                vGather<V, I>( y1, ty, i + 1 );
+                vSelect<V, I>( y, above,
+                               y1 + ( ( y0 - y1 )/( x0 - x1 ) )*( x - x1 ),
+                               y0 + ( ( y1 - y0 )/( x1 - x0 ) )*( x - x0 ) );
+            }
+        };
+        struct previousGather {
+            template<typename V, typename I>
+            static INTERP1_INLINE void apply( V &y, const V &x, const real_t * const tx, const real_t * const ty, const size_t n )
+            {
+                I j;
+
+                vLocate<V, I>( j, tx, n, x, false );
+                vSelect<I, I>( j, ( x > tx[ 0 ] ), j - 1, I{} );
+                vGather<V, I>( y, ty, j );
+            }
+        };
+        struct nextGather {
+            template<typename V, typename I>
+            static INTERP1_INLINE void apply( V &y, const V &x, const real_t * const tx, const real_t * const ty, const size_t n )
+            {
+                I j;
+
+                vLocate<V, I>( j, tx, n, x, false );
+                vSelect<I, I>( j, ( j > 1 ), j, I{} + 1 );
+                vSelect<I, I>( j, ( x < tx[ n - 1U ] ), j, I{} + static_cast<index_t>( n - 1U ) );
+                vGather<V, I>( y, ty, j );
+            }
+        };
+        struct nearestGather {
+            template<typename V, typename I>
+            static INTERP1_INLINE void apply( V &y, const V &x, const real_t * const tx, const real_t * const ty, const size_t n )
+            {
+                const index_t last = static_cast<index_t>( n - 1U );
+                I j, i, far;
+                V a, b, da, db;
+
+                vLocate<V, I>( j, tx, n, x, false );
+                vSelect<I, I>( i, ( j < last ), j, I{} + last );
+                vGather<V, I>( a, tx, i );
+                vGather<V, I>( b, tx, j + ( j > 0 ) );
+                da = x - a;
+                db = x - b;
+                vSelect<V, I>( da, ( da < 0 ), -da, da );
+                vSelect<V, I>( db, ( db < 0 ), -db, db );
+                far = ( j > 0 ) & ( da > db ) & ( j <= last );
+                vSelect<I, I>( i, far, j - 1, i );
+                for ( size_t k = 0U ; k < ( sizeof(V)/sizeof(real_t) ) ; ++k ) {
+                    if ( ( 0 == far[ k ] ) && ( j[ k ] <= last ) ) {
+                        /*on a tie, the last of the repeated points*/
+                        while ( ( i[ k ] < last ) && !( tx[ i[ k ] + 1 ] > tx[ i[ k ] ] ) ) {
+                            ++i[ k ];
+                        }
+                    }
+                }
+                vGather<V, I>( y, ty, i );
+            }
+        };
+
+        /*B is the vector width in bytes*/
+        template<typename Op, size_t B>
+        INTERP1_INLINE size_t gatherLoop( const real_t * const tx,
+                                          const real_t * const ty,
+                                          const size_t n,
+                                          const real_t * const xq,
+                                          real_t * const yq,
+                                          const size_t count )
+        {
+            constexpr size_t N = B/sizeof(real_t);
+            typedef real_t V __attribute__( ( vector_size( B ) ) );
+            typedef index_t I __attribute__( ( vector_size( B ) ) );
+            size_t i = 0U;
+
+            for ( ; ( i + N ) <= count ; i += N ) {
+                V x, y;
+
+                (void)memcpy( &x, &xq[ i ], sizeof(V) );
+                Op::template apply<V, I>( y, x, tx, ty, n );
+                (void)memcpy( &yq[ i ], &y, sizeof(V) );
+            }
+
+            return i;
+        }
+
+        #if defined( __x86_64__ )
+            enum class gatherISA { SSE2, AVX2, AVX512 };
+
+            gatherISA gatherLevel( void ) noexcept
+            {
+                static const gatherISA level = ( __builtin_cpu_init(),
+                                                 ( 0 != __builtin_cpu_supports( "avx512f" ) ) ? gatherISA::AVX512 :
+                                                 ( 0 != __builtin_cpu_supports( "avx2" ) ) ? gatherISA::AVX2 : gatherISA::SSE2 );
+                return level;
+            }
+            template<typename Op>
+            INTERP1_KERNEL( "avx512f" ) size_t gatherAVX512( const real_t * const tx, const real_t * const ty, const size_t n,
+                                                             const real_t * const xq, real_t * const yq, const size_t count )
+            {
+                return gatherLoop<Op, 64U>( tx, ty, n, xq, yq, count );
+            }
+            template<typename Op>
+            INTERP1_KERNEL( "avx2" ) size_t gatherAVX2( const real_t * const tx, const real_t * const ty, const size_t n,
+                                                        const real_t * const xq, real_t * const yq, const size_t count )
+            {
+                return gatherLoop<Op, 32U>( tx, ty, n, xq, yq, count );
+            }
+            template<typename Op>
+            INTERP1_KERNEL_BASE size_t gatherSSE2( const real_t * const tx, const real_t * const ty, const size_t n,
+                                                   const real_t * const xq, real_t * const yq, const size_t count )
+            {
+                return gatherLoop<Op, 16U>( tx, ty, n, xq, yq, count );
+            }
+            template<typename Op>
+            size_t gatherRun( const real_t * const tx,
+                              const real_t * const ty,
+                              const size_t n,
+                              const real_t * const xq,
+                              real_t * const yq,
+                              const size_t count ) noexcept
+            {
+                size_t done;
+
+                switch ( gatherLevel() ) {
+                    case gatherISA::AVX512:
+                        done = gatherAVX512<Op>( tx, ty, n, xq, yq, count );
+                        break;
+                    case gatherISA::AVX2:
+                        done = gatherAVX2<Op>( tx, ty, n, xq, yq, count );
+                        break;
+                    default:
+                        done = gatherSSE2<Op>( tx, ty, n, xq, yq, count );
+                        break;
+                }
+
+                return done;
+            }
+        #else
+            template<typename Op>
+            INTERP1_KERNEL_BASE size_t gatherRun( const real_t * const tx,
+                                                  const real_t * const ty,
+                                                  const size_t n,
+                                                  const real_t * const xq,
+                                                  real_t * const yq,
+                                                  const size_t count ) noexcept
+            {
+                return gatherLoop<Op, 16U>( tx, ty, n, xq, yq, count );
+            }
+        #endif
+        #undef INTERP1_INLINE
+        #undef INTERP1_KERNEL
+        #undef INTERP1_KERNEL_BASE
+
+        /*the gather path of the batch for unsorted input, it returns the
+        number of points it has interpolated*/
+        size_t gatherBatch( const interp1Method m,
+                            const real_t * const tx,
+                            const real_t * const ty,
+                            const size_t n,
+                            const real_t * const xq,
+                            real_t * const yq,
+                            const size_t count ) noexcept
+        {
+            size_t done = 0U;
+
+            /*the indexes of the lanes must fit in index_t*/
+            if ( n <= static_cast<size_t>( 0x7FFFFFFF ) ) {
+                switch ( m ) {
+                    case INTERP1_LINEAR:
+                        done = gatherRun<linearGather>( tx, ty, n, xq, yq, count );
+                        break;
+                    case INTERP1_PREVIOUS:
+                        done = gatherRun<previousGather>( tx, ty, n, xq, yq, count );
+                        break;
+                    case INTERP1_NEXT:
+                        done = gatherRun<nextGather>( tx, ty, n, xq, yq, count );
+                        break;
+                    case INTERP1_NEAREST:
+                        done = gatherRun<nearestGather>( tx, ty, n, xq, yq, count );
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            return done;
+        }
+    #else
+        /*the remaining points are interpolated one at a time*/
+        size_t gatherBatch( const interp1Method m,
+                            const real_t * const tx,
+                            const real_t * const ty,
+                            const size_t n,
+                            const real_t * const xq,
+                            real_t * const yq,
+                            const size_t count ) noexcept
+        {
+            Q_UNUSED( m );
+            Q_UNUSED( tx );
+            Q_UNUSED( ty );
+            Q_UNUSED( n );
+            Q_UNUSED( xq );
+            Q_UNUSED( yq );
+            Q_UNUSED( count );
+            return 0U;
+        }
+    #endif
+}
+/*! @endcond  */
+
 /*cstat -CERT-INT30-C_a*/
 /*============================================================================*/
 bool interp1::setMethod( const interp1Method m ) noexcept
@@ -22,95 +332,590 @@ bool interp1::setMethod( const interp1Method m ) noexcept
 
     if ( m < INTERP1_MAX ) {
         method = im[ m ];
+        current = m;
+        coeff = nullptr;
         retValue = true;
     }
 
     return retValue;
 }
 /*============================================================================*/
-real_t interp1::next( const real_t x,
-                      const real_t * const tx,
-                      const real_t * const ty,
-                      const size_t tableSize )
+bool interp1::prepare( real_t * const buffer,
+                       const size_t bufferSize ) noexcept
 {
-    real_t y = ffmath::getNan();
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
+    bool retValue = false;
 
-    if ( ( tableSize >= 2U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
-        size_t nearestIndex = tableSize - 1U;
+    /*drop the previous coefficients*/
+    (void)setMethod( current );
+    if ( ( tableSize >= 4U ) && ( nullptr != tx ) && ( nullptr != ty ) &&
+         ( nullptr != buffer ) && ( bufferSize >= ( 4U*( tableSize - 1U ) ) ) ) {
+        const size_t n = tableSize - 1U;
+
+        switch ( current ) {
+            case INTERP1_HERMITE:
+                {
+                    /*the scale keeps the products of the weights in range*/
+                    const real_t scale = 4.0_re/( tx[ n ] - tx[ 0 ] );
+
+                    for ( size_t i = 0U ; i < tableSize ; ++i ) {
+                        real_t w = 1.0_re;
 
-        for ( size_t i = 0U ; i < tableSize - 1U ; ++i ) {
-            if ( x < tx[ i + 1U ] ) {
-                nearestIndex = i;
+                        for ( size_t j = 0U ; j < tableSize ; ++j ) {
+                            if ( i != j ) {
+                                w *= scale*( tx[ i ] - tx[ j ] );
+                            }
+                        }
+                        buffer[ i ] = 1.0_re/w;
+                    }
+                    method = &interp1::preparedHermite;
+                    coeff = buffer;
+                }
+                break;
+            case INTERP1_SPLINE:
+                for ( size_t i = 0U ; i < n ; ++i ) {
+                    real_t * const c = &buffer[ 4U*i ];
+                    const real_t x1_x0 = tx[ i + 1U ] - tx[ i ];
+                    const real_t y0 = ty[ i ];
+                    const real_t y1 = ty[ i + 1U ];
+                    const real_t s = ( y1 - y0 )/x1_x0;
+                    real_t m0, m1;
+
+                    if ( 0U == i ) {
+                        m0 = ( ty[ 1 ] - ty[ 0 ] )/( tx[ 1 ] - tx[ 0 ] );
+                        m1 = ( ty[ 2 ] - ty[ 0 ] )/( tx[ 2 ] - tx[ 0 ] );
+                    }
+                    else if ( ( n - 1U ) == i ) {
+                        m0 = ( ty[ n ] - ty[ n - 2U ] )/( tx[ n ] - tx[ n - 2U ] );
+                        m1 = ( ty[ n ] - ty[ n - 1U ] )/( tx[ n ] - tx[ n - 1U ] );
+                    }
+                    else {
+                        m0 = slope( tx, ty, i );
+                        m1 = slope( tx, ty, i + 1U );
+                    }
+                    /*the Hermite basis expanded in powers of x - x0*/
+                    c[ 0 ] = y0;
+                    c[ 1 ] = m0;
+                    c[ 2 ] = ( ( 3.0_re*s ) - ( 2.0_re*m0 ) - m1 )/x1_x0;
+                    c[ 3 ] = ( m0 + m1 - ( 2.0_re*s ) )/( x1_x0*x1_x0 );
+                }
+                method = &interp1::preparedSpline;
+                coeff = buffer;
+                break;
+            case INTERP1_CONSTRAINED_SPLINE:
+                for ( size_t i = 0U ; i < n ; ++i ) {
+                    real_t * const c = &buffer[ 4U*i ];
+                    const real_t x0 = tx[ i ];
+                    const real_t x1 = tx[ i + 1U ];
+                    const real_t y0 = ty[ i ];
+                    const real_t y1 = ty[ i + 1U ];
+                    const real_t fd2i_xl1 = leftSecondDerivate( tx, ty, n, i + 1U );
+                    const real_t fd2i_x = rightSecondDerivate( tx, ty, n, i + 1U );
+                    const real_t x0_x1 = x0 - x1;
+                    const real_t x1_2 = x1*x1;
+                    const real_t x1_3 = x1_2*x1;
+                    const real_t x0_2 = x0*x0;
+                    const real_t x0_3 = x0_2*x0;
+                    const real_t inv_x0_x1 = 1.0_re/x0_x1;
+                    const real_t d = ( fd2i_x - fd2i_xl1 )*( 0.166666667_re*inv_x0_x1 );
+                    const real_t cc = ( ( x0*fd2i_xl1 ) - ( x1*fd2i_x ) )*( 0.5_re*inv_x0_x1 );
+                    const real_t b = ( y0 - y1 - cc*( x0_2 - x1_2 ) - d*( x0_3 - x1_3 ) )*inv_x0_x1;
+
+                    c[ 0 ] = y1 - ( b*x1 ) - ( cc*x1_2 ) - ( d*x1_3 );
+                    c[ 1 ] = b;
+                    c[ 2 ] = cc;
+                    c[ 3 ] = d;
+                }
+                method = &interp1::preparedCSpline;
+                coeff = buffer;
+                break;
+            default:
                 break;
-            }
         }
+        coeffSize = bufferSize;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool interp1::setSearch( const interp1Search s ) noexcept
+{
+    bool retValue = false;
 
-        if ( x >= tx[ tableSize - 1U ] ) {
-            y = ty[ tableSize - 1U ];
+    if ( s < INTERP1_SEARCH_MAX ) {
+        search = s;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+void interp1::get( const real_t * const xq,
+                   real_t * const yq,
+                   const size_t m ) noexcept
+{
+    if ( ( nullptr != xq ) && ( nullptr != yq ) ) {
+        const interp1Fcn_t f = method;
+        const interp1Search s = search;
+        size_t k = 1U;
+
+        while ( ( k < m ) && !( xq[ k ] < xq[ k - 1U ] ) ) {
+            ++k;
+        }
+        if ( k >= m ) {
+            /*sorted input, a merged sweep hunting from the previous segment*/
+            search = INTERP1_SEARCH_HUNT;
+            cursor = 0U;
+            k = 0U;
+        }
+        else if ( ( dataSize >= 2U ) && ( nullptr != xData ) && ( nullptr != yData ) ) {
+            /*unsorted input, the vectors of points locate their segments at once*/
+            k = gatherBatch( current, xData, yData, dataSize, xq, yq, m );
         }
         else {
-            y = ty[ nearestIndex + 1U ];
+            k = 0U;
+        }
+        for ( ; k < m ; ++k ) {
+            yq[ k ] = ( this->*f )( xq[ k ] );
         }
+        search = s;
     }
+}
+/*============================================================================*/
+void interp1::updateGrid( void ) noexcept
+{
+    uniform = false;
+    invStep = 0.0_re;
+    cursor = 0U;
+    if ( ( nullptr != xData ) && ( dataSize >= 2U ) ) {
+        const size_t n = dataSize - 1U;
+        const real_t x0 = xData[ 0 ];
+        const real_t span = xData[ n ] - x0;
 
-    return y;
+        if ( span > 0.0_re ) {
+            /*cstat -CERT-FLP36-C*/
+            const real_t step = span/static_cast<real_t>( n );
+            /*cstat +CERT-FLP36-C*/
+            /*a quarter of step keeps the guess of locate() within one point*/
+            const real_t tol = 0.25_re*step;
+
+            uniform = true;
+            for ( size_t i = 1U ; i < n ; ++i ) {
+                /*cstat -CERT-FLP36-C*/
+                if ( ffmath::absf( xData[ i ] - ( x0 + ( step*static_cast<real_t>( i ) ) ) ) > tol ) {
+                /*cstat +CERT-FLP36-C*/
+                    uniform = false;
+                    break;
+                }
+            }
+            invStep = 1.0_re/step;
+        }
+    }
 }
 /*============================================================================*/
-real_t interp1::previous( const real_t x,
-                          const real_t * const tx,
-                          const real_t * const ty,
-                          const size_t tableSize )
+size_t interp1::locate( const real_t x,
+                        const bool lower ) noexcept
 {
-    real_t y = ffmath::getNan();
+    const real_t * const tx = xData;
+    size_t lo = 0U;
+    size_t hi = dataSize;
+    interp1Search s = search;
 
-    if ( ( tableSize >= 2U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
-        if ( x <= tx[ 0 ] ) {
-            y = ty[ 0 ];
+    if ( INTERP1_SEARCH_AUTO == s ) {
+        s = ( uniform ) ? INTERP1_SEARCH_UNIFORM : INTERP1_SEARCH_BINARY;
+    }
+    /*the points in [ 0, lo ) are before x and the ones in [ hi, n ) are not*/
+    switch ( s ) {
+        case INTERP1_SEARCH_SEQUENTIAL:
+            while ( ( lo < hi ) && isBefore( tx[ lo ], x, lower ) ) {
+                ++lo;
+            }
+            hi = lo;
+            break;
+        case INTERP1_SEARCH_UNIFORM:
+            {
+                const real_t t = ( x - tx[ 0 ] )*invStep;
+                /*cstat -CERT-FLP36-C -CERT-FLP34-C*/
+                if ( t >= static_cast<real_t>( hi ) ) {
+                    lo = hi;
+                }
+                else if ( t > 0.0_re ) {
+                    lo = static_cast<size_t>( t ) + 1U;
+                }
+                else {
+                    lo = 0U;
+                }
+                /*cstat +CERT-FLP36-C +CERT-FLP34-C*/
+                /*the guess is exact for evenly spaced points, fix the rounding*/
+                while ( ( lo > 0U ) && !isBefore( tx[ lo - 1U ], x, lower ) ) {
+                    --lo;
+                }
+                while ( ( lo < hi ) && isBefore( tx[ lo ], x, lower ) ) {
+                    ++lo;
+                }
+                hi = lo;
+            }
+            break;
+        case INTERP1_SEARCH_HUNT:
+            {
+                size_t step = 1U;
+
+                lo = ( cursor < hi ) ? cursor : hi;
+                if ( ( lo > 0U ) && !isBefore( tx[ lo - 1U ], x, lower ) ) {
+                    /*hunt down, doubling the step until x is bracketed*/
+                    hi = lo - 1U;
+                    lo = 0U;
+                    while ( hi > 0U ) {
+                        const size_t p = ( hi > step ) ? ( hi - step ) : 0U;
+
+                        if ( isBefore( tx[ p ], x, lower ) ) {
+                            lo = p + 1U;
+                            break;
+                        }
+                        hi = p;
+                        step <<= 1U;
+                    }
+                }
+                else {
+                    /*hunt up*/
+                    while ( ( lo + step - 1U ) < hi ) {
+                        const size_t p = lo + step - 1U;
+
+                        if ( !isBefore( tx[ p ], x, lower ) ) {
+                            hi = p;
+                            break;
+                        }
+                        lo = p + 1U;
+                        step <<= 1U;
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    while ( lo < hi ) {
+        const size_t mid = lo + ( ( hi - lo )/2U );
+
+        if ( isBefore( tx[ mid ], x, lower ) ) {
+            lo = mid + 1U;
         }
         else {
-            size_t nearestIndex = 0U;
+            hi = mid;
+        }
+    }
+    cursor = lo;
 
-            for ( size_t i = 1U ; i < tableSize; ++i ) {
-                if ( x < tx [ i ] ) {
-                    break;
+    return lo;
+}
+/*============================================================================*/
+size_t interp1::segment( const real_t x ) noexcept
+{
+    size_t i;
+
+    /* Extrapolation for x beyond the range*/
+    if ( x <= xData[ 0 ] ) {
+        i = 0U;
+    }
+    else if ( x >= xData[ dataSize - 1U ] ) {
+        i = dataSize - 2U; /* Use the last interval for extrapolation*/
+    }
+    else {
+        i = locate( x, false ) - 1U;
+    }
+
+    return i;
+}
+/*============================================================================*/
+size_t interp1::nextIndex( const real_t x ) noexcept
+{
+    size_t i = dataSize - 1U;
+
+    if ( x < xData[ i ] ) {
+        i = locate( x, false );
+        i = ( i > 1U ) ? i : 1U;
+    }
+
+    return i;
+}
+/*============================================================================*/
+size_t interp1::previousIndex( const real_t x ) noexcept
+{
+    size_t i = 0U;
+
+    if ( x > xData[ 0 ] ) {
+        i = locate( x, false ) - 1U;
+    }
+
+    return i;
+}
+/*============================================================================*/
+size_t interp1::nearestIndex( const real_t x ) noexcept
+{
+    const real_t * const tx = xData;
+    const size_t tableSize = dataSize;
+    size_t i = locate( x, false );
+
+    if ( tableSize == i ) {
+        i = tableSize - 1U;
+    }
+    else if ( ( i > 0U ) && ( ffmath::absf( x - tx[ i ] ) > ffmath::absf( x - tx[ i - 1U ] ) ) ) {
+        --i;
+    }
+    else {
+        /*on a tie, the last of the repeated points*/
+        while ( ( ( i + 1U ) < tableSize ) && !( tx[ i + 1U ] > tx[ i ] ) ) {
+            ++i;
+        }
+    }
+
+    return i;
+}
+/*============================================================================*/
+size_t interp1::weights( const real_t x,
+                         size_t &first,
+                         real_t * const w ) noexcept
+{
+    const real_t * const tx = xData;
+    const size_t tableSize = dataSize;
+    size_t count = 0U;
+
+    /*the result of the method is y = sum( w[ k ]*yTable[ first + k ] )*/
+    if ( ( tableSize >= 2U ) && ( nullptr != tx ) ) {
+        switch ( current ) {
+            case INTERP1_NEXT:
+                first = nextIndex( x );
+                w[ 0 ] = 1.0_re;
+                count = 1U;
+                break;
+            case INTERP1_PREVIOUS:
+                first = previousIndex( x );
+                w[ 0 ] = 1.0_re;
+                count = 1U;
+                break;
+            case INTERP1_NEAREST:
+                first = nearestIndex( x );
+                w[ 0 ] = 1.0_re;
+                count = 1U;
+                break;
+            case INTERP1_LINEAR:
+                {
+                    size_t i = tableSize - 2U;
+
+                    if ( x < tx[ 0 ] ) {
+                        i = 0U;
+                    }
+                    else if ( !( x > tx[ tableSize - 1U ] ) ) {
+                        const size_t j = locate( x, true );
+                        i = ( j > 0U ) ? ( j - 1U ) : 0U;
+                    }
+                    else {
+                        /*extrapolation on the last segment*/
+                    }
+                    w[ 1 ] = ( x - tx[ i ] )/( tx[ i + 1U ] - tx[ i ] );
+                    w[ 0 ] = 1.0_re - w[ 1 ];
+                    first = i;
+                    count = 2U;
                 }
-                nearestIndex = i;
-            }
-            y = ty[ nearestIndex ];
+                break;
+            case INTERP1_SINE:
+                {
+                    size_t i = 1U;
+                    real_t xa, xb;
+
+                    if ( x > tx[ tableSize - 1U ] ) {
+                        i = tableSize - 1U;
+                        xa = tx[ i ];
+                        xb = tx[ i - 1U ];
+                    }
+                    else {
+                        if ( !( x < tx[ 0 ] ) ) {
+                            const size_t j = locate( x, true );
+                            i = ( j > 1U ) ? j : 1U;
+                        }
+                        xa = tx[ i - 1U ];
+                        xb = tx[ i ];
+                    }
+                    /*the weight of the point at xb*/
+                    const real_t s = 0.5_re - 0.5_re*ffmath::cos( ffmath::FFP_PI*( x - xa )/( xb - xa ) );
+                    const bool reversed = ( xa > xb );
+
+                    w[ 0 ] = ( reversed ) ? s : ( 1.0_re - s );
+                    w[ 1 ] = ( reversed ) ? ( 1.0_re - s ) : s;
+                    first = i - 1U;
+                    count = 2U;
+                }
+                break;
+            case INTERP1_CUBIC:
+                if ( tableSize >= 4U ) {
+                    const bool above = ( x > tx[ tableSize - 1U ] );
+                    size_t i = 1U;
+
+                    if ( above ) {
+                        i = tableSize - 1U;
+                    }
+                    else if ( !( x < tx[ 0 ] ) ) {
+                        const size_t j = locate( x, true );
+                        i = ( j > 1U ) ? j : 1U;
+                    }
+                    else {
+                        /*extrapolation on the first segment*/
+                    }
+                    const real_t h = tx[ i ] - tx[ i - 1U ];
+                    const real_t t = ( x - ( ( above ) ? tx[ i ] : tx[ i - 1U ] ) )/h;
+                    const real_t t2 = t*t;
+                    const real_t t3 = t2*t;
+                    const real_t a = 2.0_re*t3 - 3.0_re*t2 + 1.0_re;
+                    const real_t b = ( t3 - 2.0_re*t2 + t )*h;
+                    const real_t c = -2.0_re*t3 + 3.0_re*t2;
+                    const real_t d = ( t3 - t2 )*h;
+
+                    if ( above ) {
+                        /*a, b and c are on the last point, the previous one
+                        and the one before it*/
+                        w[ 0 ] = -b;
+                        w[ 1 ] = b + c - d;
+                        w[ 2 ] = a + d;
+                        first = i - 2U;
+                        count = 3U;
+                    }
+                    else if ( x < tx[ 0 ] ) {
+                        w[ 0 ] = a + b - d;
+                        w[ 1 ] = -b + c + d;
+                        first = 0U;
+                        count = 2U;
+                    }
+                    else if ( i > 1U ) {
+                        w[ 0 ] = -b;
+                        w[ 1 ] = a + b - d;
+                        w[ 2 ] = c + d;
+                        first = i - 2U;
+                        count = 3U;
+                    }
+                    else {
+                        /*there is no point before the first segment*/
+                        w[ 0 ] = a - d;
+                        w[ 1 ] = c + d;
+                        first = 0U;
+                        count = 2U;
+                    }
+                }
+                break;
+            case INTERP1_SPLINE:
+                if ( tableSize >= 4U ) {
+                    const size_t n = tableSize - 1U;
+                    const size_t i = segment( x );
+
+                    if ( ffmath::isEqual( x , tx[ i + 1U ] ) ) {
+                        w[ 0 ] = 1.0_re;
+                        first = i + 1U;
+                        count = 1U;
+                    }
+                    else {
+                        const size_t b = ( i > 0U ) ? ( i - 1U ) : 0U;
+                        const real_t x1_x0 = tx[ i + 1U ] - tx[ i ];
+                        const real_t t = ( x - tx[ i ] )/x1_x0;
+                        const real_t t_2 = t*t;
+                        const real_t t_3 = t_2*t;
+                        const real_t h01 = ( 3.0_re*t_2 ) - ( 2.0_re*t_3 );
+                        /*the gains of the slopes at both ends*/
+                        const real_t g0 = ( t_3 - 2.0_re*t_2 + t )*x1_x0;
+                        const real_t g1 = ( t_3 - t_2 )*x1_x0;
+                        /*the points of the slopes m0 and m1*/
+                        size_t p0 = i - 1U, q0 = i + 1U, p1 = i, q1 = i + 2U;
+
+                        if ( 0U == i ) {
+                            p0 = 0U;
+                            q0 = 1U;
+                            p1 = 0U;
+                            q1 = 2U;
+                        }
+                        else if ( ( n - 1U ) == i ) {
+                            p0 = n - 2U;
+                            q0 = n;
+                            p1 = n - 1U;
+                            q1 = n;
+                        }
+                        else {
+                            /*inner segment*/
+                        }
+                        count = ( ( 0U == i ) || ( ( n - 1U ) == i ) ) ? 3U : 4U;
+                        for ( size_t k = 0U ; k < count ; ++k ) {
+                            w[ k ] = 0.0_re;
+                        }
+                        w[ i - b ] += 1.0_re - h01;
+                        w[ i + 1U - b ] += h01;
+                        if ( !ffmath::isEqual( tx[ q0 ], tx[ p0 ] ) ) {
+                            const real_t s = g0/( tx[ q0 ] - tx[ p0 ] );
+                            w[ q0 - b ] += s;
+                            w[ p0 - b ] -= s;
+                        }
+                        if ( !ffmath::isEqual( tx[ q1 ], tx[ p1 ] ) ) {
+                            const real_t s = g1/( tx[ q1 ] - tx[ p1 ] );
+                            w[ q1 - b ] += s;
+                            w[ p1 - b ] -= s;
+                        }
+                        first = b;
+                    }
+                }
+                break;
+            default:
+                /*the result is not a local weighted sum of the points*/
+                break;
         }
     }
-    return y;
+
+    return count;
 }
 /*============================================================================*/
-real_t interp1::nearest( const real_t x,
-                         const real_t * const tx,
-                         const real_t * const ty,
-                         const size_t tableSize )
+real_t interp1::next( const real_t x ) noexcept
 {
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
     real_t y = ffmath::getNan();
 
     if ( ( tableSize >= 2U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
-        size_t nearestIndex = 0U;
-        real_t minDistance = ffmath::absf( x - tx[ 0 ] );
+        y = ty[ nextIndex( x ) ];
+    }
 
-        for ( size_t i = 1U ; i < tableSize; ++i ) {
-            const real_t distance = ffmath::absf( x - tx[ i ] );
+    return y;
+}
+/*============================================================================*/
+real_t interp1::previous( const real_t x ) noexcept
+{
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
+    real_t y = ffmath::getNan();
 
-            if ( distance <= minDistance) {
-                minDistance = distance;
-                nearestIndex = i;
-            }
-        }
-        y = ty[ nearestIndex ];
+    if ( ( tableSize >= 2U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
+        y = ty[ previousIndex( x ) ];
+    }
+    return y;
+}
+/*============================================================================*/
+real_t interp1::nearest( const real_t x ) noexcept
+{
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
+    real_t y = ffmath::getNan();
+
+    if ( ( tableSize >= 2U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
+        y = ty[ nearestIndex( x ) ];
     }
     return y;
 }
 /*============================================================================*/
-real_t interp1::linear( const real_t x,
-                        const real_t * const tx,
-                        const real_t * const ty,
-                        const size_t tableSize )
+real_t interp1::linear( const real_t x ) noexcept
 {
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
     real_t y = ffmath::getNan();
 
     if ( ( tableSize >= 2U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
@@ -129,27 +934,23 @@ real_t interp1::linear( const real_t x,
             y = y1 + ( ( y0 - y1 )/( x0 - x1 ) )*( x - x1 );
         }
         else {
-            const int maxIndex = static_cast<int>( tableSize ) - 1;
-            for ( int i = 0; i < maxIndex; ++i ) {
-                if ( ( x >= tx[ i ] ) && ( x <= tx[ i + 1 ] ) ) {
-                    const real_t x0 = tx[ i ];
-                    const real_t x1 = tx[ i + 1 ];
-                    const real_t y0 = ty[ i ];
-                    const real_t y1 = ty[ i + 1 ];
-                    y = y0 + ( ( y1 - y0 )/( x1 - x0 ) )*( x - x0 );
-                    break;
-                }
-            }
+            const size_t j = locate( x, true );
+            const size_t i = ( j > 0U ) ? ( j - 1U ) : 0U;
+            const real_t x0 = tx[ i ];
+            const real_t x1 = tx[ i + 1U ];
+            const real_t y0 = ty[ i ];
+            const real_t y1 = ty[ i + 1U ];
+            y = y0 + ( ( y1 - y0 )/( x1 - x0 ) )*( x - x0 );
         }
     }
     return y;
 }
 /*============================================================================*/
-real_t interp1::sine( const real_t x,
-                      const real_t * const tx,
-                      const real_t * const ty,
-                      const size_t tableSize )
+real_t interp1::sine( const real_t x ) noexcept
 {
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
     real_t y = ffmath::getNan();
     if ( ( tableSize >= 2U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
         if ( x < tx[ 0 ] ) {
@@ -169,26 +970,24 @@ real_t interp1::sine( const real_t x,
             y = y1 + w*( y0 - y1 );
         }
         else {
-            for ( size_t i = 1; i < tableSize; ++i ) {
-                if ( x <= tx[ i ] ) {
-                    const real_t x0 = tx[ i - 1U ];
-                    const real_t x1 = tx[ i ];
-                    const real_t y0 = ty[ i - 1U ];
-                    const real_t y1 = ty[ i];
-                    const real_t w = 0.5_re - 0.5_re*ffmath::cos( ffmath::FFP_PI*( x - x0 )/( x1 - x0 ) );
-                    y = y0 + w*( y1 - y0 );
-                }
-            }
+            const size_t j = locate( x, true );
+            const size_t i = ( j > 1U ) ? j : 1U;
+            const real_t x0 = tx[ i - 1U ];
+            const real_t x1 = tx[ i ];
+            const real_t y0 = ty[ i - 1U ];
+            const real_t y1 = ty[ i ];
+            const real_t w = 0.5_re - 0.5_re*ffmath::cos( ffmath::FFP_PI*( x - x0 )/( x1 - x0 ) );
+            y = y0 + w*( y1 - y0 );
         }
     }
     return y;
 }
 /*============================================================================*/
-real_t interp1::cubic( const real_t x,
-                       const real_t * const tx,
-                       const real_t * const ty,
-                       const size_t tableSize )
+real_t interp1::cubic( const real_t x ) noexcept
 {
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
     real_t y = ffmath::getNan();
     if ( ( tableSize >= 4U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
         if ( x < tx[ 0 ] ) {
@@ -222,33 +1021,32 @@ real_t interp1::cubic( const real_t x,
                 ( t3 - t2 )*h*( y1 - y0 );
         }
         else {
-            for ( size_t i = 1U; i < tableSize; ++i ) {
-                if ( x <= tx[ i ] ) {
-                    const real_t x0 = tx[ i - 1U ];
-                    const real_t x1 = tx[ i ];
-                    const real_t y0 = ty[ i - 1U ];
-                    const real_t y1 = ty[ i ];
-                    const real_t h = x1 - x0;
-                    const real_t t = ( x - x0 )/h;
-                    const real_t t2 = t*t;
-                    const real_t t3 = t2*t;
-                    y = ( 2.0_re*t3 - 3.0_re*t2 + 1.0_re )*y0 +
-                        ( t3 - 2.0_re*t2 + t )*h*( y0 - ty[ i - 2U ] ) +
-                        ( -2.0_re*t3 + 3.0_re*t2 )*y1 +
-                        ( t3 - t2 )*h*( y1 - y0 );
-                    break;
-                }
-            }
+            const size_t j = locate( x, true );
+            const size_t i = ( j > 1U ) ? j : 1U;
+            const real_t x0 = tx[ i - 1U ];
+            const real_t x1 = tx[ i ];
+            const real_t y0 = ty[ i - 1U ];
+            const real_t y1 = ty[ i ];
+            /*there is no point before the first segment*/
+            const real_t yp = ( i > 1U ) ? ty[ i - 2U ] : y0;
+            const real_t h = x1 - x0;
+            const real_t t = ( x - x0 )/h;
+            const real_t t2 = t*t;
+            const real_t t3 = t2*t;
+            y = ( 2.0_re*t3 - 3.0_re*t2 + 1.0_re )*y0 +
+                ( t3 - 2.0_re*t2 + t )*h*( y0 - yp ) +
+                ( -2.0_re*t3 + 3.0_re*t2 )*y1 +
+                ( t3 - t2 )*h*( y1 - y0 );
         }
     }
     return y;
 }
 /*============================================================================*/
-real_t interp1::hermite( const real_t x,
-                         const real_t * const tx,
-                         const real_t * const ty,
-                         const size_t tableSize )
+real_t interp1::hermite( const real_t x ) noexcept
 {
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
     real_t y = ffmath::getNan();
 
     if ( ( tableSize >= 2U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
@@ -284,27 +1082,15 @@ real_t interp1::hermite( const real_t x,
     return y;
 }
 /*============================================================================*/
-real_t interp1::spline( const real_t x,
-                        const real_t * const tx,
-                        const real_t * const ty,
-                        const size_t tableSize )
+real_t interp1::spline( const real_t x ) noexcept
 {
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
     real_t y = ffmath::getNan();
 
     if ( ( tableSize >= 4U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
-        size_t i = 0U;
-        /* Extrapolation for x beyond the range*/
-        if ( x <= tx[ 0 ] ) {
-            i = 0U;
-        }
-        else if ( x >= tx[ tableSize - 1U ] ) {
-            i = tableSize - 2U; /* Use the last interval for extrapolation*/
-        }
-        else {
-            while ( x >= tx[ i + 1U ] ) {
-                i++;
-            }
-        }
+        const size_t i = segment( x );
 
         if ( ffmath::isEqual( x , tx[ i + 1U ] ) ) {
             y = ty[ i + 1U ];
@@ -343,27 +1129,15 @@ real_t interp1::spline( const real_t x,
     return y;
 }
 /*============================================================================*/
-real_t interp1::cSpline( const real_t x,
-                         const real_t * const tx,
-                         const real_t * const ty,
-                         const size_t tableSize )
+real_t interp1::cSpline( const real_t x ) noexcept
 {
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
     real_t y = ffmath::getNan();
 
     if ( ( tableSize >= 4U ) && ( nullptr != tx ) && ( nullptr != ty ) ) {
-        size_t i = 0U;
-        /* Extrapolation for x beyond the range*/
-        if ( x <= tx[ 0 ] ) {
-            i = 0U;
-        }
-        else if ( x >= tx[ tableSize - 1U ] ) {
-            i = tableSize - 2U; /* Use the last interval for extrapolation*/
-        }
-        else {
-            while ( x >= tx[ i + 1U ] ) {
-                i++;
-            }
-        }
+        const size_t i = segment( x );
 
         if ( ffmath::isEqual( x , tx[ i + 1U ] ) ) {
             y = ty[ i + 1U ];
@@ -392,6 +1166,79 @@ real_t interp1::cSpline( const real_t x,
     return y;
 }
 /*============================================================================*/
+real_t interp1::preparedHermite( const real_t x ) noexcept
+{
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t tableSize = dataSize;
+    real_t y;
+
+    if ( ( x < tx[ 0 ] ) || ( x > tx[ tableSize - 1U ] ) ) {
+        y = hermite( x );
+    }
+    else {
+        const size_t k = locate( x, false );
+
+        if ( !( tx[ k - 1U ] < x ) ) {
+            y = ty[ k - 1U ];
+        }
+        else {
+            /*second form of the barycentric formula*/
+            real_t num = 0.0_re;
+            real_t den = 0.0_re;
+
+            for ( size_t i = 0U ; i < tableSize ; ++i ) {
+                const real_t r = coeff[ i ]/( x - tx[ i ] );
+
+                num += r*ty[ i ];
+                den += r;
+            }
+            y = num/den;
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+real_t interp1::preparedSpline( const real_t x ) noexcept
+{
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t i = segment( x );
+    real_t y;
+
+    if ( ffmath::isEqual( x , tx[ i + 1U ] ) ) {
+        y = ty[ i + 1U ];
+    }
+    else {
+        const real_t * const c = &coeff[ 4U*i ];
+        const real_t u = x - tx[ i ];
+
+        y = c[ 0 ] + u*( c[ 1 ] + u*( c[ 2 ] + ( u*c[ 3 ] ) ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+real_t interp1::preparedCSpline( const real_t x ) noexcept
+{
+    const real_t * const tx = xData;
+    const real_t * const ty = yData;
+    const size_t i = segment( x );
+    real_t y;
+
+    if ( ffmath::isEqual( x , tx[ i + 1U ] ) ) {
+        y = ty[ i + 1U ];
+    }
+    else {
+        const real_t * const c = &coeff[ 4U*i ];
+
+        y = c[ 0 ] + x*( c[ 1 ] + x*( c[ 2 ] + ( x*c[ 3 ] ) ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
 real_t interp1::slope( const real_t * const tx,
                        const real_t * const ty,
                        const size_t i )
@@ -97,6 +97,37 @@ real_t discreteSystem::updateFIR( real_t *w,
     return y;
 }
 /*============================================================================*/
+real_t discreteSystem::updateFIR( real_t *w,
+                                  const size_t wsize,
+                                  size_t &head,
+                                  const real_t x,
+                                  const real_t * const c )
+{
+    size_t i;
+    real_t y = 0.0_re;
+    const real_t *s;
+
+    head = ( 0U == head ) ? ( wsize - 1U ) : ( head - 1U );
+    w[ head ] = x;
+    w[ head + wsize ] = x;
+    s = &w[ head ];
+    /*same order of operations of the shifting version*/
+    if ( nullptr != c ) {
+        for ( i = ( wsize - 1U ) ; i >= 1U ; --i ) {
+            y += s[ i ]*c[ i ];
+        }
+        y += c[ 0 ]*x;
+    }
+    else {
+        for ( i = ( wsize - 1U ) ; i >= 1U ; --i ) {
+            y += s[ i ];
+        }
+        y += x;
+    }
+
+    return y;
+}
+/*============================================================================*/
 bool discreteSystem::setInitStates( const real_t *xi )
 {
     bool retValue = false;
@@ -112,6 +143,13 @@ bool discreteSystem::setInitStates( const real_t *xi )
                 xd[ i ] = 0.0_re;
             }
         }
+        if ( nullptr != xr ) {
+            for ( size_t i = 0U; i < n ; ++i ) {
+                xr[ i + n ] = xd[ i ];
+                xr[ i ] = xd[ i ];
+            }
+            xHead = 0U;
+        }
        retValue = true;
     }
 
@@ -132,6 +170,7 @@ bool discreteSystem::setup( real_t *num,
         nb = n_b;
         n = ( na > nb ) ? na : nb;
         xd = x;
+        xr = nullptr;
         a = &den[ 1 ];
         type = LTISYS_TYPE_DISCRETE;
         normalizeTransferFunction( num, den, n_a, n_b );
@@ -145,12 +184,52 @@ bool discreteSystem::setup( real_t *num,
 real_t discreteSystem::update( const real_t u )
 {
     real_t v = u;
+    real_t y;
+
+    if ( nullptr != xr ) {
+        const real_t * const s = &xr[ xHead ];
 
-    /*using direct-form 2*/
-    for ( size_t i = 0 ; i < na ; ++i ) {
-        v -= a[ i ]*xd[ i ];
+        /*using direct-form 2*/
+        for ( size_t i = 0 ; i < na ; ++i ) {
+            v -= a[ i ]*s[ i ];
+        }
+        y = updateFIR( xr, n, xHead, v, b );
+    }
+    else {
+        /*using direct-form 2*/
+        for ( size_t i = 0 ; i < na ; ++i ) {
+            v -= a[ i ]*xd[ i ];
+        }
+        y = updateFIR( xd, n, v, b );
     }
-    return updateFIR( xd, n, v, b );
+
+    return y;
+}
+/*============================================================================*/
+bool discreteSystem::setRingBuffer( real_t *buffer ) noexcept
+{
+    bool retValue = false;
+
+    if ( isInitialized() ) {
+        size_t i;
+
+        if ( nullptr != xr ) { /*bring back the states in order*/
+            for ( i = 0U ; i < n ; ++i ) {
+                xd[ i ] = xr[ xHead + i ];
+            }
+        }
+        if ( nullptr != buffer ) {
+            for ( i = 0U ; i < n ; ++i ) {
+                buffer[ i + n ] = xd[ i ];
+                buffer[ i ] = xd[ i ];
+            }
+        }
+        xr = buffer;
+        xHead = 0U;
+        retValue = true;
+    }
+
+    return retValue;
 }
 /*============================================================================*/
 bool continuousSystem::setup( real_t *num,
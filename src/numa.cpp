@@ -54,7 +54,7 @@ real_t nState::derive( const real_t s,
                        const real_t dt,
                        const bool bUpdate ) noexcept
 {
-    float ds = 0.0F;
+    real_t ds = 0.0_re;
 
     switch( dMethod ) {
         case DERIVATION_2POINTS:
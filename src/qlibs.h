@@ -58,6 +58,7 @@ This file is part of the QuarkTS++ OS distribution.
     #include <include/ffmath.hpp>
     #include <include/bitfield.hpp>
     #include <include/interp1.hpp>
+    #include <include/interpN.hpp>
     #include <include/algorithm.hpp>
 
     namespace qlibs {
@@ -3,7 +3,97 @@
 #include <include/ffmath.hpp>
 
 using namespace qlibs;
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __aarch64__ ) || defined( __ARM_NEON ) )
+    #define SMOOTHER_BANK_SIMD
+#endif
+
 /*! @cond  */
+namespace {
+    /*coefficients of the 2nd order Low-Pass Filter for 0 < a < 1*/
+    void lpf2Coefficients( const real_t a,
+                           real_t &k,
+                           real_t &a1,
+                           real_t &a2,
+                           real_t &b1 )
+    {
+        real_t aa, p1, r;
+        aa = a*a;
+        /*cstat -MISRAC2012-Dir-4.11_b*/
+        p1 = ffmath::sqrt( 2.0_re*a ); /*arg always positive*/
+        /*cstat +MISRAC2012-Dir-4.11_b*/
+        r = 1.0_re + p1 + aa;
+        k = aa/r;
+        a1 = 2.0_re*( aa - 1.0_re )/r;
+        a2 = ( 1.0_re - p1 + aa )/r;
+        b1 = 2.0_re*k;
+    }
+    /*The window filters keep their samples in the window w, that is shifted
+    on every sample, or in the mirrored ring r of 2*wsize elements when it is
+    not nullptr. See discreteSystem::updateFIR()*/
+    real_t windowUpdate( real_t * const w,
+                         real_t * const r,
+                         size_t &head,
+                         const size_t wsize,
+                         const real_t x,
+                         const real_t * const c = nullptr )
+    {
+        return ( nullptr != r ) ? discreteSystem::updateFIR( r, wsize, head, x, c )
+                                : discreteSystem::updateFIR( w, wsize, x, c );
+    }
+    /*the window with the newest sample first*/
+    real_t* windowData( real_t * const w,
+                        real_t * const r,
+                        const size_t head )
+    {
+        return ( nullptr != r ) ? &r[ head ] : w;
+    }
+    void windowInit( real_t * const w,
+                     real_t * const r,
+                     const size_t wsize,
+                     const real_t x )
+    {
+        real_t * const p = ( nullptr != r ) ? r : w;
+        const size_t np = ( nullptr != r ) ? ( 2U*wsize ) : wsize;
+
+        for ( size_t i = 0U ; i < np ; ++i ) {
+            p[ i ] = x;
+        }
+    }
+    /*moves the samples of the window to the ring buffer, or back to w when
+    buffer is nullptr. buffer can be the same w if it has 2*wsize elements*/
+    void windowRelocate( real_t * const w,
+                         real_t *&r,
+                         size_t &head,
+                         const size_t wsize,
+                         real_t * const buffer )
+    {
+        size_t i;
+
+        if ( nullptr != r ) {
+            for ( i = 0U ; i < wsize ; ++i ) {
+                w[ i ] = r[ head + i ];
+            }
+        }
+        if ( nullptr != buffer ) {
+            for ( i = 0U ; i < wsize ; ++i ) {
+                buffer[ i + wsize ] = w[ i ];
+                buffer[ i ] = w[ i ];
+            }
+        }
+        r = buffer;
+        head = 0U;
+    }
+    /*block FIR of the window filters, defined along with the SIMD kernels*/
+    void windowBlockFIR( real_t * const w,
+                         real_t * const r,
+                         size_t &head,
+                         const size_t wsize,
+                         const real_t * const c,
+                         const real_t * const in,
+                         real_t * const out,
+                         const size_t n );
+}
 /*============================================================================*/
 void smoother::windowSet( real_t *w,
                           const size_t wsize,
@@ -15,6 +105,15 @@ void smoother::windowSet( real_t *w,
 }
 /*! @endcond  */
 /*============================================================================*/
+void smoother::smooth( const real_t * const in,
+                       real_t * const out,
+                       const size_t n )
+{
+    for ( size_t i = 0U ; i < n ; ++i ) {
+        out[ i ] = smooth( in[ i ] );
+    }
+}
+/*============================================================================*/
 bool smootherLPF1::setup( const real_t a )
 {
     bool retValue = false;
@@ -42,21 +141,35 @@ real_t smootherLPF1::smooth( const real_t x )
     return y;
 }
 /*============================================================================*/
+void smootherLPF1::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        const real_t a = alpha;
+        real_t y;
+
+        if ( init ) {
+            y1 = in[ 0 ];
+            init = false;
+        }
+        y = y1;
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            const real_t x = in[ i ];
+
+            y = x + ( a*( y - x ) );
+            out[ i ] = y;
+        }
+        y1 = y;
+    }
+}
+/*============================================================================*/
 bool smootherLPF2::setup( const real_t a )
 {
     bool retValue = false;
 
     if ( ( a > 0.0_re ) && ( a < 1.0_re ) ) {
-        real_t aa, p1, r;
-        aa = a*a;
-        /*cstat -MISRAC2012-Dir-4.11_b*/
-        p1 = ffmath::sqrt( 2.0_re*a ); /*arg always positive*/
-        /*cstat +MISRAC2012-Dir-4.11_b*/
-        r = 1.0_re + p1 + aa;
-        k = aa/r;
-        a1 = 2.0_re*( aa - 1.0_re )/r;
-        a2 = ( 1.0_re - p1 + aa )/r;
-        b1 = 2.0_re*k;
+        lpf2Coefficients( a, k, a1, a2, b1 );
         retValue = reset();
         isSetup = retValue;
     }
@@ -84,13 +197,53 @@ real_t smootherLPF2::smooth( const real_t x )
     return y;
 }
 /*============================================================================*/
+void smootherLPF2::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        const real_t kk = k;
+        const real_t ca1 = a1;
+        const real_t ca2 = a2;
+        const real_t cb1 = b1;
+        real_t sx1, sx2, sy1, sy2;
+
+        if ( init ) {
+            y1 = in[ 0 ];
+            y2 = in[ 0 ];
+            x1 = in[ 0 ];
+            x2 = in[ 0 ];
+            init = false;
+        }
+        sx1 = x1;
+        sx2 = x2;
+        sy1 = y1;
+        sy2 = y2;
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            const real_t x = in[ i ];
+            const real_t y = ( kk*x ) + ( cb1*sx1 ) + ( kk*sx2 ) - ( ca1*sy1 ) - ( ca2*sy2 );
+
+            sx2 = sx1;
+            sx1 = x;
+            sy2 = sy1;
+            sy1 = y;
+            out[ i ] = y;
+        }
+        x1 = sx1;
+        x2 = sx2;
+        y1 = sy1;
+        y2 = sy2;
+    }
+}
+/*============================================================================*/
 bool smootherMWM1::setup( real_t *window,
                           const size_t w_size )
 {
     bool retValue = false;
 
-    if ( ( nullptr != window ) && ( wsize > 0U ) ) {
+    if ( ( nullptr != window ) && ( w_size > 0U ) ) {
         w = window;
+        wr = nullptr;
         wsize = w_size;
         retValue = reset();
         isSetup = retValue;
@@ -99,17 +252,48 @@ bool smootherMWM1::setup( real_t *window,
     return retValue;
 }
 /*============================================================================*/
+bool smootherMWM1::setRingBuffer( real_t *buffer )
+{
+    bool retValue = false;
+
+    if ( isSetup ) {
+        windowRelocate( w, wr, head, wsize, buffer );
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
 real_t smootherMWM1::smooth( const real_t x )
 {
     if ( init ) {
-        windowSet( w, wsize, x );
+        windowInit( w, wr, wsize, x );
         init = false;
     }
     /*cstat -CERT-FLP36-C*/
-    return discreteSystem::updateFIR( w, wsize, x )/static_cast<real_t>( wsize );
+    return windowUpdate( w, wr, head, wsize, x )/static_cast<real_t>( wsize );
     /*cstat +CERT-FLP36-C*/
 }
 /*============================================================================*/
+void smootherMWM1::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        /*cstat -CERT-FLP36-C*/
+        const real_t ws = static_cast<real_t>( wsize );
+        /*cstat +CERT-FLP36-C*/
+        if ( init ) {
+            windowInit( w, wr, wsize, in[ 0 ] );
+            init = false;
+        }
+        windowBlockFIR( w, wr, head, wsize, nullptr, in, out, n );
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            out[ i ] /= ws;
+        }
+    }
+}
+/*============================================================================*/
 bool smootherMWM2::setup( real_t *window,
                           const size_t w_size )
 {
@@ -140,6 +324,33 @@ real_t smootherMWM2::smooth( const real_t x )
     return sum/wsize;
 }
 /*============================================================================*/
+void smootherMWM2::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        /*cstat -CERT-FLP36-C*/
+        const real_t wsize = static_cast<real_t>( itemCount );
+        /*cstat +CERT-FLP36-C*/
+        real_t s;
+
+        if ( init ) {
+            flush( in[ 0 ] );
+            sum = in[ 0 ]*wsize;
+            init = false;
+        }
+        s = sum;
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            const real_t x = in[ i ];
+
+            s += x - getOldest();
+            insertSample( x );
+            out[ i ] = s/wsize;
+        }
+        sum = s;
+    }
+}
+/*============================================================================*/
 bool smootherMOR1::setup( real_t *window,
                           const size_t w_size,
                           const real_t a )
@@ -148,6 +359,7 @@ bool smootherMOR1::setup( real_t *window,
 
     if ( ( nullptr != window ) && ( w_size > 0U ) && ( a > 0.0_re ) && ( a < 1.0_re ) ) {
         w = window;
+        wr = nullptr;
         wsize = w_size;
         alpha = a;
         retValue = reset();
@@ -157,25 +369,79 @@ bool smootherMOR1::setup( real_t *window,
     return retValue;
 }
 /*============================================================================*/
+bool smootherMOR1::setRingBuffer( real_t *buffer )
+{
+    bool retValue = false;
+
+    if ( isSetup ) {
+        windowRelocate( w, wr, head, wsize, buffer );
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
 real_t smootherMOR1::smooth( const real_t x )
 {
     real_t mc;
+    real_t *wn;
 
     if ( init ) {
-        windowSet( w, wsize, x );
+        windowInit( w, wr, wsize, x );
         m = x;
         init = false;
     }
     /*shift, sum and compensate*/
-    mc = discreteSystem::updateFIR( w, wsize, x ) - x;
+    mc = windowUpdate( w, wr, head, wsize, x ) - x;
+    wn = windowData( w, wr, head );
     if ( ffmath::absf( m - x ) > ( alpha*ffmath::absf( m ) ) ) {
-        w[ 0 ] = m; /*replace the outlier with the dynamic median*/
+        wn[ 0 ] = m; /*replace the outlier with the dynamic median*/
+        if ( nullptr != wr ) {
+            wn[ wsize ] = m;
+        }
     }
     /*compute new mean for next iteration*/
     /*cstat -CERT-FLP36-C*/
-    m = ( mc + w[ 0 ] ) / static_cast<real_t>( wsize );
+    m = ( mc + wn[ 0 ] ) / static_cast<real_t>( wsize );
     /*cstat +CERT-FLP36-C*/
-    return w[ 0 ];
+    return wn[ 0 ];
+}
+/*============================================================================*/
+void smootherMOR1::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        /*cstat -CERT-FLP36-C*/
+        const real_t ws = static_cast<real_t>( wsize );
+        /*cstat +CERT-FLP36-C*/
+        const real_t a = alpha;
+        real_t mm;
+
+        if ( init ) {
+            windowInit( w, wr, wsize, in[ 0 ] );
+            m = in[ 0 ];
+            init = false;
+        }
+        mm = m;
+        /*the replaced outliers feed back into the window, so the samples are
+        processed one at a time*/
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            const real_t x = in[ i ];
+            const real_t mc = windowUpdate( w, wr, head, wsize, x ) - x;
+            real_t * const wn = windowData( w, wr, head );
+
+            if ( ffmath::absf( mm - x ) > ( a*ffmath::absf( mm ) ) ) {
+                wn[ 0 ] = mm;
+                if ( nullptr != wr ) {
+                    wn[ wsize ] = mm;
+                }
+            }
+            mm = ( mc + wn[ 0 ] ) / ws;
+            out[ i ] = wn[ 0 ];
+        }
+        m = mm;
+    }
 }
 /*============================================================================*/
 bool smootherMOR2::setup( real_t *window,
@@ -219,6 +485,42 @@ real_t smootherMOR2::smooth( const real_t x )
     return x;
 }
 /*============================================================================*/
+void smootherMOR2::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        /*cstat -CERT-FLP36-C*/
+        const real_t wsize = static_cast<real_t>( itemCount );
+        /*cstat +CERT-FLP36-C*/
+        const real_t a = alpha;
+        real_t s, mm;
+
+        if ( init ) {
+            flush( in[ 0 ] );
+            sum = wsize*in[ 0 ];
+            m = in[ 0 ];
+            init = false;
+        }
+        s = sum;
+        mm = m;
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            const real_t x = in[ i ];
+            real_t xx = x;
+
+            if ( ffmath::absf( mm - x ) > ( a*ffmath::absf( mm ) ) ) {
+                xx = mm;
+            }
+            s += xx - getOldest();
+            mm = s/wsize;
+            insertSample( xx );
+            out[ i ] = x;
+        }
+        sum = s;
+        m = mm;
+    }
+}
+/*============================================================================*/
 bool smootherGMWF::setup( const real_t sg,
                           const real_t c,
                           real_t *window,
@@ -251,6 +553,7 @@ bool smootherGMWF::setup( const real_t sg,
             kernel[ i ] /= sum;
         }
         w = window;
+        wr = nullptr;
         k = kernel;
         wsize = ws;
         retValue = reset();
@@ -260,13 +563,38 @@ bool smootherGMWF::setup( const real_t sg,
     return retValue;
 }
 /*============================================================================*/
+bool smootherGMWF::setRingBuffer( real_t *buffer )
+{
+    bool retValue = false;
+
+    if ( isSetup ) {
+        windowRelocate( w, wr, head, wsize, buffer );
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
 real_t smootherGMWF::smooth( const real_t x )
 {
     if ( init ) {
-        windowSet( w, wsize, x );
+        windowInit( w, wr, wsize, x );
         init = false;
     }
-    return discreteSystem::updateFIR( w, wsize, x, k );
+    return windowUpdate( w, wr, head, wsize, x, k );
+}
+/*============================================================================*/
+void smootherGMWF::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        if ( init ) {
+            windowInit( w, wr, wsize, in[ 0 ] );
+            init = false;
+        }
+        windowBlockFIR( w, wr, head, wsize, k, in, out, n );
+    }
 }
 /*============================================================================*/
 bool smootherEXPW::setup( const real_t lam )
@@ -300,6 +628,34 @@ real_t smootherEXPW::smooth( const real_t x )
     return m;
 }
 /*============================================================================*/
+void smootherEXPW::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        const real_t lam = lambda;
+        real_t mm, ww;
+
+        if ( init ) {
+            m = in[ 0 ];
+            w = 1.0_re;
+            init = false;
+        }
+        mm = m;
+        ww = w;
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            real_t iw;
+
+            ww = ( lam*ww ) + 1.0_re;
+            iw = 1.0_re/ww;
+            mm = ( mm*( 1.0_re - iw ) ) + ( iw*in[ i ] );
+            out[ i ] = mm;
+        }
+        m = mm;
+        w = ww;
+    }
+}
+/*============================================================================*/
 bool smootherKLMN::setup( const real_t processNoiseCov,
                           const real_t measureNoiseCov,
                           const real_t estErrorCov )
@@ -339,6 +695,41 @@ real_t smootherKLMN::smooth( const real_t x )
     return xS;
 }
 /*============================================================================*/
+void smootherKLMN::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t n )
+{
+    if ( n > 0U ) {
+        const real_t a = A;
+        const real_t h = H;
+        const real_t cq = q;
+        const real_t cr = r;
+        real_t s, pp, g = gain;
+
+        if ( init ) {
+            xS = in[ 0 ];
+            init = false;
+        }
+        s = xS;
+        pp = p;
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            real_t pH;
+            /* Predict */
+            s = a*s;
+            pp = ( a*a*pp ) + cq;
+            /* Measurement */
+            pH = pp*h;
+            g = pH/( cr + ( h*pH ) );
+            s += g*( in[ i ] - ( h*s ) );
+            pp = ( 1.0_re - ( g*h ) )*pp;
+            out[ i ] = s;
+        }
+        xS = s;
+        p = pp;
+        gain = g;
+    }
+}
+/*============================================================================*/
 bool smootherDESF::setup( const real_t a,
                           const real_t b,
                           const size_t nS )
@@ -374,6 +765,35 @@ real_t smootherDESF::smooth( const real_t x )
     return lt + ( n*bt ); /*model/forecast*/
 }
 /*============================================================================*/
+void smootherDESF::smooth( const real_t * const in,
+                           real_t * const out,
+                           const size_t len )
+{
+    if ( len > 0U ) {
+        const real_t a = alpha;
+        const real_t b = beta;
+        const real_t steps = n;
+        real_t l, t;
+
+        if ( init ) {
+            lt = in[ 0 ];
+            bt = in[ 0 ];
+            init = false;
+        }
+        l = lt;
+        t = bt;
+        for ( size_t i = 0U ; i < len ; ++i ) {
+            const real_t lt_1 = l;
+
+            l = ( ( 1.0_re - a )*lt_1 ) + ( a*in[ i ] ); /*level*/
+            t = ( ( 1.0_re - b )*t ) + ( b*( l - lt_1 ) ); /*trend*/
+            out[ i ] = l + ( steps*t ); /*model/forecast*/
+        }
+        lt = l;
+        bt = t;
+    }
+}
+/*============================================================================*/
 bool smootherALNF::setup( const real_t a,
                           const real_t m,
                           const size_t wsize,
@@ -387,6 +807,7 @@ bool smootherALNF::setup( const real_t a,
         alpha = a;
         mu = m;
         xx = window;
+        xr = nullptr;
         w = weights;
         w_1 = ( mu > 0.0_re ) ? w1 : nullptr;
         n = wsize;
@@ -397,22 +818,36 @@ bool smootherALNF::setup( const real_t a,
     return retValue;
 }
 /*============================================================================*/
+bool smootherALNF::setRingBuffer( real_t *buffer )
+{
+    bool retValue = false;
+
+    if ( isSetup ) {
+        windowRelocate( xx, xr, head, n, buffer );
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
 real_t smootherALNF::smooth( const real_t x )
 {
     real_t xe;
+    const real_t *s;
 
     if ( init ) {
         /*cstat -CERT-FLP36-C */
         const real_t np = 1.0_re/static_cast<real_t>( n );
         /*cstat +CERT-FLP36-C */
-        windowSet( xx, n, x );
+        windowInit( xx, xr, n, x );
         windowSet( w, n, np );
         if ( nullptr != w_1 ) {
             windowSet( w_1, n, np );
         }
         init = false;
     }
-    xe = discreteSystem::updateFIR( xx, n, x, w );
+    xe = windowUpdate( xx, xr, head, n, x, w );
+    s = windowData( xx, xr, head );
     if ( nullptr != w_1 ) {
         real_t * const ww_1 = &w[ n ];
 
@@ -420,16 +855,551 @@ real_t smootherALNF::smooth( const real_t x )
             const real_t w0 = w[ i ];
             const real_t w1 = ww_1[ i ];
 
-            w[ i ] += ( alpha*( x - xe )*xx[ i ] ) + ( mu*( w0 - w1 ) );
+            w[ i ] += ( alpha*( x - xe )*s[ i ] ) + ( mu*( w0 - w1 ) );
             w_1[ i ] = w0;
         }
     }
     else {
         for ( size_t i = 0U ; i < n ; ++i ) {
-            w[ i ] += alpha*( x - xe )*xx[ i ];
+            w[ i ] += alpha*( x - xe )*s[ i ];
         }
     }
 
     return xe;
 }
 /*============================================================================*/
+/*! @cond  */
+namespace {
+    /*The banks process the channels with the same expressions of the scalar
+    filters, and the window filters use the same kernels for the lanes of a
+    block. They are written once as templates over the type V, which is
+    real_t for the remaining channels and a vector of real_t otherwise, so
+    both paths perform the same floating-point operations*/
+    #if defined( SMOOTHER_BANK_SIMD )
+        #define SMOOTHER_INLINE   inline __attribute__( ( always_inline ) )
+    #else
+        #define SMOOTHER_INLINE   inline
+    #endif
+
+    /*the kernels take their vectors by reference and never return one, so
+    no wide vector crosses the boundary of a function built without AVX*/
+    template<typename V>
+    SMOOTHER_INLINE void bankLoad( V &v,
+                                   const real_t * const p )
+    {
+        (void)memcpy( &v, p, sizeof(V) );
+    }
+    template<typename V>
+    SMOOTHER_INLINE void bankStore( real_t * const p,
+                           const V &v )
+    {
+        (void)memcpy( p, &v, sizeof(V) );
+    }
+
+    struct lpf1Op {
+        real_t * const alpha;
+        real_t * const y1;
+        template<typename V>
+        SMOOTHER_INLINE void apply( const size_t i,
+                           const real_t * const x,
+                           real_t * const y ) const
+        {
+            V xi, ai, y1i, yi;
+
+            bankLoad<V>( xi, &x[ i ] );
+            bankLoad<V>( ai, &alpha[ i ] );
+            bankLoad<V>( y1i, &y1[ i ] );
+            yi = xi + ( ai*( y1i - xi ) );
+            bankStore<V>( &y1[ i ], yi );
+            bankStore<V>( &y[ i ], yi );
+        }
+    };
+    struct lpf2Op {
+        real_t * const k;
+        real_t * const a1;
+        real_t * const a2;
+        real_t * const b1;
+        real_t * const x1;
+        real_t * const x2;
+        real_t * const y1;
+        real_t * const y2;
+        template<typename V>
+        SMOOTHER_INLINE void apply( const size_t i,
+                           const real_t * const x,
+                           real_t * const y ) const
+        {
+            V xi, ki, x1i, x2i, y1i, y2i, a1i, a2i, b1i, yi;
+
+            bankLoad<V>( xi, &x[ i ] );
+            bankLoad<V>( ki, &k[ i ] );
+            bankLoad<V>( x1i, &x1[ i ] );
+            bankLoad<V>( x2i, &x2[ i ] );
+            bankLoad<V>( y1i, &y1[ i ] );
+            bankLoad<V>( y2i, &y2[ i ] );
+            bankLoad<V>( a1i, &a1[ i ] );
+            bankLoad<V>( a2i, &a2[ i ] );
+            bankLoad<V>( b1i, &b1[ i ] );
+            yi = ( ki*xi ) + ( b1i*x1i ) + ( ki*x2i ) - ( a1i*y1i ) - ( a2i*y2i );
+            bankStore<V>( &x2[ i ], x1i );
+            bankStore<V>( &x1[ i ], xi );
+            bankStore<V>( &y2[ i ], y1i );
+            bankStore<V>( &y1[ i ], yi );
+            bankStore<V>( &y[ i ], yi );
+        }
+    };
+    struct expwOp {
+        real_t * const lambda;
+        real_t * const m;
+        real_t * const w;
+        template<typename V>
+        SMOOTHER_INLINE void apply( const size_t i,
+                           const real_t * const x,
+                           real_t * const y ) const
+        {
+            V li, wi, mi, xi, iw;
+
+            bankLoad<V>( li, &lambda[ i ] );
+            bankLoad<V>( wi, &w[ i ] );
+            bankLoad<V>( mi, &m[ i ] );
+            bankLoad<V>( xi, &x[ i ] );
+            wi = ( li*wi ) + 1.0_re;
+            iw = 1.0_re/wi;
+            mi = ( mi*( 1.0_re - iw ) ) + ( iw*xi );
+            bankStore<V>( &w[ i ], wi );
+            bankStore<V>( &m[ i ], mi );
+            bankStore<V>( &y[ i ], mi );
+        }
+    };
+    struct desfOp {
+        real_t * const alpha;
+        real_t * const beta;
+        real_t * const n;
+        real_t * const lt;
+        real_t * const bt;
+        template<typename V>
+        SMOOTHER_INLINE void apply( const size_t i,
+                           const real_t * const x,
+                           real_t * const y ) const
+        {
+            V ai, bi, ni, xi, lt_1, lti, bti;
+
+            bankLoad<V>( ai, &alpha[ i ] );
+            bankLoad<V>( bi, &beta[ i ] );
+            bankLoad<V>( ni, &n[ i ] );
+            bankLoad<V>( xi, &x[ i ] );
+            bankLoad<V>( lt_1, &lt[ i ] );
+            bankLoad<V>( bti, &bt[ i ] );
+            lti = ( ( 1.0_re - ai )*lt_1 ) + ( ai*xi ); /*level*/
+            bti = ( ( 1.0_re - bi )*bti ) + ( bi*( lti - lt_1 ) ); /*trend*/
+            bankStore<V>( &lt[ i ], lti );
+            bankStore<V>( &bt[ i ], bti );
+            bankStore<V>( &y[ i ], lti + ( ni*bti ) ); /*model/forecast*/
+        }
+    };
+    /*the window filters over a block: every lane computes one output with
+    the same order of operations of discreteSystem::updateFIR(). The signal
+    is the window w (w[0] the newest sample) followed by the block x, and q
+    is the position of a sample in that signal*/
+    struct firOp {
+        const real_t * const w;
+        const real_t * const c;
+        const size_t wsize;
+        template<typename V>
+        SMOOTHER_INLINE void signal( V &s,
+                                     const real_t * const x,
+                                     const size_t q ) const
+        {
+            if ( q >= wsize ) {
+                bankLoad<V>( s, &x[ q - wsize ] );
+            }
+            else {
+                real_t t[ sizeof(V)/sizeof(real_t) ];
+
+                for ( size_t l = 0U ; l < ( sizeof(V)/sizeof(real_t) ) ; ++l ) {
+                    t[ l ] = ( ( q + l ) < wsize ) ? w[ wsize - 1U - q - l ] : x[ q + l - wsize ];
+                }
+                bankLoad<V>( s, t );
+            }
+        }
+        template<typename V>
+        SMOOTHER_INLINE void apply( const size_t j,
+                                    const real_t * const x,
+                                    real_t * const y ) const
+        {
+            V acc, s;
+
+            (void)memset( &acc, 0, sizeof(V) );
+            if ( nullptr != c ) {
+                for ( size_t i = ( wsize - 1U ) ; i >= 1U ; --i ) {
+                    signal<V>( s, x, j + wsize - i );
+                    acc += s*c[ i ];
+                }
+                bankLoad<V>( s, &x[ j ] );
+                acc += c[ 0 ]*s;
+            }
+            else {
+                for ( size_t i = ( wsize - 1U ) ; i >= 1U ; --i ) {
+                    signal<V>( s, x, j + wsize - i );
+                    acc += s;
+                }
+                bankLoad<V>( s, &x[ j ] );
+                acc += s;
+            }
+            bankStore<V>( &y[ j ], acc );
+        }
+    };
+
+    #if defined( SMOOTHER_BANK_SIMD )
+        /*keep the same rounding of the scalar filters on targets with FMA*/
+        #if defined( __clang__ )
+            #define SMOOTHER_KERNEL( isa )    __attribute__( ( target( isa ) ) )
+            #define SMOOTHER_KERNEL_BASE      /*EMPTY MACRO*/
+        #else
+            #define SMOOTHER_KERNEL( isa )    __attribute__( ( target( isa ), optimize( "fp-contract=off" ) ) )
+            #define SMOOTHER_KERNEL_BASE      __attribute__( ( optimize( "fp-contract=off" ) ) )
+        #endif
+
+        /*B is the vector width in bytes*/
+        template<typename Op, size_t B>
+        SMOOTHER_INLINE void bankLoop( const Op &op,
+                                       const real_t * const x,
+                                       real_t * const y,
+                                       const size_t n )
+        {
+            constexpr size_t N = B/sizeof(real_t);
+            typedef real_t V __attribute__( ( vector_size( B ) ) );
+            size_t i = 0U;
+
+            for ( ; ( i + N ) <= n ; i += N ) {
+                op.template apply<V>( i, x, y );
+            }
+            for ( ; i < n ; ++i ) {
+                op.template apply<real_t>( i, x, y );
+            }
+        }
+
+        #if defined( __x86_64__ )
+            enum class bankISA { SSE2, AVX, AVX512 };
+
+            bankISA bankLevel( void ) noexcept
+            {
+                static const bankISA level = ( __builtin_cpu_init(),
+                                               ( 0 != __builtin_cpu_supports( "avx512f" ) ) ? bankISA::AVX512 :
+                                               ( 0 != __builtin_cpu_supports( "avx" ) ) ? bankISA::AVX : bankISA::SSE2 );
+                return level;
+            }
+            template<typename Op>
+            SMOOTHER_KERNEL( "avx512f" ) void bankAVX512( const Op &op, const real_t * const x, real_t * const y, const size_t n )
+            {
+                bankLoop<Op, 64U>( op, x, y, n );
+            }
+            template<typename Op>
+            SMOOTHER_KERNEL( "avx" ) void bankAVX( const Op &op, const real_t * const x, real_t * const y, const size_t n )
+            {
+                bankLoop<Op, 32U>( op, x, y, n );
+            }
+            template<typename Op>
+            SMOOTHER_KERNEL_BASE void bankSSE2( const Op &op, const real_t * const x, real_t * const y, const size_t n )
+            {
+                bankLoop<Op, 16U>( op, x, y, n );
+            }
+            template<typename Op>
+            void bankRun( const Op &op,
+                          const real_t * const x,
+                          real_t * const y,
+                          const size_t n ) noexcept
+            {
+                switch ( bankLevel() ) {
+                    case bankISA::AVX512:
+                        bankAVX512<Op>( op, x, y, n );
+                        break;
+                    case bankISA::AVX:
+                        bankAVX<Op>( op, x, y, n );
+                        break;
+                    default:
+                        bankSSE2<Op>( op, x, y, n );
+                        break;
+                }
+            }
+        #else
+            template<typename Op>
+            SMOOTHER_KERNEL_BASE void bankRun( const Op &op,
+                                               const real_t * const x,
+                                               real_t * const y,
+                                               const size_t n ) noexcept
+            {
+                bankLoop<Op, 16U>( op, x, y, n );
+            }
+        #endif
+        #undef SMOOTHER_KERNEL
+        #undef SMOOTHER_KERNEL_BASE
+    #else
+        template<typename Op>
+        void bankRun( const Op &op,
+                      const real_t * const x,
+                      real_t * const y,
+                      const size_t n ) noexcept
+        {
+            for ( size_t i = 0U ; i < n ; ++i ) {
+                op.template apply<real_t>( i, x, y );
+            }
+        }
+    #endif
+    #undef SMOOTHER_INLINE
+
+    void windowBlockFIR( real_t * const w,
+                         real_t * const r,
+                         size_t &head,
+                         const size_t wsize,
+                         const real_t * const c,
+                         const real_t * const in,
+                         real_t * const out,
+                         const size_t n )
+    {
+        if ( in == out ) {
+            /*the outputs would overwrite samples that are still needed*/
+            for ( size_t i = 0U ; i < n ; ++i ) {
+                out[ i ] = windowUpdate( w, r, head, wsize, in[ i ], c );
+            }
+        }
+        else if ( nullptr != r ) {
+            bankRun( firOp{ &r[ head ], c, wsize }, in, out, n );
+            /*insert the samples that remain in the window*/
+            for ( size_t i = ( n > wsize ) ? ( n - wsize ) : 0U ; i < n ; ++i ) {
+                head = ( 0U == head ) ? ( wsize - 1U ) : ( head - 1U );
+                r[ head ] = in[ i ];
+                r[ head + wsize ] = in[ i ];
+            }
+        }
+        else {
+            bankRun( firOp{ w, c, wsize }, in, out, n );
+            /*the window keeps the last wsize samples of the signal*/
+            if ( n >= wsize ) {
+                for ( size_t i = 0U ; i < wsize ; ++i ) {
+                    w[ i ] = in[ n - 1U - i ];
+                }
+            }
+            else {
+                for ( size_t i = ( wsize - 1U ) ; i >= n ; --i ) {
+                    w[ i ] = w[ i - n ];
+                }
+                for ( size_t i = 0U ; i < n ; ++i ) {
+                    w[ i ] = in[ n - 1U - i ];
+                }
+            }
+        }
+    }
+}
+/*! @endcond  */
+/*============================================================================*/
+bool smootherLPF1Bank::setup( real_t *area,
+                              const size_t n,
+                              const real_t a )
+{
+    bool retValue = false;
+
+    if ( ( nullptr != area ) && ( n > 0U ) && ( a > 0.0_re ) && ( a < 1.0_re ) ) {
+        alpha = area;
+        y1 = &area[ n ];
+        nChannels = n;
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            alpha[ i ] = a;
+        }
+        retValue = reset();
+        isSetup = retValue;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool smootherLPF1Bank::setChannel( const size_t channel,
+                                   const real_t a )
+{
+    bool retValue = false;
+
+    if ( isSetup && ( channel < nChannels ) && ( a > 0.0_re ) && ( a < 1.0_re ) ) {
+        alpha[ channel ] = a;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+void smootherLPF1Bank::smooth( const real_t * const x,
+                               real_t * const y )
+{
+    if ( init ) {
+        for ( size_t i = 0U ; i < nChannels ; ++i ) {
+            y1[ i ] = x[ i ];
+        }
+        init = false;
+    }
+    bankRun( lpf1Op{ alpha, y1 }, x, y, nChannels );
+}
+/*============================================================================*/
+bool smootherLPF2Bank::setup( real_t *area,
+                              const size_t n,
+                              const real_t a )
+{
+    bool retValue = false;
+
+    if ( ( nullptr != area ) && ( n > 0U ) && ( a > 0.0_re ) && ( a < 1.0_re ) ) {
+        k = area;
+        a1 = &area[ n ];
+        a2 = &area[ 2U*n ];
+        b1 = &area[ 3U*n ];
+        x1 = &area[ 4U*n ];
+        x2 = &area[ 5U*n ];
+        y1 = &area[ 6U*n ];
+        y2 = &area[ 7U*n ];
+        nChannels = n;
+        lpf2Coefficients( a, k[ 0 ], a1[ 0 ], a2[ 0 ], b1[ 0 ] );
+        for ( size_t i = 1U ; i < n ; ++i ) {
+            k[ i ] = k[ 0 ];
+            a1[ i ] = a1[ 0 ];
+            a2[ i ] = a2[ 0 ];
+            b1[ i ] = b1[ 0 ];
+        }
+        retValue = reset();
+        isSetup = retValue;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool smootherLPF2Bank::setChannel( const size_t channel,
+                                   const real_t a )
+{
+    bool retValue = false;
+
+    if ( isSetup && ( channel < nChannels ) && ( a > 0.0_re ) && ( a < 1.0_re ) ) {
+        lpf2Coefficients( a, k[ channel ], a1[ channel ], a2[ channel ], b1[ channel ] );
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+void smootherLPF2Bank::smooth( const real_t * const x,
+                               real_t * const y )
+{
+    if ( init ) {
+        for ( size_t i = 0U ; i < nChannels ; ++i ) {
+            y1[ i ] = x[ i ];
+            y2[ i ] = x[ i ];
+            x1[ i ] = x[ i ];
+            x2[ i ] = x[ i ];
+        }
+        init = false;
+    }
+    bankRun( lpf2Op{ k, a1, a2, b1, x1, x2, y1, y2 }, x, y, nChannels );
+}
+/*============================================================================*/
+bool smootherEXPWBank::setup( real_t *area,
+                              const size_t n,
+                              const real_t lam )
+{
+    bool retValue = false;
+
+    if ( ( nullptr != area ) && ( n > 0U ) && ( lam > 0.0_re ) && ( lam < 1.0_re ) ) {
+        lambda = area;
+        m = &area[ n ];
+        w = &area[ 2U*n ];
+        nChannels = n;
+        for ( size_t i = 0U ; i < n ; ++i ) {
+            lambda[ i ] = lam;
+        }
+        retValue = reset();
+        isSetup = retValue;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool smootherEXPWBank::setChannel( const size_t channel,
+                                   const real_t lam )
+{
+    bool retValue = false;
+
+    if ( isSetup && ( channel < nChannels ) && ( lam > 0.0_re ) && ( lam < 1.0_re ) ) {
+        lambda[ channel ] = lam;
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+void smootherEXPWBank::smooth( const real_t * const x,
+                               real_t * const y )
+{
+    if ( init ) {
+        for ( size_t i = 0U ; i < nChannels ; ++i ) {
+            m[ i ] = x[ i ];
+            w[ i ] = 1.0_re;
+        }
+        init = false;
+    }
+    bankRun( expwOp{ lambda, m, w }, x, y, nChannels );
+}
+/*============================================================================*/
+bool smootherDESFBank::setup( real_t *area,
+                              const size_t nCh,
+                              const real_t a,
+                              const real_t b,
+                              const size_t nS )
+{
+    bool retValue = false;
+
+    if ( ( nullptr != area ) && ( nCh > 0U ) && ( a > 0.0_re ) && ( a < 1.0_re ) && ( b > 0.0_re ) && ( b < 1.0_re ) ) {
+        alpha = area;
+        beta = &area[ nCh ];
+        n = &area[ 2U*nCh ];
+        lt = &area[ 3U*nCh ];
+        bt = &area[ 4U*nCh ];
+        nChannels = nCh;
+        for ( size_t i = 0U ; i < nCh ; ++i ) {
+            alpha[ i ] = a;
+            beta[ i ] = b;
+            /*cstat -CERT-FLP36-C */
+            n[ i ] = static_cast<real_t>( nS );
+            /*cstat +CERT-FLP36-C */
+        }
+        retValue = reset();
+        isSetup = retValue;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+bool smootherDESFBank::setChannel( const size_t channel,
+                                   const real_t a,
+                                   const real_t b,
+                                   const size_t nS )
+{
+    bool retValue = false;
+
+    if ( isSetup && ( channel < nChannels ) && ( a > 0.0_re ) && ( a < 1.0_re ) && ( b > 0.0_re ) && ( b < 1.0_re ) ) {
+        alpha[ channel ] = a;
+        beta[ channel ] = b;
+        /*cstat -CERT-FLP36-C */
+        n[ channel ] = static_cast<real_t>( nS );
+        /*cstat +CERT-FLP36-C */
+        retValue = true;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+void smootherDESFBank::smooth( const real_t * const x,
+                               real_t * const y )
+{
+    if ( init ) {
+        for ( size_t i = 0U ; i < nChannels ; ++i ) {
+            lt[ i ] = x[ i ];
+            bt[ i ] = x[ i ];
+        }
+        init = false;
+    }
+    bankRun( desfOp{ alpha, beta, n, lt, bt }, x, y, nChannels );
+}
+/*============================================================================*/